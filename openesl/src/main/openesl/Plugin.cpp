@@ -33,6 +33,7 @@
 #include <esl/object/VectorStringValue.h>
 
 // common4esl
+#include <esl/monitoring/FileAppender.h>
 #include <esl/monitoring/MemBufferAppender.h>
 #include <esl/monitoring/OStreamAppender.h>
 #include <esl/monitoring/SimpleLayout.h>
@@ -109,6 +110,7 @@ void Plugin::install(esl::plugin::Registry& registry, const char* data) {
 
 
 	// common4esl
+	registry.addPlugin("esl/monitoring/FileAppender", esl::monitoring::FileAppender::create);
 	registry.addPlugin("esl/monitoring/MemBufferAppender", esl::monitoring::MemBufferAppender::create);
 	registry.addPlugin("esl/monitoring/OStreamAppender", esl::monitoring::OStreamAppender::create);
 	registry.addPlugin("esl/monitoring/SimpleLayout", esl::monitoring::SimpleLayout::create);
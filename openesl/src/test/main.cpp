@@ -0,0 +1,54 @@
+#include <openesl/benchmarks/Codec.h>
+#include <openesl/benchmarks/IO.h>
+#ifdef OPENESL_USE_SQLITE4ESL
+#include <openesl/benchmarks/database/BulkLoad.h>
+#include <openesl/benchmarks/database/Fetch.h>
+#endif
+
+#include <iostream>
+#include <string>
+
+
+void printUsage() {
+	std::cout << "Possible arguments:\n\n";
+	std::cout << "  codec <arguments>\n";
+	std::cout << "  io <arguments>\n";
+#ifdef OPENESL_USE_SQLITE4ESL
+	std::cout << "  bulkload <arguments>\n";
+	std::cout << "  fetch <arguments>\n";
+#endif
+	std::cout << "\nCall a benchmark without arguments to get its usage.\n";
+}
+
+int main(int argc, const char *argv[]) {
+	std::string argument;
+
+	if(argc >= 2) {
+		argument = argv[1];
+	}
+	else {
+		std::cout << "Wrong number of arguments.\n\n";
+		printUsage();
+		return -1;
+	}
+
+	/* arguments of the benchmark start with its name */
+	if(argument == "codec") {
+		return openesl::benchmarks::codec(argc - 1, argv + 1);
+	}
+	else if(argument == "io") {
+		return openesl::benchmarks::io(argc - 1, argv + 1);
+	}
+#ifdef OPENESL_USE_SQLITE4ESL
+	else if(argument == "bulkload") {
+		return openesl::benchmarks::database::bulkLoad(argc - 1, argv + 1);
+	}
+	else if(argument == "fetch") {
+		return openesl::benchmarks::database::fetch(argc - 1, argv + 1);
+	}
+#endif
+
+	std::cout << "unknown argument \"" << argument << "\".\n\n";
+	printUsage();
+	return -1;
+}
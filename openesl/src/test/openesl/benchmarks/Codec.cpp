@@ -0,0 +1,303 @@
+#include <openesl/benchmarks/Codec.h>
+#include <openesl/benchmarks/CodecReference.h>
+#include <esl/io/Reader.h>
+#include <esl/io/Writer.h>
+#include <esl/io/input/Base64.h>
+#include <esl/io/output/Base64.h>
+#include <esl/utility/String.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <exception>
+#include <iostream>
+#include <random>
+#include <string>
+
+namespace openesl {
+inline namespace v1_6 {
+namespace benchmarks {
+
+namespace {
+
+using String = esl::utility::String;
+
+std::size_t failures = 0;
+
+void check(bool condition, const char* description, const std::string& input) {
+	if(!condition) {
+		if(failures < 10) {
+			std::cerr << "FAILED: " << description << " for input of " << input.size() << " bytes: \"" << String::toBase16(input) << "\" (hex)\n";
+		}
+		++failures;
+	}
+}
+
+/* Reader of a string that returns at most 5000 bytes per call */
+class StringReader : public esl::io::Reader {
+public:
+	StringReader(const std::string& aStr, std::mt19937& aRandom)
+	: str(aStr),
+	  random(aRandom)
+	{ }
+
+	std::size_t read(void* data, std::size_t size) override {
+		if(pos >= str.size()) {
+			return npos;
+		}
+		size = std::min(std::min(size, str.size() - pos), static_cast<std::size_t>(1 + random() % 5000));
+		std::memcpy(data, str.data() + pos, size);
+		pos += size;
+		return size;
+	}
+
+	const void* peek(std::size_t& size) override {
+		size = 0;
+		return nullptr;
+	}
+
+	void skip(std::size_t size) override {
+		pos += std::min(size, str.size() - pos);
+	}
+
+	std::size_t getSizeReadable() const override {
+		return str.size() - pos;
+	}
+
+	bool hasSize() const override {
+		return true;
+	}
+
+	std::size_t getSize() const override {
+		return str.size();
+	}
+
+private:
+	const std::string& str;
+	std::mt19937& random;
+	std::size_t pos = 0;
+};
+
+/* Writer that stalls on every other call and consumes at most 100 bytes per call */
+class StallingWriter : public esl::io::Writer {
+public:
+	StallingWriter(std::mt19937& aRandom)
+	: random(aRandom)
+	{ }
+
+	std::size_t write(const void* data, std::size_t size) override {
+		if(size == 0) {
+			isEnded = true;
+			return 0;
+		}
+		if(isEnded) {
+			hasDataAfterEnd = true;
+		}
+		if(random() % 2 == 0) {
+			return 0;
+		}
+		size = std::min(size, static_cast<std::size_t>(1 + random() % 100));
+		str.append(static_cast<const char*>(data), size);
+		return size;
+	}
+
+	std::size_t getSizeWritable() const override {
+		return npos;
+	}
+
+	std::string str;
+	bool isEnded = false;
+	bool hasDataAfterEnd = false;
+
+private:
+	std::mt19937& random;
+};
+
+std::string encodeStream(const std::string& input, String::Base64Variant base64Variant, bool withPadding, std::mt19937& random) {
+	StringReader stringReader(input, random);
+	esl::io::output::Base64 reader(stringReader, base64Variant, withPadding);
+
+	std::string result;
+	char buffer[4096];
+	while(true) {
+		std::size_t count = reader.read(buffer, 1 + random() % sizeof(buffer));
+		if(count == esl::io::Reader::npos) {
+			break;
+		}
+		result.append(buffer, count);
+	}
+	return result;
+}
+
+/* returns false if the data is not written completely before the end is signaled to the base writer */
+bool decodeStream(const std::string& input, std::string& result, std::mt19937& random) {
+	StallingWriter stallingWriter(random);
+	esl::io::input::Base64 writer(stallingWriter);
+
+	std::size_t pos = 0;
+	while(pos < input.size()) {
+		std::size_t count = writer.write(input.data() + pos, std::min(input.size() - pos, static_cast<std::size_t>(1 + random() % 5000)));
+		if(count == esl::io::Writer::npos) {
+			return false;
+		}
+		pos += count;
+	}
+	/* like esl::io::Input users, the end is signaled once */
+	writer.write(input.data(), 0);
+
+	result = stallingWriter.str;
+	return stallingWriter.isEnded && !stallingWriter.hasDataAfterEnd;
+}
+
+void runCheck(std::size_t iterations) {
+	std::mt19937 random(1);
+	const char characters[] = "ABCxyz019+/-_= \r\n\b%!";
+
+	for(std::size_t iteration = 0; iteration < iterations; ++iteration) {
+		std::string input(random() % 200, 0);
+		for(auto& c : input) {
+			c = static_cast<char>(random());
+		}
+
+		check(String::toBase16(input) == reference::toBase16(input), "toBase16", input);
+
+		for(int url = 0; url < 2; ++url) {
+			for(int withPadding = 0; withPadding < 2; ++withPadding) {
+				String::Base64Variant base64Variant = url ? String::base64url : String::base64;
+				std::string encoded = String::toBase64(input, base64Variant, withPadding);
+				check(encoded == reference::toBase64(input, url, withPadding), "toBase64", input);
+				check(String::fromBase64(encoded, false) == reference::fromBase64(encoded, false), "fromBase64 of encoded input", input);
+				check(encodeStream(input, base64Variant, withPadding, random) == encoded, "output::Base64", input);
+
+				/* "%3d" padding of base64url is not decoded */
+				if(!url || !withPadding) {
+					std::string decoded;
+					check(String::fromBase64(encoded, false) == input, "fromBase64 round trip", input);
+					check(decodeStream(encoded, decoded, random) && decoded == input, "input::Base64", input);
+				}
+			}
+		}
+
+		/* text of base64 characters, formatting characters and invalid characters */
+		std::string text(input.size(), 0);
+		for(auto& c : text) {
+			c = random() % 8 ? characters[random() % 9] : characters[random() % (sizeof(characters) - 1)];
+		}
+		for(int acceptFormatting = 0; acceptFormatting < 2; ++acceptFormatting) {
+			check(String::fromBase64(text, acceptFormatting) == reference::fromBase64(text, acceptFormatting), "fromBase64 of text", text);
+		}
+
+		/* long base64 text with one replaced character, so the vector path stops somewhere in the middle */
+		std::string longText = String::toBase64(input + input + input + input, String::base64, false);
+		if(!longText.empty()) {
+			longText[random() % longText.size()] = characters[random() % (sizeof(characters) - 1)];
+		}
+		for(int acceptFormatting = 0; acceptFormatting < 2; ++acceptFormatting) {
+			check(String::fromBase64(longText, acceptFormatting) == reference::fromBase64(longText, acceptFormatting), "fromBase64 of long text", longText);
+		}
+
+		std::string ascii(input.size(), 0);
+		for(auto& c : ascii) {
+			c = static_cast<char>(random() % 128);
+		}
+		check(String::toURLEncoded(ascii) == reference::toURLEncoded(ascii), "toURLEncoded", ascii);
+		check(String::fromURLEncoded(String::toURLEncoded(input)) == input, "fromURLEncoded round trip", input);
+		std::string urlEncoded = String::toURLEncoded(ascii);
+		check(String::fromURLEncoded(urlEncoded) == reference::fromURLEncoded(urlEncoded), "fromURLEncoded", urlEncoded);
+	}
+	check(String::toURLEncoded("\xe4") == "%e4", "toURLEncoded of byte >= 0x80", "\xe4");
+}
+
+template<typename Function>
+double measure(Function function) {
+	constexpr int repetitions = 3;
+
+	auto start = std::chrono::steady_clock::now();
+	for(int i = 0; i < repetitions; ++i) {
+		function();
+	}
+	std::chrono::duration<double> duration = std::chrono::steady_clock::now() - start;
+	return duration.count() * 1000 / repetitions;
+}
+
+void runBenchmark(std::size_t size) {
+	std::mt19937 random(1);
+	std::string input(size, 0);
+	for(auto& c : input) {
+		c = static_cast<char>(random());
+	}
+
+	std::string base64 = String::toBase64(input, String::base64, true);
+	std::string urlEncoded = String::toURLEncoded(input);
+
+	std::printf("%-16s %12s %12s\n", (std::to_string(size) + " bytes").c_str(), "previous ms", "current ms");
+	std::printf("%-16s %12.1f %12.1f\n", "toBase64",
+			measure([&] { reference::toBase64(input, false, true); }),
+			measure([&] { String::toBase64(input, String::base64, true); }));
+	std::printf("%-16s %12.1f %12.1f\n", "fromBase64",
+			measure([&] { reference::fromBase64(base64, false); }),
+			measure([&] { String::fromBase64(base64, false); }));
+	std::printf("%-16s %12.1f %12.1f\n", "toBase16",
+			measure([&] { reference::toBase16(input); }),
+			measure([&] { String::toBase16(input); }));
+	std::printf("%-16s %12.1f %12.1f\n", "toURLEncoded",
+			measure([&] { reference::toURLEncoded(input); }),
+			measure([&] { String::toURLEncoded(input); }));
+	std::printf("%-16s %12.1f %12.1f\n", "fromURLEncoded",
+			measure([&] { reference::fromURLEncoded(urlEncoded); }),
+			measure([&] { String::fromURLEncoded(urlEncoded); }));
+}
+
+void printUsage() {
+	std::cerr << "Usage: Testopenesl codec check [<iterations>]\n";
+	std::cerr << "       Testopenesl codec bench [<bytes>]\n\n";
+	std::cerr << "check compares the codecs of esl/utility/String and the Base64 reader and writer of esl/io\n";
+	std::cerr << "with the previous implementation for random input, default 20000 iterations. Returns 0 if all results are equal.\n";
+	std::cerr << "bench measures the codecs and the previous implementation for random data, default 16 MiB.\n";
+}
+
+} /* anonymous namespace */
+
+int codec(int argc, const char *argv[]) {
+	if(argc < 2 || argc > 3) {
+		printUsage();
+		return -1;
+	}
+
+	std::string mode = argv[1];
+	std::size_t number = 0;
+	if(argc == 3) {
+		try {
+			number = static_cast<std::size_t>(std::stoull(argv[2]));
+		}
+		catch(const std::exception&) {
+			std::cerr << "Invalid number \"" << argv[2] << "\".\n\n";
+			printUsage();
+			return -1;
+		}
+	}
+
+	if(mode == "check") {
+		runCheck(argc == 3 ? number : 20000);
+		if(failures > 0) {
+			std::cerr << failures << " checks failed\n";
+			return 1;
+		}
+		std::cout << "OK\n";
+	}
+	else if(mode == "bench") {
+		runBenchmark(argc == 3 ? number : static_cast<std::size_t>(16) << 20);
+	}
+	else {
+		printUsage();
+		return -1;
+	}
+
+	return 0;
+}
+
+} /* namespace benchmarks */
+} /* inline namespace v1_6 */
+} /* namespace openesl */
@@ -0,0 +1,16 @@
+#ifndef OPENESL_BENCHMARKS_CODEC_H_
+#define OPENESL_BENCHMARKS_CODEC_H_
+
+namespace openesl {
+inline namespace v1_6 {
+namespace benchmarks {
+
+/* Compares the codecs of esl/utility/String and the Base64 reader and writer of esl/io with their previous
+ * implementation ("check") and measures both ("bench"). Returns 0 if all results are equal. */
+int codec(int argc, const char *argv[]);
+
+} /* namespace benchmarks */
+} /* inline namespace v1_6 */
+} /* namespace openesl */
+
+#endif /* OPENESL_BENCHMARKS_CODEC_H_ */
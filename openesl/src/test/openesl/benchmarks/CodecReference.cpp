@@ -0,0 +1,225 @@
+#include <openesl/benchmarks/CodecReference.h>
+
+#include <cctype>
+#include <cstdio>
+#include <string>
+#include <vector>
+
+namespace openesl {
+inline namespace v1_6 {
+namespace benchmarks {
+namespace reference {
+
+namespace {
+
+std::string base64Chars("ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/");
+std::string base64urlChars("ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_");
+
+std::string decodeBase64Buffer(std::size_t bufferIndex, unsigned char* buffer) {
+	std::string str;
+
+	for(std::size_t index = bufferIndex; index<4; ++index) {
+		buffer[index] = 0;
+	}
+
+	for(std::size_t index = 0; index<4; ++index) {
+		std::size_t pos = base64Chars.find(buffer[index]);
+		if(pos == std::string::npos) {
+			pos = base64urlChars.find(buffer[index]);
+		}
+		buffer[index] = pos;
+	}
+
+	unsigned char tmpBuffer[3];
+	tmpBuffer[0] = (buffer[0] << 2) + ((buffer[1] & 0x30) >> 4);
+	tmpBuffer[1] = ((buffer[1] & 0xf) << 4) + ((buffer[2] & 0x3c) >> 2);
+	tmpBuffer[2] = ((buffer[2] & 0x3) << 6) + buffer[3];
+
+	for(std::size_t index = 0; index<bufferIndex-1; ++index) {
+		str += tmpBuffer[index];
+	}
+
+	return str;
+}
+
+} /* anonymous namespace */
+
+std::string toBase16(const std::string& input) {
+	std::vector<char> output;
+	output.resize(1 + (input.size() * 2));
+
+	char* outputCurrent = &output[0];
+
+	for(auto inputCurrent : input) {
+		/* '%.2x' is the same as '%02x'. But du we better want to use '%.2X' or '%02X%' ? */
+		std::snprintf(outputCurrent, 3, "%.2x", static_cast<unsigned char>(inputCurrent));
+		outputCurrent += 2;
+	}
+
+	return std::string(&output[0], input.size() * 2);
+}
+
+std::string toBase64(const std::string& str, bool url, bool withPadding) {
+	std::string result;
+
+	for(std::size_t i = 0; i < str.size(); i += 3) {
+		int packed64 = (str[i] & 0xff) << 16;
+		std::size_t num64Chars = 2;
+
+		if(i + 1 < str.size()) {
+			packed64 = packed64 + ((str[i+1] & 0xff) << 8);
+			num64Chars = 3;
+		}
+
+		if(i + 2 < str.size()) {
+			packed64 = packed64 + (str[i+2] & 0xff);
+			num64Chars = 4;
+		}
+
+		for(std::size_t j = 0; j < 4; ++j) {
+			if(j < num64Chars) {
+				if(url) {
+					result += base64urlChars[(packed64 >> (6 * (3 - j))) & 0x3f];
+				}
+				else {
+					result += base64Chars[(packed64 >> (6 * (3 - j))) & 0x3f];
+				}
+			}
+			else if(withPadding) {
+				if(url) {
+					result += "%3d";
+				}
+				else {
+					result += "=";
+				}
+			}
+		}
+	}
+	return result;
+}
+
+std::string fromBase64(const std::string& base64str, bool acceptFormatting) {
+	std::string str;
+
+	std::size_t bufferIndex = 0;
+	unsigned char buffer[4];
+	bool isNewLineCR = true;
+	bool isNewLineLF = true;
+	bool hasCharacters = false;
+
+	for(std::size_t pos = 0; pos < base64str.size(); ++pos) {
+		// abort if characater base64str[pos] is end symbol
+		if(base64str[pos] == '=') {
+			break;
+		}
+
+		if(acceptFormatting) {
+			if(base64str[pos] == 10) {
+				if(isNewLineLF) {
+					break;
+				}
+				else {
+					isNewLineLF = true;
+					continue;
+				}
+			}
+			if(base64str[pos] == 13) {
+				if(isNewLineCR) {
+					break;
+				}
+				else {
+					isNewLineCR = true;
+					continue;
+				}
+			}
+
+			if(base64str[pos] == ' ' || base64str[pos] == 8) {
+				if(hasCharacters) {
+					break;
+				}
+				else {
+					isNewLineCR = true;
+					isNewLineLF = true;
+					continue;
+				}
+			}
+		}
+
+		// abort if characater base64str[pos] is not base64
+		if(std::isalnum(base64str[pos]) == 0 && base64str[pos] != '+' && base64str[pos] != '/' && base64str[pos] != '-' && base64str[pos] != '_') {
+			break;
+		}
+
+		isNewLineCR = false;
+		isNewLineLF = false;
+		hasCharacters = true;
+		buffer[bufferIndex] = base64str[pos];
+		++bufferIndex;
+
+		if(bufferIndex==4) {
+			str += decodeBase64Buffer(bufferIndex, buffer);
+			bufferIndex = 0;
+		}
+	}
+
+	if(bufferIndex>0) {
+		str += decodeBase64Buffer(bufferIndex, buffer);
+	}
+
+	return str;
+}
+
+std::string toURLEncoded(const std::string& str) {
+	std::string rv;
+
+	rv.reserve(str.size()*3);
+
+	for(const auto c : str) {
+		if(std::isalnum(static_cast<unsigned char>(c)) != 0
+		|| static_cast<unsigned char>(c) == '-'
+		|| static_cast<unsigned char>(c) == '_'
+		|| static_cast<unsigned char>(c) == '.'
+		|| static_cast<unsigned char>(c) == '~') {
+			rv += c;
+		}
+		else {
+			char buffer[3];
+			/* '%.2x' is the same as '%02x'. But du we better want to use '%.2X' or '%02X%' ? */
+			std::snprintf(buffer, 3, "%02x", static_cast<char>(c));
+			rv += '%';
+			rv += buffer;
+		}
+	}
+
+	return rv;
+}
+
+std::string fromURLEncoded(const std::string& urlEncodedStr) {
+	std::string rv;
+
+	rv.reserve(urlEncodedStr.size());
+
+	for(std::size_t i = 0; i < urlEncodedStr.size(); ++i) {
+		if(urlEncodedStr[i] != '%') {
+			rv += urlEncodedStr[i];
+		}
+		/* if string ends with '%', then just use this character instead of trying to decode it */
+		/* Another option would be to skip this character */
+		else if(i+1 == urlEncodedStr.size()) {
+			rv += urlEncodedStr[i];
+		}
+		else {
+			std::string part = urlEncodedStr.substr(i+1, i+2 == urlEncodedStr.size() ? 1 : 2);
+			char c = std::stoul(part, nullptr, 16);
+			rv += c;
+			i += (i+2 == urlEncodedStr.size()) ? 1 : 2;
+		}
+	}
+
+	return rv;
+}
+
+} /* namespace reference */
+} /* namespace benchmarks */
+} /* inline namespace v1_6 */
+} /* namespace openesl */
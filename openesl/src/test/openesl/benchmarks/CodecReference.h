@@ -0,0 +1,25 @@
+#ifndef OPENESL_BENCHMARKS_CODECREFERENCE_H_
+#define OPENESL_BENCHMARKS_CODECREFERENCE_H_
+
+#include <string>
+
+/* Previous character by character implementation of the codecs of esl::utility::String.
+ * It is the reference of the differential check and the baseline of the benchmark.
+ * toURLEncoded encodes bytes >= 0x80 as "%ff", so it is compared for ASCII input only. */
+namespace openesl {
+inline namespace v1_6 {
+namespace benchmarks {
+namespace reference {
+
+std::string toBase16(const std::string& str);
+std::string toBase64(const std::string& str, bool url, bool withPadding);
+std::string fromBase64(const std::string& base64str, bool acceptFormatting);
+std::string toURLEncoded(const std::string& str);
+std::string fromURLEncoded(const std::string& urlEncodedStr);
+
+} /* namespace reference */
+} /* namespace benchmarks */
+} /* inline namespace v1_6 */
+} /* namespace openesl */
+
+#endif /* OPENESL_BENCHMARKS_CODECREFERENCE_H_ */
@@ -0,0 +1,190 @@
+#include <openesl/benchmarks/IO.h>
+#include <esl/io/Output.h>
+#include <esl/io/Reader.h>
+#include <esl/io/Standard.h>
+#include <esl/io/Writer.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <exception>
+#include <iostream>
+#include <string>
+
+namespace openesl {
+inline namespace v1_6 {
+namespace benchmarks {
+
+namespace {
+
+constexpr std::size_t defaultSize = static_cast<std::size_t>(1) << 30;
+constexpr std::size_t bufferSize = 64 * 1024;
+
+char buffer[bufferSize];
+
+void printUsage() {
+	std::cerr << "Usage: Testopenesl io <mode> [<bytes>]\n\n";
+	std::cerr << "Throughput benchmark of esl/io/Standard. The result is printed to stderr.\n\n";
+	std::cerr << "  write [<bytes>]   writes <bytes> zero bytes to stdout\n";
+	std::cerr << "  copy [<bytes>]    copies up to <bytes> of stdin to stdout by Standard::getIn().read() and Standard::getOut().write()\n";
+	std::cerr << "  output [<bytes>]  copies up to <bytes> of stdin to stdout by Output(Standard::getIn()) and its producer\n\n";
+	std::cerr << "<bytes> is 1 GiB by default.\n\n";
+	std::cerr << "Examples:\n";
+	std::cerr << "  Testopenesl io write | cat > /dev/null\n";
+	std::cerr << "  head -c 1G /dev/urandom > in.bin && Testopenesl io copy < in.bin | cmp - in.bin\n";
+}
+
+/* Reader of the first "size" bytes of a base reader. It passes peek(...) through, so Output keeps its zero copy path. */
+class LimitedReader : public esl::io::Reader {
+public:
+	LimitedReader(esl::io::Reader& aReader, std::size_t aSize)
+	: reader(aReader),
+	  remaining(aSize),
+	  limit(aSize)
+	{ }
+
+	std::size_t read(void* data, std::size_t size) override {
+		if(remaining == 0) {
+			return npos;
+		}
+		std::size_t count = reader.read(data, std::min(size, remaining));
+		if(count != npos) {
+			remaining -= count;
+		}
+		return count;
+	}
+
+	const void* peek(std::size_t& size) override {
+		const void* data = remaining == 0 ? nullptr : reader.peek(size);
+		size = data ? std::min(size, remaining) : 0;
+		return data;
+	}
+
+	void skip(std::size_t size) override {
+		size = std::min(size, remaining);
+		reader.skip(size);
+		remaining -= size;
+	}
+
+	std::size_t getSizeReadable() const override {
+		return std::min(reader.getSizeReadable(), remaining);
+	}
+
+	bool hasSize() const override {
+		return reader.hasSize();
+	}
+
+	std::size_t getSize() const override {
+		return std::min(reader.getSize(), limit);
+	}
+
+private:
+	esl::io::Reader& reader;
+	std::size_t remaining;
+	std::size_t limit;
+};
+
+/* returns false if the writer reports an error */
+bool writeAll(esl::io::Writer& writer, const char* data, std::size_t size) {
+	while(size > 0) {
+		std::size_t count = writer.write(data, size);
+		if(count == esl::io::Writer::npos) {
+			return false;
+		}
+		data += count;
+		size -= count;
+	}
+	return true;
+}
+
+std::size_t write(std::size_t size) {
+	std::size_t written = 0;
+	while(written < size) {
+		std::size_t count = std::min(bufferSize, size - written);
+		if(!writeAll(esl::io::Standard::getOut(), buffer, count)) {
+			break;
+		}
+		written += count;
+	}
+	return written;
+}
+
+std::size_t copy(std::size_t size) {
+	std::size_t copied = 0;
+	while(copied < size) {
+		std::size_t count = esl::io::Standard::getIn().read(buffer, std::min(bufferSize, size - copied));
+		if(count == esl::io::Reader::npos) {
+			break;
+		}
+		if(!writeAll(esl::io::Standard::getOut(), buffer, count)) {
+			break;
+		}
+		copied += count;
+	}
+	return copied;
+}
+
+std::size_t output(std::size_t size) {
+	std::size_t copied = 0;
+	LimitedReader limitedReader(esl::io::Standard::getIn(), size);
+	esl::io::Output output(limitedReader);
+	while(true) {
+		std::size_t count = output.getProducer().produce(esl::io::Standard::getOut());
+		if(count == esl::io::Writer::npos) {
+			break;
+		}
+		copied += count;
+	}
+	return copied;
+}
+
+} /* anonymous namespace */
+
+int io(int argc, const char *argv[]) {
+	if(argc < 2 || argc > 3) {
+		printUsage();
+		return -1;
+	}
+
+	std::string mode = argv[1];
+	std::size_t size = defaultSize;
+	if(argc == 3) {
+		try {
+			size = static_cast<std::size_t>(std::stoull(argv[2]));
+		}
+		catch(const std::exception&) {
+			std::cerr << "Invalid number of bytes \"" << argv[2] << "\".\n\n";
+			printUsage();
+			return -1;
+		}
+	}
+
+	auto start = std::chrono::steady_clock::now();
+	std::size_t bytes;
+	if(mode == "write") {
+		bytes = write(size);
+	}
+	else if(mode == "copy") {
+		bytes = copy(size);
+	}
+	else if(mode == "output") {
+		bytes = output(size);
+	}
+	else {
+		printUsage();
+		return -1;
+	}
+	std::chrono::duration<double> duration = std::chrono::steady_clock::now() - start;
+
+	std::cerr << mode << ": " << bytes << " bytes in " << duration.count() << " s";
+	if(duration.count() > 0) {
+		std::cerr << " (" << static_cast<std::size_t>(static_cast<double>(bytes) / duration.count() / (1024 * 1024)) << " MiB/sec)";
+	}
+	std::cerr << "\n";
+
+	return (mode == "write" && bytes != size) ? 1 : 0;
+}
+
+} /* namespace benchmarks */
+} /* inline namespace v1_6 */
+} /* namespace openesl */
@@ -0,0 +1,15 @@
+#ifndef OPENESL_BENCHMARKS_IO_H_
+#define OPENESL_BENCHMARKS_IO_H_
+
+namespace openesl {
+inline namespace v1_6 {
+namespace benchmarks {
+
+/* Throughput of esl/io/Standard, e.g. "Testopenesl io write | cat > /dev/null" pipes 1 GiB. */
+int io(int argc, const char *argv[]);
+
+} /* namespace benchmarks */
+} /* inline namespace v1_6 */
+} /* namespace openesl */
+
+#endif /* OPENESL_BENCHMARKS_IO_H_ */
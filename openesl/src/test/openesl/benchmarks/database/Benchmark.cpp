@@ -0,0 +1,87 @@
+#include <openesl/benchmarks/database/Benchmark.h>
+
+#include <esl/database/SQLiteConnectionFactory.h>
+
+#include <exception>
+#include <iostream>
+
+namespace openesl {
+inline namespace v1_6 {
+namespace benchmarks {
+namespace database {
+
+Benchmark::Benchmark(std::string aDescription)
+: description(std::move(aDescription))
+{ }
+
+bool Benchmark::parse(int argc, const char *argv[]) {
+	name = argc > 0 ? argv[0] : "";
+
+	if(argc < 2) {
+		printUsage();
+		return false;
+	}
+
+	try {
+		rows = static_cast<std::size_t>(std::stoul(argv[1]));
+	}
+	catch(const std::exception&) {
+		std::cerr << "Invalid number of rows \"" << argv[1] << "\".\n\n";
+		printUsage();
+		return false;
+	}
+
+	bool hasURI = false;
+	settings.clear();
+	for(int i = 2; i < argc; ++i) {
+		std::string argument = argv[i];
+		std::string::size_type pos = argument.find('=');
+		if(pos == std::string::npos) {
+			std::cerr << "Invalid argument \"" << argument << "\".\n\n";
+			printUsage();
+			return false;
+		}
+		settings.push_back(std::make_pair(argument.substr(0, pos), argument.substr(pos + 1)));
+		if(settings.back().first == "URI") {
+			hasURI = true;
+		}
+	}
+	if(!hasURI) {
+		settings.push_back(std::make_pair("URI", "file:" + name + "?mode=memory"));
+	}
+
+	return true;
+}
+
+std::size_t Benchmark::getRows() const noexcept {
+	return rows;
+}
+
+std::unique_ptr<esl::database::ConnectionFactory> Benchmark::createConnectionFactory() const {
+	return esl::database::SQLiteConnectionFactory::create(settings);
+}
+
+void Benchmark::start() {
+	startTime = std::chrono::steady_clock::now();
+}
+
+void Benchmark::printRate(std::size_t rowCount, const char* text) const {
+	std::chrono::duration<double> duration = std::chrono::steady_clock::now() - startTime;
+
+	std::cout << rowCount << " rows" << text << " in " << duration.count() << " s";
+	if(duration.count() > 0) {
+		std::cout << " (" << static_cast<std::size_t>(static_cast<double>(rowCount) / duration.count()) << " rows/sec)";
+	}
+}
+
+void Benchmark::printUsage() const {
+	std::cerr << "Usage: Testopenesl " << name << " <rows> [<key>=<value> ...]\n\n";
+	std::cerr << description;
+	std::cerr << "Key/value pairs are the parameters of esl/database/SQLiteConnectionFactory, e.g. bulk-batch-size=1000\n";
+	std::cerr << "If URI is not specified, an in-memory database is used.\n";
+}
+
+} /* namespace database */
+} /* namespace benchmarks */
+} /* inline namespace v1_6 */
+} /* namespace openesl */
@@ -0,0 +1,51 @@
+#ifndef OPENESL_BENCHMARKS_DATABASE_BENCHMARK_H_
+#define OPENESL_BENCHMARKS_DATABASE_BENCHMARK_H_
+
+#include <esl/database/ConnectionFactory.h>
+
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace openesl {
+inline namespace v1_6 {
+namespace benchmarks {
+namespace database {
+
+/* Command line and timing shared by the database benchmarks. Arguments are "<name> <rows> [<key>=<value> ...]",
+ * key/value pairs are the parameters of esl/database/SQLiteConnectionFactory. If URI is not specified,
+ * the in-memory database "file:<name>?mode=memory" is used. */
+class Benchmark {
+public:
+	Benchmark(std::string description);
+
+	/* prints the usage to stderr and returns false if the arguments are invalid */
+	bool parse(int argc, const char *argv[]);
+
+	std::size_t getRows() const noexcept;
+	std::unique_ptr<esl::database::ConnectionFactory> createConnectionFactory() const;
+
+	void start();
+
+	/* prints "<rows> rows<text> in <seconds> s (<rows/sec> rows/sec)" without line feed to stdout */
+	void printRate(std::size_t rows, const char* text) const;
+
+private:
+	void printUsage() const;
+
+	std::string description;
+	std::string name;
+	std::size_t rows = 0;
+	std::vector<std::pair<std::string, std::string>> settings;
+	std::chrono::steady_clock::time_point startTime;
+};
+
+} /* namespace database */
+} /* namespace benchmarks */
+} /* inline namespace v1_6 */
+} /* namespace openesl */
+
+#endif /* OPENESL_BENCHMARKS_DATABASE_BENCHMARK_H_ */
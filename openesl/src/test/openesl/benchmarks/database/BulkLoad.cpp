@@ -0,0 +1,56 @@
+#include <openesl/benchmarks/database/BulkLoad.h>
+#include <openesl/benchmarks/database/Benchmark.h>
+
+#include <esl/database/Connection.h>
+#include <esl/database/ConnectionFactory.h>
+#include <esl/database/PreparedBulkStatement.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <iostream>
+#include <memory>
+#include <string>
+
+namespace openesl {
+inline namespace v1_6 {
+namespace benchmarks {
+namespace database {
+
+int bulkLoad(int argc, const char *argv[]) {
+	Benchmark benchmark("Inserts <rows> rows with a PreparedBulkStatement into a SQLite database and prints rows/sec.\n");
+	if(!benchmark.parse(argc, argv)) {
+		return -1;
+	}
+
+	try {
+		std::unique_ptr<esl::database::ConnectionFactory> connectionFactory = benchmark.createConnectionFactory();
+		std::unique_ptr<esl::database::Connection> connection = connectionFactory->createConnection();
+
+		connection->prepare("DROP TABLE IF EXISTS bulkload;").execute();
+		connection->prepare("CREATE TABLE bulkload (id INTEGER, value REAL, name TEXT);").execute();
+
+		benchmark.start();
+		{
+			esl::database::PreparedBulkStatement bulkStatement = connection->prepareBulk("INSERT INTO bulkload (id, value, name) VALUES (?, ?, ?);");
+			for(std::size_t i = 0; i < benchmark.getRows(); ++i) {
+				std::int64_t id = static_cast<std::int64_t>(i);
+				bulkStatement.execute(id, static_cast<double>(i) * 0.5, "row-" + std::to_string(i));
+			}
+			bulkStatement.flush();
+		}
+		benchmark.printRate(benchmark.getRows(), "");
+		std::cout << "\n";
+	}
+	catch(const std::exception& e) {
+		std::cerr << e.what() << "\n";
+		return -1;
+	}
+
+	return 0;
+}
+
+} /* namespace database */
+} /* namespace benchmarks */
+} /* inline namespace v1_6 */
+} /* namespace openesl */
@@ -0,0 +1,17 @@
+#ifndef OPENESL_BENCHMARKS_DATABASE_BULKLOAD_H_
+#define OPENESL_BENCHMARKS_DATABASE_BULKLOAD_H_
+
+namespace openesl {
+inline namespace v1_6 {
+namespace benchmarks {
+namespace database {
+
+/* Rows per second of esl/database/PreparedBulkStatement with the SQLite driver. */
+int bulkLoad(int argc, const char *argv[]);
+
+} /* namespace database */
+} /* namespace benchmarks */
+} /* inline namespace v1_6 */
+} /* namespace openesl */
+
+#endif /* OPENESL_BENCHMARKS_DATABASE_BULKLOAD_H_ */
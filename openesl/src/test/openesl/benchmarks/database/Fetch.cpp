@@ -0,0 +1,109 @@
+#include <openesl/benchmarks/database/Fetch.h>
+#include <openesl/benchmarks/database/Benchmark.h>
+
+#include <esl/database/Connection.h>
+#include <esl/database/ConnectionFactory.h>
+#include <esl/database/Field.h>
+#include <esl/database/PreparedBulkStatement.h>
+#include <esl/database/PreparedStatement.h>
+#include <esl/database/ResultSet.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace openesl {
+inline namespace v1_6 {
+namespace benchmarks {
+namespace database {
+
+namespace {
+
+constexpr std::size_t columnCount = 20;
+
+} /* anonymous namespace */
+
+int fetch(int argc, const char *argv[]) {
+	Benchmark benchmark("Fetches <rows> rows of a " + std::to_string(columnCount) + " column table from a SQLite database with esl::database::ResultSet\n"
+			"and prints the size of a row of fields and the fetch time.\n");
+	if(!benchmark.parse(argc, argv)) {
+		return -1;
+	}
+	const std::size_t rows = benchmark.getRows();
+
+	try {
+		std::unique_ptr<esl::database::ConnectionFactory> connectionFactory = benchmark.createConnectionFactory();
+		std::unique_ptr<esl::database::Connection> connection = connectionFactory->createConnection();
+
+		/* columns alternate between INTEGER, REAL, short TEXT and long TEXT */
+		std::string createSql = "CREATE TABLE fetchbench (";
+		std::string insertSql = "INSERT INTO fetchbench VALUES (";
+		for(std::size_t i = 0; i < columnCount; ++i) {
+			const char* type = (i % 4 == 0) ? "INTEGER" : (i % 4 == 1) ? "REAL" : "TEXT";
+			createSql += (i > 0 ? ", c" : "c") + std::to_string(i) + " " + type;
+			insertSql += (i > 0 ? ", ?" : "?");
+		}
+		createSql += ");";
+		insertSql += ");";
+
+		connection->prepare("DROP TABLE IF EXISTS fetchbench;").execute();
+		connection->prepare(createSql).execute();
+		{
+			esl::database::PreparedBulkStatement bulkStatement = connection->prepareBulk(insertSql);
+			std::vector<esl::database::Field> fields;
+			for(std::size_t row = 0; row < rows; ++row) {
+				fields.clear();
+				for(std::size_t i = 0; i < columnCount; ++i) {
+					switch(i % 4) {
+					case 0:
+						fields.emplace_back(static_cast<std::int64_t>(row * columnCount + i));
+						break;
+					case 1:
+						fields.emplace_back(static_cast<double>(row) * 0.25);
+						break;
+					case 2:
+						fields.emplace_back("v" + std::to_string(row));
+						break;
+					default:
+						fields.emplace_back("a longer text value that does not fit inline " + std::to_string(row));
+						break;
+					}
+				}
+				bulkStatement.execute(fields);
+			}
+		}
+
+		esl::database::PreparedStatement preparedStatement = connection->prepare("SELECT * FROM fetchbench;");
+		std::size_t fetchedRows = 0;
+		std::size_t checksum = 0;
+
+		std::cout << "sizeof(Field): " << sizeof(esl::database::Field) << " bytes, " << columnCount << " columns: " << (sizeof(esl::database::Field) * columnCount) << " bytes/row\n";
+
+		benchmark.start();
+		for(esl::database::ResultSet resultSet = preparedStatement.execute(); resultSet; resultSet.next()) {
+			for(std::size_t i = 0; i < columnCount; i += 4) {
+				checksum += static_cast<std::size_t>(resultSet[i].asInteger());
+				checksum += resultSet[i + 3].asStringView().size();
+			}
+			++fetchedRows;
+		}
+
+		benchmark.printRate(fetchedRows, " fetched");
+		std::cout << ", checksum " << checksum << "\n";
+	}
+	catch(const std::exception& e) {
+		std::cerr << e.what() << "\n";
+		return -1;
+	}
+
+	return 0;
+}
+
+} /* namespace database */
+} /* namespace benchmarks */
+} /* inline namespace v1_6 */
+} /* namespace openesl */
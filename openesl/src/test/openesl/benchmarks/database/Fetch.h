@@ -0,0 +1,17 @@
+#ifndef OPENESL_BENCHMARKS_DATABASE_FETCH_H_
+#define OPENESL_BENCHMARKS_DATABASE_FETCH_H_
+
+namespace openesl {
+inline namespace v1_6 {
+namespace benchmarks {
+namespace database {
+
+/* Rows per second of esl/database/ResultSet with a 20 column result set of the SQLite driver. */
+int fetch(int argc, const char *argv[]);
+
+} /* namespace database */
+} /* namespace benchmarks */
+} /* inline namespace v1_6 */
+} /* namespace openesl */
+
+#endif /* OPENESL_BENCHMARKS_DATABASE_FETCH_H_ */
@@ -0,0 +1,51 @@
+#include <common4esl/monitoring/FlightRecorder.h>
+
+#include <esl/monitoring/SimpleLayout.h>
+
+#include <exception>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace {
+
+void printUsage() {
+	std::cerr << "Usage: openesl-flightrecorder <file> [<key>=<value> ...]\n\n";
+	std::cerr << "Renders a flight recorder file written by esl/monitoring/MemBufferAppender with parameter \"file\".\n";
+	std::cerr << "Key/value pairs are the parameters of esl/monitoring/SimpleLayout, e.g. show-function=true\n";
+}
+
+} /* anonymous namespace */
+
+int main(int argc, const char *argv[]) {
+	if(argc < 2) {
+		printUsage();
+		return -1;
+	}
+
+	std::vector<std::pair<std::string, std::string>> layoutSettings;
+	for(int i = 2; i < argc; ++i) {
+		std::string argument = argv[i];
+		std::string::size_type pos = argument.find('=');
+		if(pos == std::string::npos) {
+			std::cerr << "Invalid argument \"" << argument << "\".\n\n";
+			printUsage();
+			return -1;
+		}
+		layoutSettings.push_back(std::make_pair(argument.substr(0, pos), argument.substr(pos + 1)));
+	}
+
+	try {
+		esl::monitoring::SimpleLayout layout{esl::monitoring::SimpleLayout::Settings(layoutSettings)};
+		common4esl::monitoring::FlightRecorder flightRecorder(argv[1]);
+
+		flightRecorder.write(std::cout, &layout);
+	}
+	catch(const std::exception& e) {
+		std::cerr << e.what() << "\n";
+		return -1;
+	}
+
+	return 0;
+}
@@ -0,0 +1,138 @@
+#include <esl/database/Column.h>
+#include <esl/database/Connection.h>
+#include <esl/database/ConnectionFactory.h>
+#include <esl/database/Field.h>
+#include <esl/database/PreparedStatement.h>
+#include <esl/database/ResultSet.h>
+#include <esl/database/sql/MemoryEngine.h>
+#include <esl/database/table/MemoryTables.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace {
+
+std::size_t failures = 0;
+
+void check(bool condition, const std::string& description) {
+	if(!condition) {
+		std::cerr << "FAILED: " << description << "\n";
+		++failures;
+	}
+}
+
+/* returns the rows of the result set, each row as fields separated by '|' and NULL as "NULL" */
+std::vector<std::string> query(esl::database::Connection& connection, const std::string& sql, const std::vector<esl::database::Field>& parameters = {}) {
+	std::vector<std::string> rows;
+
+	esl::database::PreparedStatement preparedStatement = connection.prepare(sql);
+	for(esl::database::ResultSet resultSet = preparedStatement.execute(parameters); resultSet; resultSet.next()) {
+		std::string row;
+		for(std::size_t i = 0; i < preparedStatement.getResultColumns().size(); ++i) {
+			row += (i == 0 ? "" : "|") + (resultSet[i].isNull() ? std::string("NULL") : resultSet[i].asString());
+		}
+		rows.push_back(row);
+	}
+
+	return rows;
+}
+
+void checkQuery(esl::database::Connection& connection, const std::string& sql, const std::vector<std::string>& expectedRows, const std::vector<esl::database::Field>& parameters = {}) {
+	try {
+		std::vector<std::string> rows = query(connection, sql, parameters);
+		check(rows == expectedRows, sql);
+		if(rows != expectedRows) {
+			for(const auto& row : rows) {
+				std::cerr << "  " << row << "\n";
+			}
+		}
+	}
+	catch(const std::exception& e) {
+		check(false, sql + ": " + e.what());
+	}
+}
+
+/* expects an exception, whose message contains expectedMessage */
+void checkError(esl::database::Connection& connection, const std::string& sql, const std::string& expectedMessage = "") {
+	try {
+		query(connection, sql);
+		check(false, sql + ": no exception");
+	}
+	catch(const std::exception& e) {
+		check(std::string(e.what()).find(expectedMessage) != std::string::npos, sql + ": unexpected message \"" + e.what() + "\"");
+	}
+}
+
+} /* anonymous namespace */
+
+/* Example and self check of esl/database/sql/MemoryEngine over esl/database/table/MemoryTables.
+ * Returns 0 if all queries return the expected rows. */
+int main() {
+	using esl::database::Column;
+	using esl::database::Field;
+
+	std::unique_ptr<esl::database::table::MemoryTables> memoryTables(new esl::database::table::MemoryTables);
+
+	memoryTables->addTable("country", {
+			Column("code", Column::Type::sqlVarChar, false, 0, 0, 0, 0, 0),
+			Column("rate", Column::Type::sqlDouble, true, 0, 0, 0, 0, 0)
+	});
+	memoryTables->addRow("country", {Field("DE"), Field(0.19)});
+	memoryTables->addRow("country", {Field("FR"), Field(0.2)});
+	memoryTables->addRow("country", {Field("CH"), Field()});
+
+	memoryTables->addTable("sales", {
+			Column("id", Column::Type::sqlInteger, false, 0, 0, 0, 0, 0),
+			Column("country", Column::Type::sqlVarChar, true, 0, 0, 0, 0, 0),
+			Column("amount", Column::Type::sqlDouble, true, 0, 0, 0, 0, 0)
+	});
+	const char* countries[] = {"DE", "FR", "CH"};
+	for(int i = 0; i < 30; ++i) {
+		memoryTables->addRow("sales", {Field(i), Field(countries[i % 3]), i % 10 == 0 ? Field() : Field(i * 0.5)});
+	}
+
+	/* a row with a field that cannot be converted must not be added partially */
+	try {
+		memoryTables->addRow("sales", {Field(30), Field("DE"), Field("not a number")});
+		check(false, "addRow with invalid field: no exception");
+	}
+	catch(const std::exception&) {
+	}
+	check(memoryTables->getRowCount("sales") == 30, "addRow with invalid field: row count");
+	memoryTables->addRow("sales", {Field(31), Field("DE"), Field(99.5)});
+
+	std::unique_ptr<esl::database::sql::Engine> engine = esl::database::sql::MemoryEngine::create();
+	engine->addTables("mem", std::move(memoryTables));
+	std::unique_ptr<esl::database::ConnectionFactory> connectionFactory = engine->createConnectionFactory();
+	std::unique_ptr<esl::database::Connection> connection = connectionFactory->createConnection();
+
+	checkQuery(*connection, "SELECT code FROM country WHERE rate IS NULL", {"CH"});
+	checkQuery(*connection, "SELECT code FROM mem.country WHERE rate >= 0.2", {"FR"});
+	checkQuery(*connection, "SELECT code FROM country WHERE rate > 1e-1 ORDER BY code", {"DE", "FR"});
+	checkQuery(*connection, "SELECT code FROM country WHERE rate < 19E-2", {});
+	checkQuery(*connection, "SELECT COUNT(*), COUNT(amount), MIN(id), MAX(id) FROM sales WHERE id < ?", {"10|9|0|9"}, {Field(10)});
+	checkQuery(*connection, "SELECT country, COUNT(*) AS n FROM sales WHERE 20 > id GROUP BY country ORDER BY country", {"CH|6", "DE|7", "FR|7"});
+	checkQuery(*connection, "SELECT id, amount FROM sales WHERE country = 'FR' ORDER BY id DESC LIMIT 2", {"28|14.000000", "25|12.500000"});
+	checkQuery(*connection, "SELECT id, country, amount FROM sales WHERE amount > 20", {"31|DE|99.500000"});
+
+	checkError(*connection, "SELECT id FROM sales WHERE id > 99999999999999999999");
+	checkError(*connection, "SELECT id FROM sales WHERE amount > 1e999");
+	checkError(*connection, "SELECT id FROM sales ORDER BY 99999999999999999999");
+	checkError(*connection, "SELECT id FROM sales LIMIT -1");
+	checkError(*connection, "SELECT x FROM sales");
+	checkError(*connection, "SELECT id FROM nope");
+	checkError(*connection, "SELECT id FROM sales JOIN country ON sales.country = country.code", "JOIN is not supported");
+	checkError(*connection, "SELECT id FROM sales, country", "JOIN is not supported");
+
+	if(failures > 0) {
+		std::cerr << failures << " checks failed\n";
+		return 1;
+	}
+	std::cout << "OK\n";
+	return 0;
+}
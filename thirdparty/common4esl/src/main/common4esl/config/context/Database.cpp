@@ -2,6 +2,7 @@
 #include <common4esl/config/FilePosition.h>
 
 #include <esl/database/ConnectionFactory.h>
+#include <esl/database/PooledConnectionFactory.h>
 #include <esl/plugin/exception/PluginNotFound.h>
 #include <esl/plugin/Registry.h>
 
@@ -99,12 +100,20 @@ void Database::save(std::ostream& oStream, std::size_t spaces) const {
 		oStream << " ref-id=\"" << refId << "\"";
 	}
 
-	if(settings.empty()) {
+	if(settings.empty() && !hasPool) {
 		oStream << "/>\n";
 	}
 	else {
 		oStream << ">\n";
 
+		if(hasPool) {
+			oStream << makeSpaces(spaces+2) << "<pool";
+			for(const auto& poolSetting : poolSettings) {
+				oStream << " " << poolSetting.first << "=\"" << poolSetting.second << "\"";
+			}
+			oStream << "/>\n";
+		}
+
 		for(const auto& setting : settings) {
 			setting.saveParameter(oStream, spaces+2);
 		}
@@ -160,6 +169,15 @@ std::unique_ptr<esl::object::Object> Database::create() const {
 		throw FilePosition::add(*this, "Could not create a database connection factory with id '" + id + "' for implementation '" + implementation + "' because interface method createConnectionFactory() returns nullptr.");
 	}
 
+	if(hasPool) {
+		try {
+			connectionFactory.reset(new esl::database::PooledConnectionFactory(esl::database::PooledConnectionFactory::Settings(poolSettings), std::move(connectionFactory)));
+		}
+		catch(const std::exception& e) {
+			throw FilePosition::add(*this, e);
+		}
+	}
+
 	return std::unique_ptr<esl::object::Object>(connectionFactory.release());
 }
 
@@ -173,11 +191,34 @@ void Database::parseInnerElement(const tinyxml2::XMLElement& element) {
 	if(elementName == "parameter") {
 		settings.push_back(Setting(getFileName(), element, true));
 	}
+	else if(elementName == "pool") {
+		parsePool(element);
+	}
 	else {
 		throw FilePosition::add(*this, "Unknown element name \"" + elementName + "\"");
 	}
 }
 
+void Database::parsePool(const tinyxml2::XMLElement& element) {
+	if(hasPool) {
+		throw FilePosition::add(*this, "Multiple definition of element 'pool'.");
+	}
+	hasPool = true;
+
+	if(element.FirstChildElement() != nullptr) {
+		throw FilePosition::add(*this, "Element 'pool' must not contain inner elements.");
+	}
+
+	for(const tinyxml2::XMLAttribute* attribute = element.FirstAttribute(); attribute != nullptr; attribute = attribute->Next()) {
+		std::string attributeName = attribute->Name();
+
+		if(attributeName != "max-size" && attributeName != "idle-timeout" && attributeName != "validation-query" && attributeName != "timeout") {
+			throw FilePosition::add(*this, "Unknown attribute '" + attributeName + "' for element 'pool'");
+		}
+		poolSettings.push_back(std::make_pair(attributeName, std::string(attribute->Value())));
+	}
+}
+
 } /* namespace context */
 } /* namespace config */
 } /* inline namespace v1_6 */
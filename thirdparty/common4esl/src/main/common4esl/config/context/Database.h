@@ -12,6 +12,7 @@
 #include <memory>
 #include <ostream>
 #include <string>
+#include <utility>
 #include <vector>
 
 namespace common4esl {
@@ -32,8 +33,13 @@ private:
 	std::string refId;
 	std::vector<Setting> settings;
 
+	/* attributes of element "pool". If it is defined, the connection factory is wrapped by a PooledConnectionFactory. */
+	bool hasPool = false;
+	std::vector<std::pair<std::string, std::string>> poolSettings;
+
 	std::unique_ptr<esl::object::Object> create() const;
 	void parseInnerElement(const tinyxml2::XMLElement& element);
+	void parsePool(const tinyxml2::XMLElement& element);
 };
 
 } /* namespace context */
@@ -0,0 +1,93 @@
+/*
+MIT License
+Copyright (c) 2019-2025 Sven Lukas
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <common4esl/database/PooledConnection.h>
+
+#include <esl/Logger.h>
+
+#include <exception>
+#include <utility>
+
+namespace common4esl {
+inline namespace v1_6 {
+namespace database {
+
+namespace {
+esl::Logger logger("common4esl::database::PooledConnection");
+}
+
+PooledConnection::PooledConnection(PooledConnectionFactory::Pool::unique_ptr aEntry)
+: entry(std::move(aEntry))
+{ }
+
+PooledConnection::~PooledConnection() {
+	/* don't give an open transaction back to the pool. Without an open transaction rollback does nothing.
+	 * If rollback fails the connection is dropped and the entry gets a new connection on next checkout. */
+	try {
+		if(entry->connection->isClosed()) {
+			entry->connection.reset();
+		}
+		else {
+			entry->connection->rollback();
+		}
+	}
+	catch(const std::exception& e) {
+		ESL__LOGGER_WARN_THIS("Drop connection because rollback failed: ", e.what(), "\n");
+		entry->connection.reset();
+	}
+	catch(...) {
+		ESL__LOGGER_WARN_THIS("Drop connection because rollback failed with unknown exception\n");
+		entry->connection.reset();
+	}
+}
+
+esl::database::PreparedStatement PooledConnection::prepare(const std::string& sql) const {
+	return entry->connection->prepare(sql);
+}
+
+esl::database::PreparedBulkStatement PooledConnection::prepareBulk(const std::string& sql) const {
+	return entry->connection->prepareBulk(sql);
+}
+
+void PooledConnection::commit() const {
+	entry->connection->commit();
+}
+
+void PooledConnection::rollback() const {
+	entry->connection->rollback();
+}
+
+bool PooledConnection::isClosed() const {
+	return entry->connection->isClosed();
+}
+
+void* PooledConnection::getNativeHandle() const {
+	return entry->connection->getNativeHandle();
+}
+
+const std::set<std::string>& PooledConnection::getImplementations() const {
+	return entry->connection->getImplementations();
+}
+
+} /* namespace database */
+} /* inline namespace v1_6 */
+} /* namespace common4esl */
@@ -0,0 +1,121 @@
+/*
+MIT License
+Copyright (c) 2019-2025 Sven Lukas
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <common4esl/database/PooledConnectionFactory.h>
+#include <common4esl/database/PooledConnection.h>
+
+#include <esl/Logger.h>
+#include <esl/system/Stacktrace.h>
+
+#include <chrono>
+#include <stdexcept>
+#include <utility>
+
+namespace common4esl {
+inline namespace v1_6 {
+namespace database {
+
+namespace {
+esl::Logger logger("common4esl::database::PooledConnectionFactory");
+}
+
+PooledConnectionFactory::PooledConnectionFactory(const esl::database::PooledConnectionFactory::Settings& aSettings, std::unique_ptr<esl::database::ConnectionFactory> aConnectionFactory)
+: settings(aSettings),
+  connectionFactory(std::move(aConnectionFactory)),
+  /* entries are created empty, so the pool lock is never held while a connection is opened */
+  pool([]() { return std::unique_ptr<Entry>(new Entry); }, settings.maxSize, settings.idleTimeout, true, true)
+{
+	if(!connectionFactory) {
+		throw esl::system::Stacktrace::add(std::runtime_error("Cannot create pooled connection factory without a connection factory"));
+	}
+}
+
+std::unique_ptr<esl::database::Connection> PooledConnectionFactory::createConnection() {
+	std::chrono::steady_clock::time_point timePointBegin = std::chrono::steady_clock::now();
+	Pool::unique_ptr entry = settings.timeout > std::chrono::milliseconds(0) ? pool.get(settings.timeout) : pool.get();
+	std::chrono::nanoseconds waitTime = std::chrono::steady_clock::now() - timePointBegin;
+
+	{
+		std::lock_guard<std::mutex> statisticsLock(statisticsMutex);
+		statistics.waitTime += waitTime;
+		if(entry) {
+			++statistics.checkouts;
+		}
+		else {
+			++statistics.timeouts;
+		}
+	}
+
+	if(!entry) {
+		throw esl::system::Stacktrace::add(std::runtime_error("Timeout while waiting for a pooled database connection"));
+	}
+
+	if(entry->connection && !isValid(*entry->connection)) {
+		ESL__LOGGER_DEBUG_THIS("Drop invalid connection ", entry->connection.get(), "\n");
+		entry->connection.reset();
+
+		std::lock_guard<std::mutex> statisticsLock(statisticsMutex);
+		++statistics.validationFailures;
+	}
+
+	if(!entry->connection) {
+		entry->connection = connectionFactory->createConnection();
+		if(!entry->connection) {
+			throw esl::system::Stacktrace::add(std::runtime_error("Connection factory returned no connection for the pool"));
+		}
+
+		std::lock_guard<std::mutex> statisticsLock(statisticsMutex);
+		++statistics.creates;
+	}
+
+	return std::unique_ptr<esl::database::Connection>(new PooledConnection(std::move(entry)));
+}
+
+esl::database::PooledConnectionFactory::Statistics PooledConnectionFactory::getStatistics() const {
+	std::lock_guard<std::mutex> statisticsLock(statisticsMutex);
+	return statistics;
+}
+
+bool PooledConnectionFactory::isValid(const esl::database::Connection& connection) const {
+	try {
+		if(connection.isClosed()) {
+			return false;
+		}
+		if(!settings.validationQuery.empty()) {
+			connection.prepare(settings.validationQuery).execute();
+		}
+	}
+	catch(const std::exception& e) {
+		ESL__LOGGER_DEBUG_THIS("Validation of connection failed: ", e.what(), "\n");
+		return false;
+	}
+	catch(...) {
+		ESL__LOGGER_DEBUG_THIS("Validation of connection failed with unknown exception\n");
+		return false;
+	}
+
+	return true;
+}
+
+} /* namespace database */
+} /* inline namespace v1_6 */
+} /* namespace common4esl */
@@ -0,0 +1,70 @@
+/*
+MIT License
+Copyright (c) 2019-2025 Sven Lukas
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef COMMON4ESL_DATABASE_POOLEDCONNECTIONFACTORY_H_
+#define COMMON4ESL_DATABASE_POOLEDCONNECTIONFACTORY_H_
+
+#include <esl/database/Connection.h>
+#include <esl/database/ConnectionFactory.h>
+#include <esl/database/PooledConnectionFactory.h>
+#include <esl/utility/ObjectPool.h>
+
+#include <memory>
+#include <mutex>
+
+namespace common4esl {
+inline namespace v1_6 {
+namespace database {
+
+class PooledConnectionFactory : public esl::database::ConnectionFactory {
+public:
+	/* An entry of the pool owns a connection of the decorated factory.
+	 * The connection is empty if it has not been opened so far or if it has been dropped because it was broken. */
+	struct Entry {
+		std::unique_ptr<esl::database::Connection> connection;
+	};
+	using Pool = esl::utility::ObjectPool<Entry>;
+
+	PooledConnectionFactory(const esl::database::PooledConnectionFactory::Settings& settings, std::unique_ptr<esl::database::ConnectionFactory> connectionFactory);
+
+	std::unique_ptr<esl::database::Connection> createConnection() override;
+
+	esl::database::PooledConnectionFactory::Statistics getStatistics() const;
+
+private:
+	const esl::database::PooledConnectionFactory::Settings settings;
+
+	/* must be declared before "pool", because the pool must be destroyed first */
+	std::unique_ptr<esl::database::ConnectionFactory> connectionFactory;
+	Pool pool;
+
+	mutable std::mutex statisticsMutex;
+	esl::database::PooledConnectionFactory::Statistics statistics;
+
+	bool isValid(const esl::database::Connection& connection) const;
+};
+
+} /* namespace database */
+} /* inline namespace v1_6 */
+} /* namespace common4esl */
+
+#endif /* COMMON4ESL_DATABASE_POOLEDCONNECTIONFACTORY_H_ */
@@ -0,0 +1,74 @@
+/*
+MIT License
+Copyright (c) 2019-2025 Sven Lukas
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <common4esl/database/sql/Connection.h>
+#include <common4esl/database/sql/PreparedStatementBinding.h>
+#include <common4esl/database/sql/Query.h>
+
+#include <esl/system/Stacktrace.h>
+
+#include <memory>
+#include <stdexcept>
+
+namespace common4esl {
+inline namespace v1_6 {
+namespace database {
+namespace sql {
+
+namespace {
+std::set<std::string> implementations{{"MemoryEngine"}};
+}
+
+Connection::Connection(const Plan::TablesList& aTablesList)
+: tablesList(aTablesList)
+{ }
+
+esl::database::PreparedStatement Connection::prepare(const std::string& sql) const {
+	return esl::database::PreparedStatement(std::unique_ptr<esl::database::PreparedStatement::Binding>(new PreparedStatementBinding(Plan(Query::parse(sql), tablesList))));
+}
+
+esl::database::PreparedBulkStatement Connection::prepareBulk(const std::string& sql) const {
+    throw esl::system::Stacktrace::add(std::runtime_error("Cannot prepare bulk statement \"" + sql + "\", because tables of the SQL engine are read only"));
+}
+
+void Connection::commit() const {
+}
+
+void Connection::rollback() const {
+}
+
+bool Connection::isClosed() const {
+	return false;
+}
+
+void* Connection::getNativeHandle() const {
+	return nullptr;
+}
+
+const std::set<std::string>& Connection::getImplementations() const {
+	return implementations;
+}
+
+} /* namespace sql */
+} /* namespace database */
+} /* inline namespace v1_6 */
+} /* namespace common4esl */
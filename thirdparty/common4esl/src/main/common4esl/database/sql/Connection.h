@@ -0,0 +1,68 @@
+/*
+MIT License
+Copyright (c) 2019-2025 Sven Lukas
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef COMMON4ESL_DATABASE_SQL_CONNECTION_H_
+#define COMMON4ESL_DATABASE_SQL_CONNECTION_H_
+
+#include <common4esl/database/sql/Plan.h>
+
+#include <esl/database/Connection.h>
+#include <esl/database/PreparedBulkStatement.h>
+#include <esl/database/PreparedStatement.h>
+
+#include <set>
+#include <string>
+
+namespace common4esl {
+inline namespace v1_6 {
+namespace database {
+namespace sql {
+
+/* Connection of an Engine. Tables are read only, so there is nothing to commit or to roll back. */
+class Connection : public esl::database::Connection {
+public:
+	Connection(const Plan::TablesList& tablesList);
+
+	esl::database::PreparedStatement prepare(const std::string& sql) const override;
+
+	/* throws, because tables are read only */
+	esl::database::PreparedBulkStatement prepareBulk(const std::string& sql) const override;
+
+	void commit() const override;
+	void rollback() const override;
+
+	bool isClosed() const override;
+
+	void* getNativeHandle() const override;
+
+	const std::set<std::string>& getImplementations() const override;
+
+private:
+	const Plan::TablesList& tablesList;
+};
+
+} /* namespace sql */
+} /* namespace database */
+} /* inline namespace v1_6 */
+} /* namespace common4esl */
+
+#endif /* COMMON4ESL_DATABASE_SQL_CONNECTION_H_ */
@@ -0,0 +1,57 @@
+/*
+MIT License
+Copyright (c) 2019-2025 Sven Lukas
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <common4esl/database/sql/Engine.h>
+#include <common4esl/database/sql/ConnectionFactory.h>
+
+#include <esl/system/Stacktrace.h>
+
+#include <stdexcept>
+#include <utility>
+
+namespace common4esl {
+inline namespace v1_6 {
+namespace database {
+namespace sql {
+
+void Engine::addTables(const std::string& id, std::unique_ptr<esl::database::table::Tables> tables) {
+	if(!tables) {
+        throw esl::system::Stacktrace::add(std::runtime_error("Tables \"" + id + "\" are empty"));
+	}
+
+	for(const auto& entry : tablesList) {
+		if(entry.first == id) {
+	        throw esl::system::Stacktrace::add(std::runtime_error("Tables \"" + id + "\" are already defined"));
+		}
+	}
+
+	tablesList.emplace_back(id, std::shared_ptr<const esl::database::table::Tables>(std::move(tables)));
+}
+
+std::unique_ptr<esl::database::ConnectionFactory> Engine::createConnectionFactory() {
+	return std::unique_ptr<esl::database::ConnectionFactory>(new ConnectionFactory(tablesList));
+}
+
+} /* namespace sql */
+} /* namespace database */
+} /* inline namespace v1_6 */
+} /* namespace common4esl */
@@ -0,0 +1,598 @@
+/*
+MIT License
+Copyright (c) 2019-2025 Sven Lukas
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <common4esl/database/sql/Plan.h>
+
+#include <esl/system/Stacktrace.h>
+
+#include <algorithm>
+#include <cctype>
+#include <cstdint>
+#include <cstdlib>
+#include <numeric>
+#include <stdexcept>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+
+namespace common4esl {
+inline namespace v1_6 {
+namespace database {
+namespace sql {
+
+namespace {
+
+using esl::database::Column;
+using esl::database::ResultBatch;
+
+const std::size_t batchSize = 1024;
+
+bool equalsIgnoreCase(const std::string& str1, const std::string& str2) {
+	return str1.size() == str2.size() && std::equal(str1.begin(), str1.end(), str2.begin(), [](char c1, char c2) {
+		return std::toupper(static_cast<unsigned char>(c1)) == std::toupper(static_cast<unsigned char>(c2));
+	});
+}
+
+std::string_view getStringView(const ResultBatch::Array& array, std::size_t row) {
+	const std::size_t* offsets = array.getStringOffsets();
+	return std::string_view(array.getStringData() + offsets[row], offsets[row+1] - offsets[row]);
+}
+
+double getDouble(const ResultBatch::Array& array, std::size_t row) {
+	switch(array.getStorage()) {
+	case ResultBatch::Storage::integer:
+		return static_cast<double>(array.getIntegers()[row]);
+	case ResultBatch::Storage::real:
+		return array.getDoubles()[row];
+	default:
+		break;
+	}
+	return std::strtod(std::string(getStringView(array, row)).c_str(), nullptr);
+}
+
+void appendRow(ResultBatch::Array& to, const ResultBatch::Array& from, std::size_t row) {
+	if(from.isNull(row)) {
+		to.addNull();
+		return;
+	}
+
+	switch(from.getStorage()) {
+	case ResultBatch::Storage::integer:
+		to.addInteger(from.getIntegers()[row]);
+		break;
+	case ResultBatch::Storage::real:
+		to.addDouble(from.getDoubles()[row]);
+		break;
+	case ResultBatch::Storage::string: {
+		std::string_view value = getStringView(from, row);
+		to.addString(value.data(), value.size());
+		break;
+	}
+	}
+}
+
+/* adds the value of "row" to the key of a group */
+void appendKey(std::string& key, const ResultBatch::Array& array, std::size_t row) {
+	if(array.isNull(row)) {
+		key += 'N';
+		return;
+	}
+
+	switch(array.getStorage()) {
+	case ResultBatch::Storage::integer:
+		key += 'I';
+		key.append(reinterpret_cast<const char*>(&array.getIntegers()[row]), sizeof(std::int64_t));
+		break;
+	case ResultBatch::Storage::real:
+		key += 'R';
+		key.append(reinterpret_cast<const char*>(&array.getDoubles()[row]), sizeof(double));
+		break;
+	case ResultBatch::Storage::string: {
+		std::string_view value = getStringView(array, row);
+		std::size_t size = value.size();
+		key += 'S';
+		key.append(reinterpret_cast<const char*>(&size), sizeof(size));
+		key.append(value.data(), value.size());
+		break;
+	}
+	}
+}
+
+/* NULL is less than any other value */
+int compareRows(const ResultBatch::Array& array, std::size_t row1, std::size_t row2) {
+	bool isNull1 = array.isNull(row1);
+	bool isNull2 = array.isNull(row2);
+	if(isNull1 || isNull2) {
+		return isNull1 == isNull2 ? 0 : (isNull1 ? -1 : 1);
+	}
+
+	switch(array.getStorage()) {
+	case ResultBatch::Storage::integer: {
+		std::int64_t value1 = array.getIntegers()[row1];
+		std::int64_t value2 = array.getIntegers()[row2];
+		return value1 < value2 ? -1 : (value2 < value1 ? 1 : 0);
+	}
+	case ResultBatch::Storage::real: {
+		double value1 = array.getDoubles()[row1];
+		double value2 = array.getDoubles()[row2];
+		return value1 < value2 ? -1 : (value2 < value1 ? 1 : 0);
+	}
+	case ResultBatch::Storage::string:
+		break;
+	}
+	return getStringView(array, row1).compare(getStringView(array, row2));
+}
+
+/* state of an aggregate function for one group */
+struct Accumulator {
+	std::int64_t count = 0;
+	std::int64_t integerSum = 0;
+	double doubleSum = 0;
+
+	/* MIN or MAX */
+	std::int64_t integerValue = 0;
+	double doubleValue = 0;
+	std::string stringValue;
+};
+
+template<typename T, typename Update>
+void accumulateValues(std::vector<Accumulator>& accumulators, const ResultBatch::Array& array, const std::vector<std::size_t>& rowGroups, const T* values, Update update) {
+	for(std::size_t row = 0; row < rowGroups.size(); ++row) {
+		if(array.isNull(row)) {
+			continue;
+		}
+		Accumulator& accumulator = accumulators[rowGroups[row]];
+		update(accumulator, values[row], accumulator.count == 0);
+		++accumulator.count;
+	}
+}
+
+template<typename T>
+void accumulateValues(std::vector<Accumulator>& accumulators, Query::Function function, const ResultBatch::Array& array, const std::vector<std::size_t>& rowGroups, const T* values, T Accumulator::*minMax) {
+	switch(function) {
+	case Query::Function::count:
+		accumulateValues(accumulators, array, rowGroups, values, [](Accumulator&, T, bool) { });
+		break;
+	case Query::Function::sum:
+	case Query::Function::avg:
+		accumulateValues(accumulators, array, rowGroups, values, [](Accumulator& accumulator, T value, bool) {
+			if constexpr(std::is_integral<T>::value) {
+				accumulator.integerSum += value;
+			}
+			accumulator.doubleSum += static_cast<double>(value);
+		});
+		break;
+	case Query::Function::min:
+		accumulateValues(accumulators, array, rowGroups, values, [minMax](Accumulator& accumulator, T value, bool isFirst) {
+			if(isFirst || value < accumulator.*minMax) {
+				accumulator.*minMax = value;
+			}
+		});
+		break;
+	case Query::Function::max:
+		accumulateValues(accumulators, array, rowGroups, values, [minMax](Accumulator& accumulator, T value, bool isFirst) {
+			if(isFirst || accumulator.*minMax < value) {
+				accumulator.*minMax = value;
+			}
+		});
+		break;
+	default:
+		break;
+	}
+}
+
+void accumulate(std::vector<Accumulator>& accumulators, Query::Function function, const ResultBatch::Array& array, const std::vector<std::size_t>& rowGroups) {
+	if(function == Query::Function::countAll) {
+		for(auto group : rowGroups) {
+			++accumulators[group].count;
+		}
+		return;
+	}
+
+	switch(array.getStorage()) {
+	case ResultBatch::Storage::integer:
+		accumulateValues(accumulators, function, array, rowGroups, array.getIntegers(), &Accumulator::integerValue);
+		break;
+	case ResultBatch::Storage::real:
+		accumulateValues(accumulators, function, array, rowGroups, array.getDoubles(), &Accumulator::doubleValue);
+		break;
+	case ResultBatch::Storage::string:
+		for(std::size_t row = 0; row < rowGroups.size(); ++row) {
+			if(array.isNull(row)) {
+				continue;
+			}
+			Accumulator& accumulator = accumulators[rowGroups[row]];
+			if(function == Query::Function::sum || function == Query::Function::avg) {
+				accumulator.doubleSum += getDouble(array, row);
+			}
+			else if(function == Query::Function::min || function == Query::Function::max) {
+				std::string_view value = getStringView(array, row);
+				if(accumulator.count == 0 || (function == Query::Function::min ? value < accumulator.stringValue : accumulator.stringValue < value)) {
+					accumulator.stringValue = std::string(value);
+				}
+			}
+			++accumulator.count;
+		}
+		break;
+	}
+}
+
+} /* anonymous namespace */
+
+Plan::Plan(const Query& aQuery, const TablesList& tablesList)
+: query(aQuery)
+{
+	std::string tablesId;
+	for(const auto& entry : tablesList) {
+		if(!query.tablesId.empty() && entry.first != query.tablesId) {
+			continue;
+		}
+
+		std::vector<std::string> tableNames = entry.second->getTableNames();
+		if(std::find(tableNames.begin(), tableNames.end(), query.tableName) == tableNames.end()) {
+			continue;
+		}
+
+		if(tables) {
+	        throw esl::system::Stacktrace::add(std::runtime_error("Table \"" + query.tableName + "\" is ambiguous. It is defined by tables \"" + tablesId + "\" and \"" + entry.first + "\""));
+		}
+		tables = entry.second;
+		tablesId = entry.first;
+	}
+	if(!tables) {
+        throw esl::system::Stacktrace::add(std::runtime_error("Table \"" + (query.tablesId.empty() ? query.tableName : query.tablesId + "." + query.tableName) + "\" is not defined"));
+	}
+	tableColumns = tables->getColumns(query.tableName);
+
+	for(std::size_t i = 0; i < query.parameterCount; ++i) {
+		parameterColumns.emplace_back("", Column::Type::sqlUnknown, true, 0, 0, 0, 0, 0);
+	}
+
+	for(const auto& condition : query.conditions) {
+		conditionColumns.push_back(getTableColumn(condition.columnName));
+	}
+
+	isAggregation = !query.groupBy.empty();
+	std::vector<std::size_t> groupTableColumns;
+	for(const auto& columnName : query.groupBy) {
+		groupTableColumns.push_back(getTableColumn(columnName));
+		groupColumns.push_back(addScanColumn(groupTableColumns.back()));
+	}
+
+	for(const auto& item : query.items) {
+		if(item.function != Query::Function::none) {
+			isAggregation = true;
+		}
+	}
+
+	for(const auto& item : query.items) {
+		Output output;
+		output.function = item.function;
+
+		if(item.function == Query::Function::none && item.columnName == "*") {
+			if(isAggregation) {
+		        throw esl::system::Stacktrace::add(std::runtime_error("\"*\" cannot be selected together with aggregate functions or GROUP BY"));
+			}
+			for(std::size_t i = 0; i < tableColumns.size(); ++i) {
+				output.scanIndex = addScanColumn(i);
+				outputs.push_back(output);
+				resultColumns.push_back(tableColumns[i]);
+			}
+			continue;
+		}
+
+		if(item.function == Query::Function::countAll) {
+			outputs.push_back(output);
+			resultColumns.emplace_back(item.alias.empty() ? std::string("COUNT(*)") : item.alias, Column::Type::sqlInteger, false, 0, 0, 0, 0, 0);
+			continue;
+		}
+
+		std::size_t tableColumn = getTableColumn(item.columnName);
+		const Column& column = tableColumns[tableColumn];
+		output.scanIndex = addScanColumn(tableColumn);
+
+		std::string name = item.alias;
+		Column::Type type = column.getType();
+		bool nullable = true;
+
+		switch(item.function) {
+		case Query::Function::count:
+			name = name.empty() ? "COUNT(" + column.getName() + ")" : name;
+			type = Column::Type::sqlInteger;
+			nullable = false;
+			break;
+		case Query::Function::sum:
+			name = name.empty() ? "SUM(" + column.getName() + ")" : name;
+			output.isIntegerSum = ResultBatch::getStorage(type) == ResultBatch::Storage::integer;
+			type = output.isIntegerSum ? Column::Type::sqlInteger : Column::Type::sqlDouble;
+			break;
+		case Query::Function::avg:
+			name = name.empty() ? "AVG(" + column.getName() + ")" : name;
+			type = Column::Type::sqlDouble;
+			break;
+		case Query::Function::min:
+			name = name.empty() ? "MIN(" + column.getName() + ")" : name;
+			break;
+		case Query::Function::max:
+			name = name.empty() ? "MAX(" + column.getName() + ")" : name;
+			break;
+		default:
+			if(isAggregation && std::find(groupTableColumns.begin(), groupTableColumns.end(), tableColumn) == groupTableColumns.end()) {
+		        throw esl::system::Stacktrace::add(std::runtime_error("Column \"" + item.columnName + "\" must be used in GROUP BY or in an aggregate function"));
+			}
+			name = name.empty() ? column.getName() : name;
+			nullable = column.isNullable();
+			break;
+		}
+
+		outputs.push_back(output);
+		resultColumns.emplace_back(name, type, nullable, 0, 0, 0, 0, 0);
+	}
+
+	/* a scan without columns cannot tell the number of rows in its batches */
+	if(scanColumns.empty() && !tableColumns.empty()) {
+		addScanColumn(0);
+	}
+
+	for(const auto& order : query.orderBy) {
+		Order resultOrder;
+		resultOrder.descending = order.descending;
+
+		if(order.columnName.empty()) {
+			if(order.position > resultColumns.size()) {
+		        throw esl::system::Stacktrace::add(std::runtime_error("ORDER BY position " + std::to_string(order.position) + " is out of range. Result has " + std::to_string(resultColumns.size()) + " columns."));
+			}
+			resultOrder.resultIndex = order.position - 1;
+		}
+		else {
+			auto iter = std::find_if(resultColumns.begin(), resultColumns.end(), [&order](const Column& column) {
+				return equalsIgnoreCase(column.getName(), order.columnName);
+			});
+			if(iter == resultColumns.end()) {
+		        throw esl::system::Stacktrace::add(std::runtime_error("ORDER BY column \"" + order.columnName + "\" is not a result column"));
+			}
+			resultOrder.resultIndex = static_cast<std::size_t>(iter - resultColumns.begin());
+		}
+
+		orders.push_back(resultOrder);
+	}
+}
+
+const std::vector<esl::database::Column>& Plan::getParameterColumns() const {
+	return parameterColumns;
+}
+
+const std::vector<esl::database::Column>& Plan::getResultColumns() const {
+	return resultColumns;
+}
+
+void Plan::execute(const std::vector<esl::database::Field>& parameters, esl::database::ResultBatch& result, std::vector<std::size_t>& rowOrder) const {
+	if(parameters.size() != parameterColumns.size()) {
+	    throw esl::system::Stacktrace::add(std::runtime_error("Wrong number of arguments. Given " + std::to_string(parameters.size()) + " parameters but required " + std::to_string(parameterColumns.size()) + " parameters."));
+	}
+
+	std::vector<esl::database::table::Tables::Predicate> predicates(query.conditions.size());
+	for(std::size_t i = 0; i < query.conditions.size(); ++i) {
+		const Query::Condition& condition = query.conditions[i];
+		predicates[i].columnIndex = conditionColumns[i];
+		predicates[i].op = condition.op;
+		predicates[i].value = condition.isParameter ? parameters[condition.parameterIndex] : condition.value;
+	}
+
+	std::unique_ptr<esl::database::table::Tables::Scan> scan = tables->scan(query.tableName, scanColumns, predicates);
+
+	result.reset(resultColumns.size());
+	for(std::size_t i = 0; i < resultColumns.size(); ++i) {
+		result[i].setStorage(ResultBatch::getStorage(resultColumns[i].getType()));
+	}
+
+	if(isAggregation) {
+		executeAggregation(*scan, result);
+	}
+	else {
+		executeProjection(*scan, result);
+	}
+
+	rowOrder.resize(result.getRowCount());
+	std::iota(rowOrder.begin(), rowOrder.end(), 0);
+
+	if(!orders.empty()) {
+		sort(result, rowOrder);
+	}
+
+	if(query.hasLimit && rowOrder.size() > query.limit) {
+		rowOrder.resize(query.limit);
+	}
+}
+
+std::size_t Plan::getTableColumn(const std::string& columnName) const {
+	for(std::size_t i = 0; i < tableColumns.size(); ++i) {
+		if(equalsIgnoreCase(tableColumns[i].getName(), columnName)) {
+			return i;
+		}
+	}
+    throw esl::system::Stacktrace::add(std::runtime_error("Column \"" + columnName + "\" is not defined in table \"" + query.tableName + "\""));
+}
+
+std::size_t Plan::addScanColumn(std::size_t tableColumn) {
+	auto iter = std::find(scanColumns.begin(), scanColumns.end(), tableColumn);
+	if(iter != scanColumns.end()) {
+		return static_cast<std::size_t>(iter - scanColumns.begin());
+	}
+	scanColumns.push_back(tableColumn);
+	return scanColumns.size() - 1;
+}
+
+void Plan::executeProjection(esl::database::table::Tables::Scan& scan, esl::database::ResultBatch& result) const {
+	/* without ORDER BY the scan can stop as soon as there are enough rows */
+	bool canStop = query.hasLimit && orders.empty();
+
+	ResultBatch batch;
+	while(!(canStop && result.getRowCount() >= query.limit)) {
+		std::size_t rowCount = scan.fetchBatch(batch, batchSize);
+		if(rowCount == 0) {
+			break;
+		}
+
+		for(std::size_t i = 0; i < outputs.size(); ++i) {
+			const ResultBatch::Array& array = batch[outputs[i].scanIndex];
+			for(std::size_t row = 0; row < rowCount; ++row) {
+				appendRow(result[i], array, row);
+			}
+		}
+	}
+}
+
+void Plan::executeAggregation(esl::database::table::Tables::Scan& scan, esl::database::ResultBatch& result) const {
+	/* values of the GROUP BY columns for each group */
+	ResultBatch groupValues;
+	groupValues.reset(groupColumns.size());
+
+	std::unordered_map<std::string, std::size_t> groupIds;
+	std::size_t groupCount = groupColumns.empty() ? 1 : 0;
+	std::vector<std::vector<Accumulator>> accumulators(outputs.size(), std::vector<Accumulator>(groupCount));
+
+	/* storage of the values of MIN and MAX */
+	std::vector<ResultBatch::Storage> storages;
+	for(std::size_t i = 0; i < outputs.size(); ++i) {
+		storages.push_back(result[i].getStorage());
+	}
+
+	ResultBatch batch;
+	std::vector<std::size_t> rowGroups;
+	std::string key;
+	while(true) {
+		std::size_t rowCount = scan.fetchBatch(batch, batchSize);
+		if(rowCount == 0) {
+			break;
+		}
+
+		rowGroups.assign(rowCount, 0);
+		if(!groupColumns.empty()) {
+			for(std::size_t row = 0; row < rowCount; ++row) {
+				key.clear();
+				for(auto groupColumn : groupColumns) {
+					appendKey(key, batch[groupColumn], row);
+				}
+
+				auto iter = groupIds.find(key);
+				if(iter == groupIds.end()) {
+					iter = groupIds.emplace(key, groupCount++).first;
+					for(std::size_t i = 0; i < groupColumns.size(); ++i) {
+						if(groupValues[i].size() == 0) {
+							groupValues[i].setStorage(batch[groupColumns[i]].getStorage());
+						}
+						appendRow(groupValues[i], batch[groupColumns[i]], row);
+					}
+					for(auto& outputAccumulators : accumulators) {
+						outputAccumulators.resize(groupCount);
+					}
+				}
+				rowGroups[row] = iter->second;
+			}
+		}
+
+		for(std::size_t i = 0; i < outputs.size(); ++i) {
+			if(outputs[i].function != Query::Function::none) {
+				accumulate(accumulators[i], outputs[i].function, batch[outputs[i].scanIndex], rowGroups);
+				storages[i] = batch[outputs[i].scanIndex].getStorage();
+			}
+		}
+	}
+
+	for(std::size_t i = 0; i < outputs.size(); ++i) {
+		ResultBatch::Array& array = result[i];
+		std::size_t groupIndex = 0;
+		if(outputs[i].function == Query::Function::none) {
+			groupIndex = static_cast<std::size_t>(std::find(groupColumns.begin(), groupColumns.end(), outputs[i].scanIndex) - groupColumns.begin());
+		}
+
+		for(std::size_t group = 0; group < groupCount; ++group) {
+			const Accumulator& accumulator = accumulators[i][group];
+
+			switch(outputs[i].function) {
+			case Query::Function::none:
+				appendRow(array, groupValues[groupIndex], group);
+				break;
+			case Query::Function::countAll:
+			case Query::Function::count:
+				array.addInteger(accumulator.count);
+				break;
+			case Query::Function::sum:
+				if(accumulator.count == 0) {
+					array.addNull();
+				}
+				else if(outputs[i].isIntegerSum) {
+					array.addInteger(accumulator.integerSum);
+				}
+				else {
+					array.addDouble(accumulator.doubleSum);
+				}
+				break;
+			case Query::Function::avg:
+				if(accumulator.count == 0) {
+					array.addNull();
+				}
+				else {
+					array.addDouble(accumulator.doubleSum / static_cast<double>(accumulator.count));
+				}
+				break;
+			case Query::Function::min:
+			case Query::Function::max:
+				if(accumulator.count == 0) {
+					array.addNull();
+				}
+				else {
+					switch(storages[i]) {
+					case ResultBatch::Storage::integer:
+						array.addInteger(accumulator.integerValue);
+						break;
+					case ResultBatch::Storage::real:
+						array.addDouble(accumulator.doubleValue);
+						break;
+					case ResultBatch::Storage::string:
+						array.addString(accumulator.stringValue.data(), accumulator.stringValue.size());
+						break;
+					}
+				}
+				break;
+			}
+		}
+	}
+}
+
+void Plan::sort(const esl::database::ResultBatch& result, std::vector<std::size_t>& rowOrder) const {
+	std::stable_sort(rowOrder.begin(), rowOrder.end(), [this, &result](std::size_t row1, std::size_t row2) {
+		for(const auto& order : orders) {
+			int rc = compareRows(result[order.resultIndex], row1, row2);
+			if(rc != 0) {
+				return order.descending ? rc > 0 : rc < 0;
+			}
+		}
+		return false;
+	});
+}
+
+} /* namespace sql */
+} /* namespace database */
+} /* inline namespace v1_6 */
+} /* namespace common4esl */
@@ -0,0 +1,110 @@
+/*
+MIT License
+Copyright (c) 2019-2025 Sven Lukas
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef COMMON4ESL_DATABASE_SQL_PLAN_H_
+#define COMMON4ESL_DATABASE_SQL_PLAN_H_
+
+#include <common4esl/database/sql/Query.h>
+
+#include <esl/database/Column.h>
+#include <esl/database/Field.h>
+#include <esl/database/ResultBatch.h>
+#include <esl/database/table/Tables.h>
+
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace common4esl {
+inline namespace v1_6 {
+namespace database {
+namespace sql {
+
+/* Plan is a query that has been resolved against the columns of its table.
+ * All conditions are pushed down into the scan of the table. Rows are processed batch by batch and column by column. */
+class Plan {
+public:
+	using TablesList = std::vector<std::pair<std::string, std::shared_ptr<const esl::database::table::Tables>>>;
+
+	Plan(const Query& query, const TablesList& tablesList);
+
+	const std::vector<esl::database::Column>& getParameterColumns() const;
+	const std::vector<esl::database::Column>& getResultColumns() const;
+
+	/* stores all rows of the result in "result". rowOrder contains the rows of the result in the order to return. */
+	void execute(const std::vector<esl::database::Field>& parameters, esl::database::ResultBatch& result, std::vector<std::size_t>& rowOrder) const;
+
+private:
+	/* source of a result column */
+	struct Output {
+		Query::Function function = Query::Function::none;
+
+		/* index of the column in a batch of the scan, not used by countAll */
+		std::size_t scanIndex = 0;
+
+		/* true if SUM adds integers */
+		bool isIntegerSum = false;
+	};
+
+	/* result column index and direction */
+	struct Order {
+		std::size_t resultIndex = 0;
+		bool descending = false;
+	};
+
+	Query query;
+	std::shared_ptr<const esl::database::table::Tables> tables;
+	std::vector<esl::database::Column> tableColumns;
+
+	std::vector<esl::database::Column> parameterColumns;
+	std::vector<esl::database::Column> resultColumns;
+
+	/* table columns that are read by the scan */
+	std::vector<std::size_t> scanColumns;
+
+	/* table column index of each condition */
+	std::vector<std::size_t> conditionColumns;
+
+	std::vector<Output> outputs;
+	bool isAggregation = false;
+
+	/* scan indexes of the GROUP BY columns */
+	std::vector<std::size_t> groupColumns;
+
+	std::vector<Order> orders;
+
+	std::size_t getTableColumn(const std::string& columnName) const;
+	std::size_t addScanColumn(std::size_t tableColumn);
+
+	void executeProjection(esl::database::table::Tables::Scan& scan, esl::database::ResultBatch& result) const;
+	void executeAggregation(esl::database::table::Tables::Scan& scan, esl::database::ResultBatch& result) const;
+	void sort(const esl::database::ResultBatch& result, std::vector<std::size_t>& rowOrder) const;
+};
+
+} /* namespace sql */
+} /* namespace database */
+} /* inline namespace v1_6 */
+} /* namespace common4esl */
+
+#endif /* COMMON4ESL_DATABASE_SQL_PLAN_H_ */
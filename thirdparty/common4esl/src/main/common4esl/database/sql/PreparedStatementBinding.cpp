@@ -0,0 +1,67 @@
+/*
+MIT License
+Copyright (c) 2019-2025 Sven Lukas
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <common4esl/database/sql/PreparedStatementBinding.h>
+#include <common4esl/database/sql/ResultSetBinding.h>
+
+#include <esl/database/ResultBatch.h>
+
+#include <memory>
+#include <utility>
+
+namespace common4esl {
+inline namespace v1_6 {
+namespace database {
+namespace sql {
+
+PreparedStatementBinding::PreparedStatementBinding(Plan&& aPlan)
+: plan(std::move(aPlan))
+{ }
+
+const std::vector<esl::database::Column>& PreparedStatementBinding::getParameterColumns() const {
+	return plan.getParameterColumns();
+}
+
+const std::vector<esl::database::Column>& PreparedStatementBinding::getResultColumns() const {
+	return plan.getResultColumns();
+}
+
+esl::database::ResultSet PreparedStatementBinding::execute(const std::vector<esl::database::Field>& fields) {
+	esl::database::ResultBatch result;
+	std::vector<std::size_t> rowOrder;
+	plan.execute(fields, result, rowOrder);
+
+	if(rowOrder.empty()) {
+		return esl::database::ResultSet();
+	}
+
+	return esl::database::ResultSet(std::unique_ptr<esl::database::ResultSet::Binding>(new ResultSetBinding(plan.getResultColumns(), std::move(result), std::move(rowOrder))));
+}
+
+void* PreparedStatementBinding::getNativeHandle() const {
+	return nullptr;
+}
+
+} /* namespace sql */
+} /* namespace database */
+} /* inline namespace v1_6 */
+} /* namespace common4esl */
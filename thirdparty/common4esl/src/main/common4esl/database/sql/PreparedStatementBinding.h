@@ -0,0 +1,59 @@
+/*
+MIT License
+Copyright (c) 2019-2025 Sven Lukas
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef COMMON4ESL_DATABASE_SQL_PREPAREDSTATEMENTBINDING_H_
+#define COMMON4ESL_DATABASE_SQL_PREPAREDSTATEMENTBINDING_H_
+
+#include <common4esl/database/sql/Plan.h>
+
+#include <esl/database/Column.h>
+#include <esl/database/Field.h>
+#include <esl/database/PreparedStatement.h>
+#include <esl/database/ResultSet.h>
+
+#include <vector>
+
+namespace common4esl {
+inline namespace v1_6 {
+namespace database {
+namespace sql {
+
+class PreparedStatementBinding : public esl::database::PreparedStatement::Binding {
+public:
+	PreparedStatementBinding(Plan&& plan);
+
+	const std::vector<esl::database::Column>& getParameterColumns() const override;
+	const std::vector<esl::database::Column>& getResultColumns() const override;
+	esl::database::ResultSet execute(const std::vector<esl::database::Field>& fields) override;
+
+	void* getNativeHandle() const override;
+
+private:
+	Plan plan;
+};
+
+} /* namespace sql */
+} /* namespace database */
+} /* inline namespace v1_6 */
+} /* namespace common4esl */
+
+#endif /* COMMON4ESL_DATABASE_SQL_PREPAREDSTATEMENTBINDING_H_ */
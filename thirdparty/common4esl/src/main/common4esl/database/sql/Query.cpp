@@ -0,0 +1,458 @@
+/*
+MIT License
+Copyright (c) 2019-2025 Sven Lukas
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <common4esl/database/sql/Query.h>
+
+#include <esl/system/Stacktrace.h>
+
+#include <cctype>
+#include <cstdint>
+#include <cstdlib>
+#include <initializer_list>
+#include <stdexcept>
+
+namespace common4esl {
+inline namespace v1_6 {
+namespace database {
+namespace sql {
+
+namespace {
+
+using Operator = esl::database::table::Tables::Predicate::Operator;
+
+struct Token {
+	enum class Type {
+		identifier,
+		integer,
+		real,
+		string,
+		symbol,
+		end
+	};
+
+	Type type = Type::end;
+	std::string value;
+};
+
+class Parser {
+public:
+	Parser(const std::string& aSql)
+	: sql(aSql)
+	{
+		tokenize();
+	}
+
+	Query parse() {
+		Query query;
+
+		expectKeyword("SELECT");
+		do {
+			query.items.push_back(parseItem());
+		} while(acceptSymbol(","));
+
+		expectKeyword("FROM");
+		query.tableName = expectIdentifier();
+		if(acceptSymbol(".")) {
+			query.tablesId = query.tableName;
+			query.tableName = expectIdentifier();
+		}
+
+		/* a query reads a single table */
+		if(isJoin(peek()) || (peek().type == Token::Type::symbol && peek().value == ",")) {
+			throw esl::system::Stacktrace::add(error("JOIN is not supported, a query reads a single table"));
+		}
+
+		if(acceptKeyword("WHERE")) {
+			do {
+				query.conditions.push_back(parseCondition(query));
+			} while(acceptKeyword("AND"));
+		}
+
+		if(acceptKeyword("GROUP")) {
+			expectKeyword("BY");
+			do {
+				query.groupBy.push_back(expectIdentifier());
+			} while(acceptSymbol(","));
+		}
+
+		if(acceptKeyword("ORDER")) {
+			expectKeyword("BY");
+			do {
+				Query::Order order;
+				if(peek().type == Token::Type::integer) {
+					std::int64_t position = toInteger(next());
+					if(position < 1) {
+						throw esl::system::Stacktrace::add(error("ORDER BY position starts at 1"));
+					}
+					order.position = static_cast<std::size_t>(position);
+				}
+				else {
+					order.columnName = expectIdentifier();
+				}
+				if(acceptKeyword("DESC")) {
+					order.descending = true;
+				}
+				else {
+					acceptKeyword("ASC");
+				}
+				query.orderBy.push_back(order);
+			} while(acceptSymbol(","));
+		}
+
+		if(acceptKeyword("LIMIT")) {
+			if(peek().type != Token::Type::integer) {
+				throw esl::system::Stacktrace::add(error("LIMIT requires a number"));
+			}
+			std::int64_t limit = toInteger(next());
+			if(limit < 0) {
+				throw esl::system::Stacktrace::add(error("LIMIT must not be negative"));
+			}
+			query.hasLimit = true;
+			query.limit = static_cast<std::size_t>(limit);
+		}
+
+		acceptSymbol(";");
+		if(peek().type != Token::Type::end) {
+			throw esl::system::Stacktrace::add(error("unexpected \"" + peek().value + "\""));
+		}
+
+		return query;
+	}
+
+private:
+	const std::string& sql;
+	std::vector<Token> tokens;
+	std::size_t position = 0;
+
+	std::runtime_error error(const std::string& message) const {
+		return std::runtime_error("Cannot parse SQL statement \"" + sql + "\": " + message);
+	}
+
+	void tokenize() {
+		std::size_t i = 0;
+		while(i < sql.size()) {
+			char c = sql[i];
+			if(std::isspace(static_cast<unsigned char>(c))) {
+				++i;
+			}
+			else if(std::isalpha(static_cast<unsigned char>(c)) || c == '_') {
+				std::size_t begin = i;
+				while(i < sql.size() && (std::isalnum(static_cast<unsigned char>(sql[i])) || sql[i] == '_')) {
+					++i;
+				}
+				tokens.push_back(Token{Token::Type::identifier, sql.substr(begin, i - begin)});
+			}
+			else if(std::isdigit(static_cast<unsigned char>(c)) || (c == '-' && i + 1 < sql.size() && std::isdigit(static_cast<unsigned char>(sql[i+1])))) {
+				std::size_t begin = i++;
+				bool isReal = false;
+				skipDigits(i);
+				if(i < sql.size() && sql[i] == '.') {
+					isReal = true;
+					skipDigits(++i);
+				}
+				/* exponent with optional sign, e.g. 1e-1 */
+				if(i < sql.size() && (sql[i] == 'e' || sql[i] == 'E')) {
+					std::size_t exponent = i + 1;
+					if(exponent < sql.size() && (sql[exponent] == '+' || sql[exponent] == '-')) {
+						++exponent;
+					}
+					if(exponent < sql.size() && std::isdigit(static_cast<unsigned char>(sql[exponent]))) {
+						isReal = true;
+						i = exponent;
+						skipDigits(i);
+					}
+				}
+				tokens.push_back(Token{isReal ? Token::Type::real : Token::Type::integer, sql.substr(begin, i - begin)});
+			}
+			else if(c == '\'' || c == '"') {
+				/* '...' is a string, "..." a quoted identifier. The quote character is escaped by doubling it. */
+				std::string value;
+				for(++i; ; ++i) {
+					if(i >= sql.size()) {
+						throw esl::system::Stacktrace::add(error("missing closing quote"));
+					}
+					if(sql[i] == c) {
+						if(i + 1 < sql.size() && sql[i+1] == c) {
+							++i;
+						}
+						else {
+							break;
+						}
+					}
+					value += sql[i];
+				}
+				++i;
+				tokens.push_back(Token{c == '\'' ? Token::Type::string : Token::Type::identifier, value});
+			}
+			else if((c == '<' || c == '>' || c == '!') && i + 1 < sql.size() && (sql[i+1] == '=' || (c == '<' && sql[i+1] == '>'))) {
+				tokens.push_back(Token{Token::Type::symbol, sql.substr(i, 2)});
+				i += 2;
+			}
+			else if(std::string("*,().=<>?;").find(c) != std::string::npos) {
+				tokens.push_back(Token{Token::Type::symbol, std::string(1, c)});
+				++i;
+			}
+			else {
+				throw esl::system::Stacktrace::add(error(std::string("unexpected character '") + c + "'"));
+			}
+		}
+		tokens.push_back(Token());
+	}
+
+	void skipDigits(std::size_t& i) const {
+		while(i < sql.size() && std::isdigit(static_cast<unsigned char>(sql[i]))) {
+			++i;
+		}
+	}
+
+	std::int64_t toInteger(const Token& token) const {
+		try {
+			return static_cast<std::int64_t>(std::stoll(token.value));
+		}
+		catch(const std::out_of_range&) {
+			throw esl::system::Stacktrace::add(error("number " + token.value + " is out of range"));
+		}
+	}
+
+	double toReal(const Token& token) const {
+		try {
+			return std::stod(token.value);
+		}
+		catch(const std::out_of_range&) {
+			throw esl::system::Stacktrace::add(error("number " + token.value + " is out of range"));
+		}
+	}
+
+	const Token& peek() const {
+		return tokens[position];
+	}
+
+	const Token& next() {
+		const Token& token = tokens[position];
+		if(token.type != Token::Type::end) {
+			++position;
+		}
+		return token;
+	}
+
+	static bool isKeyword(const Token& token, const char* keyword) {
+		if(token.type != Token::Type::identifier) {
+			return false;
+		}
+		std::size_t i = 0;
+		for(; i < token.value.size() && keyword[i] != 0; ++i) {
+			if(std::toupper(static_cast<unsigned char>(token.value[i])) != keyword[i]) {
+				return false;
+			}
+		}
+		return i == token.value.size() && keyword[i] == 0;
+	}
+
+	static bool isJoin(const Token& token) {
+		for(const char* keyword : {"JOIN", "INNER", "LEFT", "RIGHT", "FULL", "CROSS", "NATURAL"}) {
+			if(isKeyword(token, keyword)) {
+				return true;
+			}
+		}
+		return false;
+	}
+
+	bool acceptKeyword(const char* keyword) {
+		if(isKeyword(peek(), keyword)) {
+			++position;
+			return true;
+		}
+		return false;
+	}
+
+	void expectKeyword(const char* keyword) {
+		if(!acceptKeyword(keyword)) {
+			throw esl::system::Stacktrace::add(error(std::string("expected ") + keyword + " instead of \"" + peek().value + "\""));
+		}
+	}
+
+	bool acceptSymbol(const char* symbol) {
+		if(peek().type == Token::Type::symbol && peek().value == symbol) {
+			++position;
+			return true;
+		}
+		return false;
+	}
+
+	void expectSymbol(const char* symbol) {
+		if(!acceptSymbol(symbol)) {
+			throw esl::system::Stacktrace::add(error(std::string("expected \"") + symbol + "\" instead of \"" + peek().value + "\""));
+		}
+	}
+
+	std::string expectIdentifier() {
+		if(peek().type != Token::Type::identifier) {
+			throw esl::system::Stacktrace::add(error("expected identifier instead of \"" + peek().value + "\""));
+		}
+		return next().value;
+	}
+
+	Query::Item parseItem() {
+		Query::Item item;
+
+		if(acceptSymbol("*")) {
+			item.columnName = "*";
+			return item;
+		}
+
+		static const std::pair<const char*, Query::Function> functions[] = {
+				{"COUNT", Query::Function::count},
+				{"SUM", Query::Function::sum},
+				{"AVG", Query::Function::avg},
+				{"MIN", Query::Function::min},
+				{"MAX", Query::Function::max}
+		};
+		for(const auto& function : functions) {
+			if(isKeyword(peek(), function.first) && tokens[position+1].type == Token::Type::symbol && tokens[position+1].value == "(") {
+				position += 2;
+				item.function = function.second;
+				if(item.function == Query::Function::count && acceptSymbol("*")) {
+					item.function = Query::Function::countAll;
+				}
+				else {
+					item.columnName = expectIdentifier();
+				}
+				expectSymbol(")");
+				break;
+			}
+		}
+
+		if(item.function == Query::Function::none) {
+			item.columnName = expectIdentifier();
+		}
+
+		if(acceptKeyword("AS")) {
+			item.alias = expectIdentifier();
+		}
+		else if(peek().type == Token::Type::identifier && !isKeyword(peek(), "FROM")) {
+			item.alias = next().value;
+		}
+
+		return item;
+	}
+
+	Query::Condition parseCondition(Query& query) {
+		Query::Condition condition;
+
+		if(peek().type != Token::Type::identifier) {
+			/* "value op column" is stored as "column op' value" */
+			parseValue(query, condition);
+			Operator op = parseOperator();
+			condition.columnName = expectIdentifier();
+			switch(op) {
+			case Operator::less:
+				condition.op = Operator::greater;
+				break;
+			case Operator::lessEqual:
+				condition.op = Operator::greaterEqual;
+				break;
+			case Operator::greater:
+				condition.op = Operator::less;
+				break;
+			case Operator::greaterEqual:
+				condition.op = Operator::lessEqual;
+				break;
+			default:
+				condition.op = op;
+				break;
+			}
+			return condition;
+		}
+
+		condition.columnName = expectIdentifier();
+		if(acceptKeyword("IS")) {
+			condition.op = acceptKeyword("NOT") ? Operator::isNotNull : Operator::isNull;
+			expectKeyword("NULL");
+			return condition;
+		}
+
+		condition.op = parseOperator();
+		parseValue(query, condition);
+		return condition;
+	}
+
+	Operator parseOperator() {
+		const Token& token = next();
+		if(token.type == Token::Type::symbol) {
+			if(token.value == "=") {
+				return Operator::equal;
+			}
+			if(token.value == "<>" || token.value == "!=") {
+				return Operator::notEqual;
+			}
+			if(token.value == "<") {
+				return Operator::less;
+			}
+			if(token.value == "<=") {
+				return Operator::lessEqual;
+			}
+			if(token.value == ">") {
+				return Operator::greater;
+			}
+			if(token.value == ">=") {
+				return Operator::greaterEqual;
+			}
+		}
+		throw esl::system::Stacktrace::add(error("expected comparison operator instead of \"" + token.value + "\""));
+	}
+
+	void parseValue(Query& query, Query::Condition& condition) {
+		const Token& token = next();
+		switch(token.type) {
+		case Token::Type::integer:
+			condition.value = toInteger(token);
+			return;
+		case Token::Type::real:
+			condition.value = toReal(token);
+			return;
+		case Token::Type::string:
+			condition.value = token.value;
+			return;
+		case Token::Type::symbol:
+			if(token.value == "?") {
+				condition.isParameter = true;
+				condition.parameterIndex = query.parameterCount++;
+				return;
+			}
+			break;
+		default:
+			break;
+		}
+		throw esl::system::Stacktrace::add(error("expected value instead of \"" + token.value + "\""));
+	}
+};
+
+} /* anonymous namespace */
+
+Query Query::parse(const std::string& sql) {
+	return Parser(sql).parse();
+}
+
+} /* namespace sql */
+} /* namespace database */
+} /* inline namespace v1_6 */
+} /* namespace common4esl */
@@ -0,0 +1,101 @@
+/*
+MIT License
+Copyright (c) 2019-2025 Sven Lukas
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef COMMON4ESL_DATABASE_SQL_QUERY_H_
+#define COMMON4ESL_DATABASE_SQL_QUERY_H_
+
+#include <esl/database/Field.h>
+#include <esl/database/table/Tables.h>
+
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace common4esl {
+inline namespace v1_6 {
+namespace database {
+namespace sql {
+
+/* SELECT statement that is supported by Engine:
+ *   SELECT item, ... FROM [id.]table [WHERE condition AND ...] [GROUP BY column, ...] [ORDER BY column|position [ASC|DESC], ...] [LIMIT count]
+ * An item is "*", a column or COUNT(*), COUNT, SUM, AVG, MIN, MAX of a column, optionally followed by [AS] alias.
+ * A condition compares a column with a number, a string or a parameter "?", or it is "column IS [NOT] NULL". */
+struct Query {
+	enum class Function {
+		none,
+		countAll,
+		count,
+		sum,
+		avg,
+		min,
+		max
+	};
+
+	struct Item {
+		Function function = Function::none;
+
+		/* "*" selects all columns */
+		std::string columnName;
+		std::string alias;
+	};
+
+	struct Condition {
+		std::string columnName;
+		esl::database::table::Tables::Predicate::Operator op = esl::database::table::Tables::Predicate::Operator::equal;
+
+		/* value is used if the condition has no parameter */
+		esl::database::Field value;
+		bool isParameter = false;
+		std::size_t parameterIndex = 0;
+	};
+
+	struct Order {
+		/* name of a result column, or position of a result column starting at 1 if columnName is empty */
+		std::string columnName;
+		std::size_t position = 0;
+		bool descending = false;
+	};
+
+	static Query parse(const std::string& sql);
+
+	std::vector<Item> items;
+
+	/* id of the tables as given to Engine::addTables, empty if the table name is not qualified */
+	std::string tablesId;
+	std::string tableName;
+
+	std::vector<Condition> conditions;
+	std::vector<std::string> groupBy;
+	std::vector<Order> orderBy;
+
+	bool hasLimit = false;
+	std::size_t limit = 0;
+
+	std::size_t parameterCount = 0;
+};
+
+} /* namespace sql */
+} /* namespace database */
+} /* inline namespace v1_6 */
+} /* namespace common4esl */
+
+#endif /* COMMON4ESL_DATABASE_SQL_QUERY_H_ */
@@ -0,0 +1,98 @@
+/*
+MIT License
+Copyright (c) 2019-2025 Sven Lukas
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <common4esl/database/sql/ResultSetBinding.h>
+
+#include <esl/system/Stacktrace.h>
+
+#include <stdexcept>
+#include <string_view>
+#include <utility>
+
+namespace common4esl {
+inline namespace v1_6 {
+namespace database {
+namespace sql {
+
+ResultSetBinding::ResultSetBinding(const std::vector<esl::database::Column>& resultColumns, esl::database::ResultBatch&& aResult, std::vector<std::size_t>&& aRowOrder)
+: esl::database::ResultSet::Binding(resultColumns),
+  result(std::move(aResult)),
+  rowOrder(std::move(aRowOrder))
+{ }
+
+bool ResultSetBinding::fetch(std::vector<esl::database::Field>& fields) {
+	if(fields.size() != getColumns().size()) {
+        throw esl::system::Stacktrace::add(std::runtime_error("Called 'fetch' with wrong number of fields. Given " + std::to_string(fields.size()) + " fields, but it should be " + std::to_string(getColumns().size()) + " fields."));
+	}
+
+	if(position >= rowOrder.size()) {
+		return false;
+	}
+	std::size_t row = rowOrder[position++];
+
+	for(std::size_t i = 0; i < fields.size(); ++i) {
+		const esl::database::ResultBatch::Array& array = result[i];
+		if(array.isNull(row)) {
+			fields[i] = nullptr;
+			continue;
+		}
+
+		switch(array.getStorage()) {
+		case esl::database::ResultBatch::Storage::integer:
+			fields[i] = array.getIntegers()[row];
+			break;
+		case esl::database::ResultBatch::Storage::real:
+			fields[i] = array.getDoubles()[row];
+			break;
+		case esl::database::ResultBatch::Storage::string: {
+			const std::size_t* offsets = array.getStringOffsets();
+			std::string_view value(array.getStringData() + offsets[row], offsets[row+1] - offsets[row]);
+			if(fields[i].getSimpleType() == esl::database::Field::Type::storageString) {
+				fields[i].setView(value);
+			}
+			else {
+				fields[i] = value;
+			}
+			break;
+		}
+		}
+	}
+
+	return true;
+}
+
+bool ResultSetBinding::isEditable(std::size_t) {
+	return false;
+}
+
+void ResultSetBinding::add(std::vector<esl::database::Field>&) {
+    throw esl::system::Stacktrace::add(std::runtime_error("Cannot add a row, because the result set of the SQL engine is read only"));
+}
+
+void ResultSetBinding::save(std::vector<esl::database::Field>&) {
+    throw esl::system::Stacktrace::add(std::runtime_error("Cannot save a row, because the result set of the SQL engine is read only"));
+}
+
+} /* namespace sql */
+} /* namespace database */
+} /* inline namespace v1_6 */
+} /* namespace common4esl */
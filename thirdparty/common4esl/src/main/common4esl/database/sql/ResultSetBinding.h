@@ -0,0 +1,60 @@
+/*
+MIT License
+Copyright (c) 2019-2025 Sven Lukas
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef COMMON4ESL_DATABASE_SQL_RESULTSETBINDING_H_
+#define COMMON4ESL_DATABASE_SQL_RESULTSETBINDING_H_
+
+#include <esl/database/Column.h>
+#include <esl/database/Field.h>
+#include <esl/database/ResultBatch.h>
+#include <esl/database/ResultSet.h>
+
+#include <cstddef>
+#include <vector>
+
+namespace common4esl {
+inline namespace v1_6 {
+namespace database {
+namespace sql {
+
+/* returns the rows of a result in the order given by rowOrder. String fields refer to the result without a copy. */
+class ResultSetBinding : public esl::database::ResultSet::Binding {
+public:
+	ResultSetBinding(const std::vector<esl::database::Column>& resultColumns, esl::database::ResultBatch&& result, std::vector<std::size_t>&& rowOrder);
+
+	bool fetch(std::vector<esl::database::Field>& fields) override;
+	bool isEditable(std::size_t columnIndex) override;
+	void add(std::vector<esl::database::Field>& fields) override;
+	void save(std::vector<esl::database::Field>& fields) override;
+
+private:
+	esl::database::ResultBatch result;
+	std::vector<std::size_t> rowOrder;
+	std::size_t position = 0;
+};
+
+} /* namespace sql */
+} /* namespace database */
+} /* inline namespace v1_6 */
+} /* namespace common4esl */
+
+#endif /* COMMON4ESL_DATABASE_SQL_RESULTSETBINDING_H_ */
@@ -7,6 +7,8 @@
 #include <esl/system/Stacktrace.h>
 
 #include <chrono>
+#include <cstdint>
+#include <cstring>
 #include <ctime>
 #include <functional>
 #include <stdexcept>
@@ -17,32 +19,72 @@ inline namespace v1_6 {
 namespace monitoring {
 
 namespace {
+constexpr std::size_t timestampSize = 22;
+constexpr std::size_t levelSize = 8;
+constexpr std::size_t typeNameSize = 20;
+constexpr std::size_t threadNoSize = 3;
+constexpr std::size_t addressSize = 18;
+constexpr std::size_t functionSize = 20;
+constexpr std::size_t fileSize = 20;
+constexpr std::size_t lineNoSize = 6;
 
-std::string formatStrToSize(std::string str, bool spacesAtLeftSide = false, const std::size_t strSize = 50) {
-	if(str.size() > strSize) {
-		str = "..." + str.substr(str.size()+3-strSize);
-	}
+/* written after "-" instead of the thread number if there is no logging */
+constexpr const char unknownThreadNo[] = " (thread?)";
+constexpr std::size_t unknownThreadNoSize = sizeof(unknownThreadNo) - 1;
 
-	if(spacesAtLeftSide) {
-		while(str.size() < strSize) {
-			str = " " + str;
-		}
+/* formatted timestamp of the last second, cached per thread because localtime_r is expensive */
+struct TimestampCache {
+	std::time_t timestamp = -1;
+	char str[timestampSize + 1];
+};
+thread_local TimestampCache timestampCache;
+
+/* Writes str to a field of fieldSize characters that is filled with spaces already.
+ * If str is too long, it is shortened at the left side and "..." is written in front of it. */
+void writeStrToSize(char* dst, const char* str, std::size_t strSize, bool spacesAtLeftSide, const std::size_t fieldSize) {
+	if(strSize > fieldSize) {
+		std::memcpy(dst, "...", 3);
+		std::memcpy(dst + 3, str + strSize + 3 - fieldSize, fieldSize - 3);
+	}
+	else if(spacesAtLeftSide) {
+		std::memcpy(dst + fieldSize - strSize, str, strSize);
 	}
 	else {
-		while(str.size() < strSize) {
-			str += " ";
-		}
+		std::memcpy(dst, str, strSize);
 	}
+}
 
-	return str;
+void writeStrToSize(char* dst, const char* str, bool spacesAtLeftSide, const std::size_t fieldSize) {
+	if(str) {
+		writeStrToSize(dst, str, std::strlen(str), spacesAtLeftSide, fieldSize);
+	}
 }
 
-std::string makeString(const char* typeName) {
-	return typeName == nullptr ? "" : typeName;
+/* writes value right aligned to the end of buffer "end" and returns the first character */
+char* formatNumber(char* end, std::size_t value, unsigned int base = 10) {
+	do {
+		*--end = "0123456789abcdef"[value % base];
+		value /= base;
+	} while(value > 0);
+	return end;
 }
 
-std::string formatTimestamp(const std::time_t& timestamp) {
-    char timeStr[23];
+void writeNumberToSize(char* dst, std::size_t value, const std::size_t fieldSize) {
+	char buffer[20];
+	char* begin = formatNumber(buffer + sizeof(buffer), value);
+	writeStrToSize(dst, begin, buffer + sizeof(buffer) - begin, true, fieldSize);
+}
+
+void put2(char* dst, int value) {
+	dst[0] = static_cast<char>('0' + value / 10);
+	dst[1] = static_cast<char>('0' + value % 10);
+}
+
+const char* formatTimestamp(const std::time_t& timestamp) {
+	if(timestampCache.timestamp == timestamp) {
+		return timestampCache.str;
+	}
+
     struct tm timeBuf;
     struct tm* timePtr;
 #ifdef _WIN32
@@ -52,23 +94,30 @@ std::string formatTimestamp(const std::time_t& timestamp) {
     timePtr = localtime_r(&timestamp, &timeBuf);
 #endif
 
-    snprintf(timeStr, 23, "$ %04d-%02d-%02d %02d:%02d:%02d ",
-            timePtr->tm_year + 1900,
-            timePtr->tm_mon  + 1,
-            timePtr->tm_mday,
-            timePtr->tm_hour,
-            timePtr->tm_min,
-            timePtr->tm_sec);
-    return timeStr;
+    /* "$ YYYY-MM-DD HH:MM:SS " */
+    char* str = timestampCache.str;
+    int year = timePtr->tm_year + 1900;
+    std::memcpy(str, "$ 0000-00-00 00:00:00 ", timestampSize);
+    put2(str + 2, (year / 100) % 100);
+    put2(str + 4, year % 100);
+    put2(str + 7, timePtr->tm_mon + 1);
+    put2(str + 10, timePtr->tm_mday);
+    put2(str + 13, timePtr->tm_hour);
+    put2(str + 16, timePtr->tm_min);
+    put2(str + 19, timePtr->tm_sec);
+    str[timestampSize] = 0;
+
+    timestampCache.timestamp = timestamp;
+    return str;
 }
 
-std::string formatTimestamp(const std::chrono::time_point<std::chrono::system_clock>& time_point) {
+const char* formatTimestamp(const std::chrono::time_point<std::chrono::system_clock>& time_point) {
 	auto millisecs = std::chrono::duration_cast<std::chrono::milliseconds>(time_point.time_since_epoch());
 	std::time_t timestamp = millisecs.count() / 1000;
 	return formatTimestamp(timestamp);
 }
 
-std::string formatLevel(esl::monitoring::Streams::Level level) {
+const char* formatLevel(esl::monitoring::Streams::Level level) {
     switch(level) {
     case esl::monitoring::Streams::Level::trace:
     	return "[TRACE] ";
@@ -86,68 +135,123 @@ std::string formatLevel(esl::monitoring::Streams::Level level) {
 	return "[ n/a ] ";
 }
 
-std::string formatTypeName(const char* typeName) {
-	return formatStrToSize(makeString(typeName), false, 20);
-}
-
-std::string formatThreadNo(unsigned int threadNo) {
-	return formatStrToSize(std::to_string(threadNo),true, 3);
-}
-
-std::string formatObject(const void* object) {
-	char buffer[20];
-	std::snprintf(buffer, 20, "%p", object);
-	return formatStrToSize(buffer, false, 18);
-}
+/* same output as "%p" of glibc */
+void writeObject(char* dst, const void* object) {
+	if(object == nullptr) {
+		writeStrToSize(dst, "(nil)", 5, false, addressSize);
+		return;
+	}
 
-std::string formatLineNo(unsigned int lineNo) {
-	return formatStrToSize(std::to_string(lineNo),true, 6);
+	char buffer[2 + 2 * sizeof(void*)];
+	char* begin = formatNumber(buffer + sizeof(buffer), reinterpret_cast<std::uintptr_t>(object), 16);
+	*--begin = 'x';
+	*--begin = '0';
+	writeStrToSize(dst, begin, buffer + sizeof(buffer) - begin, false, addressSize);
 }
 
 } /* anonymous namespace */
 
 DefaultLayout::DefaultLayout(const esl::monitoring::SimpleLayout::Settings& aSettings)
 : settings(aSettings)
-{ }
-
-std::string DefaultLayout::toString(const esl::monitoring::Streams::Location& location) const {
-	std::string rv;
+{
+	auto addField = [this](FieldType type, const char* prefix, std::size_t size) {
+		pattern += prefix;
+		fields.push_back(Field{type, pattern.size()});
+		pattern.append(size, ' ');
+	};
 
 	if(settings.showTimestamp) {
-		rv += formatTimestamp(location.timestamp);
+		addField(FieldType::timestamp, "", timestampSize);
 	}
-
 	if(settings.showLevel) {
-		rv += formatLevel(location.level);
+		addField(FieldType::level, "", levelSize);
 	}
 
-    rv += "(";
+	pattern += "(";
 	if(settings.showTypename) {
-	    rv += formatTypeName(location.typeName);
+		addField(FieldType::typeName, "", typeNameSize);
 	}
 	if(settings.showThreadNo) {
-		if(esl::plugin::Registry::get().findObject<esl::monitoring::Logging>()) {
-			rv += "-" + formatThreadNo(esl::plugin::Registry::get().findObject<esl::monitoring::Logging>()->getThreadNo(location.threadId));
-		}
-		else {
-			rv += "- (thread?)";
-		}
+		addField(FieldType::threadNo, "-", threadNoSize);
 	}
 	if(settings.showAddress) {
-		rv += " @ " + formatObject(location.object);
+		addField(FieldType::address, " @ ", addressSize);
 	}
 	if(settings.showFunction) {
-		rv += "|" + formatStrToSize(makeString(location.function), false, 20);
+		addField(FieldType::function, "|", functionSize);
 	}
 	if(settings.showFile) {
-		rv += "|" + formatStrToSize(makeString(location.file), false, 20);
+		addField(FieldType::file, "|", fileSize);
 	}
 	if(settings.showLineNo) {
-		rv += "|" + formatLineNo(location.line);
+		addField(FieldType::lineNo, "|", lineNoSize);
+	}
+	pattern += "): ";
+}
+
+std::string DefaultLayout::toString(const esl::monitoring::Streams::Location& location) const {
+	char buffer[maxSize];
+	return std::string(buffer, format(location, buffer, maxSize));
+}
+
+std::size_t DefaultLayout::format(const esl::monitoring::Streams::Location& location, char* buffer, std::size_t size) const {
+	esl::monitoring::Logging* logging = settings.showThreadNo ? esl::plugin::Registry::get().findObject<esl::monitoring::Logging>() : nullptr;
+
+	/* thread number field is replaced by a longer placeholder if there is no logging to translate the thread id */
+	const std::size_t length = (settings.showThreadNo && !logging) ? pattern.size() + unknownThreadNoSize - threadNoSize : pattern.size();
+	if(size < length) {
+		char tmpBuffer[maxSize];
+		format(location, tmpBuffer, maxSize);
+		std::memcpy(buffer, tmpBuffer, size);
+		return length;
+	}
+
+	std::memcpy(buffer, pattern.data(), pattern.size());
+
+	char* threadNoDst = nullptr;
+
+	for(const auto& field : fields) {
+		char* dst = buffer + field.offset;
+
+		switch(field.type) {
+		case FieldType::timestamp:
+			std::memcpy(dst, formatTimestamp(location.timestamp), timestampSize);
+			break;
+		case FieldType::level:
+			std::memcpy(dst, formatLevel(location.level), levelSize);
+			break;
+		case FieldType::typeName:
+			writeStrToSize(dst, location.typeName, false, typeNameSize);
+			break;
+		case FieldType::threadNo:
+			if(logging) {
+				writeNumberToSize(dst, logging->getThreadNo(location.threadId), threadNoSize);
+			}
+			else {
+				threadNoDst = dst;
+			}
+			break;
+		case FieldType::address:
+			writeObject(dst, location.object);
+			break;
+		case FieldType::function:
+			writeStrToSize(dst, location.function, false, functionSize);
+			break;
+		case FieldType::file:
+			writeStrToSize(dst, location.file, false, fileSize);
+			break;
+		case FieldType::lineNo:
+			writeNumberToSize(dst, static_cast<unsigned int>(location.line), lineNoSize);
+			break;
+		}
+	}
+
+	if(threadNoDst) {
+		std::memmove(threadNoDst + unknownThreadNoSize, threadNoDst + threadNoSize, buffer + pattern.size() - threadNoDst - threadNoSize);
+		std::memcpy(threadNoDst, unknownThreadNo, unknownThreadNoSize);
 	}
-	rv += "): ";
 
-	return rv;
+	return length;
 }
 
 } /* namespace monitoring */
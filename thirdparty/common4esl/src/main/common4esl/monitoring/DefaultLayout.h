@@ -6,6 +6,7 @@
 
 #include <esl/monitoring/Streams.h>
 
+#include <cstddef>
 #include <memory>
 #include <string>
 #include <utility>
@@ -15,14 +16,38 @@ namespace common4esl {
 inline namespace v1_6 {
 namespace monitoring {
 
+/* DefaultLayout compiles the selected fields into a fixed width pattern at construction.
+ * format(...) copies the pattern into the caller's buffer and fills in the fields. It does not allocate anything. */
 class DefaultLayout : public esl::monitoring::Layout {
 public:
+	// maximum length of the output if all fields are selected and the thread number is unknown
+	static constexpr std::size_t maxSize = 136;
+
 	DefaultLayout(const esl::monitoring::SimpleLayout::Settings& settings);
 
 	std::string toString(const esl::monitoring::Streams::Location& location) const override;
+	std::size_t format(const esl::monitoring::Streams::Location& location, char* buffer, std::size_t size) const override;
 
 private:
+	enum class FieldType {
+		timestamp,
+		level,
+		typeName,
+		threadNo,
+		address,
+		function,
+		file,
+		lineNo
+	};
+
+	struct Field {
+		FieldType type;
+		std::size_t offset;
+	};
+
 	esl::monitoring::SimpleLayout::Settings settings;
+	std::string pattern;
+	std::vector<Field> fields;
 };
 
 } /* namespace monitoring */
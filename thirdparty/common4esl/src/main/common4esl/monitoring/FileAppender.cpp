@@ -0,0 +1,372 @@
+#include <common4esl/monitoring/FileAppender.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+#include <stdexcept>
+
+#include <fcntl.h>
+#include <limits.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
+namespace common4esl {
+inline namespace v1_6 {
+namespace monitoring {
+
+namespace {
+/* Size of the chunks of the queue. Each chunk becomes one iovec entry of writev. */
+constexpr std::size_t chunkSize = 64 * 1024;
+
+#ifdef IOV_MAX
+constexpr int maxIovecs = IOV_MAX;
+#else
+constexpr int maxIovecs = 1024;
+#endif
+
+bool equal(const esl::monitoring::Streams::Location& location1, const esl::monitoring::Streams::Location& location2) {
+	return location1.level == location2.level &&
+			location1.object == location2.object &&
+			location1.typeName == location2.typeName &&
+			location1.function == location2.function &&
+			location1.file == location2.file &&
+			location1.threadId == location2.threadId;
+}
+} /* anonymous namespce */
+
+FileAppender::FileAppender(const esl::monitoring::FileAppender::Settings& aSettings)
+: settings(aSettings)
+{
+	openFile();
+	writerThread = std::thread(&FileAppender::run, this);
+}
+
+FileAppender::~FileAppender() {
+	{
+		std::lock_guard<std::mutex> queueLock(queueMutex);
+		isStopped = true;
+	}
+	queueNotEmpty.notify_one();
+	queueNotFull.notify_all();
+	writerThread.join();
+
+	if(fileDescriptor >= 0) {
+		::close(fileDescriptor);
+	}
+}
+
+void FileAppender::setLayout(const esl::monitoring::Layout* aLayout) {
+	layout = aLayout;
+}
+
+const esl::monitoring::Layout* FileAppender::getLayout() const {
+	return layout;
+}
+
+/* both methods are NOT thread-safe */
+void FileAppender::setRecordLevel(esl::monitoring::Appender::RecordLevel aRecordLevel) {
+	recordLevel = aRecordLevel;
+}
+
+esl::monitoring::Appender::RecordLevel FileAppender::getRecordLevel() const {
+	return recordLevel;
+}
+
+void FileAppender::flush(std::ostream*) {
+	std::unique_lock<std::mutex> queueLock(queueMutex);
+	const std::uint64_t count = enqueuedCount;
+
+	queueNotFull.wait(queueLock, [this, count] {
+		return isStopped || writtenCount >= count;
+	});
+}
+
+void FileAppender::write(const esl::monitoring::Streams::Location& aLocation, const char* ptr, std::size_t size) {
+	switch(getRecordLevel()) {
+	case RecordLevel::OFF:
+		return;
+	case RecordLevel::ALL:
+		break;
+	default: /* RecordLevel::SELECTED */
+		if(!aLocation.enabled) {
+			return;
+		}
+		break;
+	}
+
+	if(!equal(lastLocation, aLocation)) {
+		/* open line of last location becomes terminated when the next line starts */
+		isFirstCharacterInLine = true;
+		lastLocation = aLocation;
+	}
+
+	/* Lines are dropped as a whole, so we decide it only if a new line starts.
+	 * An accepted line is always completed, even if we have to wait for space in the queue. */
+	const bool isStartingLine = isFirstCharacterInLine;
+	if(isStartingLine) {
+		isDroppingLine = false;
+	}
+
+	if(isDroppingLine) {
+		for(auto iter = ptr; iter != &ptr[size]; ++iter) {
+			if(isFirstCharacterInLine) {
+				++droppedLines;
+				isFirstCharacterInLine = false;
+			}
+			if(*iter == '\n') {
+				isFirstCharacterInLine = true;
+			}
+		}
+		return;
+	}
+
+	/* formatting state to restore if the lines get dropped */
+	const bool wasLineOpen = isLineOpen;
+	const std::size_t previousDroppedLines = droppedLines;
+
+	buffer.clear();
+
+	const char* begin = ptr;
+	for(auto iter = ptr; iter != &ptr[size]; ++iter) {
+		if(isFirstCharacterInLine) {
+			buffer.append(begin, iter);
+			begin = iter;
+
+			if(isLineOpen) {
+				buffer += "\n";
+			}
+			if(droppedLines > 0) {
+				buffer += "... " + std::to_string(droppedLines) + " log lines dropped because queue of FileAppender was full\n";
+				droppedLines = 0;
+			}
+			if(getLayout()) {
+				getLayout()->formatTo(aLocation, [this](const char* data, std::size_t length) {
+					buffer.append(data, length);
+				});
+			}
+			isFirstCharacterInLine = false;
+			isLineOpen = true;
+		}
+
+		if(*iter == '\n') {
+			isFirstCharacterInLine = true;
+			isLineOpen = false;
+		}
+	}
+	buffer.append(begin, &ptr[size]);
+
+	if(!buffer.empty() && !enqueue(buffer, isStartingLine && isDroppable(aLocation.level))) {
+		isLineOpen = wasLineOpen;
+		droppedLines = previousDroppedLines + 1 + static_cast<std::size_t>(std::count(ptr, &ptr[size - 1], '\n'));
+		isDroppingLine = !isFirstCharacterInLine;
+	}
+}
+
+bool FileAppender::isDroppable(esl::monitoring::Streams::Level level) const {
+	switch(settings.overflow) {
+	case esl::monitoring::FileAppender::Settings::Overflow::drop:
+		return true;
+	case esl::monitoring::FileAppender::Settings::Overflow::dropBelowLevel:
+		return level < settings.overflowLevel;
+	default: /* Overflow::block */
+		return false;
+	}
+}
+
+bool FileAppender::hasQueueSpace(std::size_t size) const {
+	/* a string larger than the queue is accepted if the queue is empty, otherwise we would wait forever */
+	return queueBytes == 0 || queueBytes + size <= settings.queueSize;
+}
+
+bool FileAppender::enqueue(const std::string& str, bool isDroppable) {
+	std::unique_lock<std::mutex> queueLock(queueMutex);
+
+	if(isDroppable && !isStopped && !hasQueueSpace(str.size())) {
+		return false;
+	}
+
+	queueNotFull.wait(queueLock, [this, &str] {
+		return isStopped || hasQueueSpace(str.size());
+	});
+
+	std::size_t pos = 0;
+	while(pos < str.size()) {
+		if(queue.empty() || queue.back().size() >= chunkSize) {
+			if(freeChunks.empty()) {
+				queue.emplace_back();
+				queue.back().reserve(chunkSize);
+			}
+			else {
+				queue.push_back(std::move(freeChunks.back()));
+				freeChunks.pop_back();
+			}
+		}
+
+		std::size_t count = std::min(str.size() - pos, chunkSize - queue.back().size());
+		queue.back().append(str, pos, count);
+		pos += count;
+	}
+
+	queueBytes += str.size();
+	++enqueuedCount;
+	queueNotEmpty.notify_one();
+
+	return true;
+}
+
+void FileAppender::run() {
+	std::vector<std::string> batch;
+	std::unique_lock<std::mutex> queueLock(queueMutex);
+
+	while(true) {
+		queueNotEmpty.wait(queueLock, [this] {
+			return isStopped || !queue.empty();
+		});
+
+		if(queue.empty()) {
+			/* isStopped is set */
+			break;
+		}
+
+		/* take everything that has been queued so far. Producers can continue immediately with an empty queue. */
+		batch.swap(queue);
+		const std::size_t batchSize = queueBytes;
+		const std::uint64_t batchCount = enqueuedCount;
+		queueBytes = 0;
+		queueNotFull.notify_all();
+
+		queueLock.unlock();
+		writeBatch(batch, batchSize);
+		queueLock.lock();
+
+		/* keep memory of chunks for reuse, but not more than a full queue needs */
+		for(auto& chunk : batch) {
+			if(freeChunks.size() * chunkSize >= settings.queueSize + chunkSize) {
+				break;
+			}
+			chunk.clear();
+			freeChunks.push_back(std::move(chunk));
+		}
+		batch.clear();
+
+		writtenCount = batchCount;
+		queueNotFull.notify_all();
+	}
+
+	writtenCount = enqueuedCount;
+	queueNotFull.notify_all();
+}
+
+void FileAppender::writeBatch(const std::vector<std::string>& batch, std::size_t batchSize) {
+	if(settings.rotateSize > 0 && fileSize > 0 && fileSize + batchSize > settings.rotateSize) {
+		rotateFile();
+	}
+	else if(settings.rotateInterval > 0 && std::chrono::system_clock::now() - fileOpened >= std::chrono::seconds(settings.rotateInterval)) {
+		rotateFile();
+	}
+
+	if(fileDescriptor < 0 && !reopenFile()) {
+		return;
+	}
+
+	std::vector<struct iovec> iovecs;
+	iovecs.reserve(std::min(batch.size(), static_cast<std::size_t>(maxIovecs)));
+
+	std::size_t index = 0;
+	while(index < batch.size()) {
+		iovecs.clear();
+		for(; index < batch.size() && iovecs.size() < static_cast<std::size_t>(maxIovecs); ++index) {
+			if(!batch[index].empty()) {
+				struct iovec entry;
+				entry.iov_base = const_cast<char*>(batch[index].data());
+				entry.iov_len = batch[index].size();
+				iovecs.push_back(entry);
+			}
+		}
+
+		struct iovec* current = iovecs.data();
+		int remaining = static_cast<int>(iovecs.size());
+		while(remaining > 0) {
+			ssize_t rc = ::writev(fileDescriptor, current, remaining);
+			if(rc < 0) {
+				if(errno == EINTR) {
+					continue;
+				}
+				/* we cannot log errors of the log file. Give up this batch. */
+				return;
+			}
+			fileSize += static_cast<std::size_t>(rc);
+
+			/* skip iovecs that have been written completely and adjust a partially written one */
+			std::size_t written = static_cast<std::size_t>(rc);
+			while(remaining > 0 && written >= current->iov_len) {
+				written -= current->iov_len;
+				++current;
+				--remaining;
+			}
+			if(remaining > 0) {
+				current->iov_base = static_cast<char*>(current->iov_base) + written;
+				current->iov_len -= written;
+			}
+		}
+	}
+
+	if(settings.sync) {
+		::fdatasync(fileDescriptor);
+	}
+}
+
+void FileAppender::openFile() {
+	fileDescriptor = ::open(settings.fileName.c_str(), O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0644);
+	if(fileDescriptor < 0) {
+		throw std::runtime_error("FileAppender cannot open file \"" + settings.fileName + "\": " + std::strerror(errno));
+	}
+
+	struct stat fileStat;
+	fileSize = (::fstat(fileDescriptor, &fileStat) == 0) ? static_cast<std::size_t>(fileStat.st_size) : 0;
+	fileOpened = std::chrono::system_clock::now();
+}
+
+void FileAppender::rotateFile() {
+	if(fileDescriptor >= 0) {
+		if(settings.sync) {
+			::fdatasync(fileDescriptor);
+		}
+		::close(fileDescriptor);
+		fileDescriptor = -1;
+	}
+
+	if(settings.rotateFiles == 0) {
+		std::remove(settings.fileName.c_str());
+	}
+	else {
+		/* <fileName>.<n-1> -> <fileName>.<n>, ..., <fileName> -> <fileName>.1 */
+		std::remove((settings.fileName + "." + std::to_string(settings.rotateFiles)).c_str());
+		for(std::size_t i = settings.rotateFiles; i > 1; --i) {
+			std::rename((settings.fileName + "." + std::to_string(i-1)).c_str(), (settings.fileName + "." + std::to_string(i)).c_str());
+		}
+		std::rename(settings.fileName.c_str(), (settings.fileName + ".1").c_str());
+	}
+
+	reopenFile();
+}
+
+bool FileAppender::reopenFile() {
+	try {
+		openFile();
+	}
+	catch(...) {
+		/* we cannot log errors of the log file. Lines are discarded until the file can be opened again. */
+		fileDescriptor = -1;
+		fileSize = 0;
+		fileOpened = std::chrono::system_clock::now();
+		return false;
+	}
+	return true;
+}
+
+} /* namespace monitoring */
+} /* inline namespace v1_6 */
+} /* namespace common4esl */
@@ -0,0 +1,93 @@
+#ifndef COMMON4ESL_MONITORING_FILEAPPENDER_H_
+#define COMMON4ESL_MONITORING_FILEAPPENDER_H_
+
+#include <esl/monitoring/Appender.h>
+#include <esl/monitoring/FileAppender.h>
+
+#include <esl/monitoring/Layout.h>
+#include <esl/monitoring/Streams.h>
+
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace common4esl {
+inline namespace v1_6 {
+namespace monitoring {
+
+class FileAppender : public esl::monitoring::Appender {
+public:
+	FileAppender(const esl::monitoring::FileAppender::Settings& settings);
+	~FileAppender();
+
+	void setLayout(const esl::monitoring::Layout* aLayout) override;
+	const esl::monitoring::Layout* getLayout() const override;
+
+	/* both methods are NOT thread-safe */
+	void setRecordLevel(esl::monitoring::Appender::RecordLevel aRecordLevel = RecordLevel::SELECTED) override;
+	esl::monitoring::Appender::RecordLevel getRecordLevel() const override;
+
+	/* waits until everything written so far is on disk */
+	void flush(std::ostream*) override;
+
+	void write(const esl::monitoring::Streams::Location& location, const char* ptr, std::size_t size) override;
+
+private:
+	const esl::monitoring::FileAppender::Settings settings;
+
+	const esl::monitoring::Layout* layout = nullptr;
+	esl::monitoring::Appender::RecordLevel recordLevel = RecordLevel::SELECTED;
+
+	/* formatting state, used by write(...) only */
+	bool isFirstCharacterInLine = true;
+	bool isLineOpen = false;
+	bool isDroppingLine = false;
+	std::size_t droppedLines = 0;
+	esl::monitoring::Streams::Location lastLocation;
+	std::string buffer;
+
+	/* queue, must be locked by queueMutex */
+	std::mutex queueMutex;
+	std::condition_variable queueNotEmpty;
+	std::condition_variable queueNotFull;
+	std::vector<std::string> queue;
+	std::vector<std::string> freeChunks;
+	std::size_t queueBytes = 0;
+	std::uint64_t enqueuedCount = 0;
+	std::uint64_t writtenCount = 0;
+	bool isStopped = false;
+
+	/* file, used by writer thread only after construction */
+	int fileDescriptor = -1;
+	std::size_t fileSize = 0;
+	std::chrono::system_clock::time_point fileOpened;
+
+	std::thread writerThread;
+
+	/* returns true if lines of this level are dropped instead of waiting for space in the queue */
+	bool isDroppable(esl::monitoring::Streams::Level level) const;
+
+	/* must be called with queueMutex locked */
+	bool hasQueueSpace(std::size_t size) const;
+
+	/* returns false if str has been dropped because isDroppable is set and the queue has no space for str */
+	bool enqueue(const std::string& str, bool isDroppable);
+
+	void run();
+	void writeBatch(const std::vector<std::string>& batch, std::size_t batchSize);
+	void openFile();
+	bool reopenFile();
+	void rotateFile();
+};
+
+} /* namespace monitoring */
+} /* inline namespace v1_6 */
+} /* namespace common4esl */
+
+#endif /* COMMON4ESL_MONITORING_FILEAPPENDER_H_ */
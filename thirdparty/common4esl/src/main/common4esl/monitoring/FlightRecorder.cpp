@@ -0,0 +1,345 @@
+#include <common4esl/monitoring/FlightRecorder.h>
+
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <stdexcept>
+#include <thread>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace common4esl {
+inline namespace v1_6 {
+namespace monitoring {
+
+/* All positions are absolute byte counts since creation of the ring. The offset in the ring is "position % ringSize". */
+struct FlightRecorder::Header {
+	char magic[8];
+	std::uint64_t ringSize;
+	std::uint64_t stringTableSize;
+	std::uint64_t stringTableUsed;
+	std::uint64_t first;
+	std::uint64_t next;
+	std::uint64_t reserved[2];
+};
+
+/* A record with isPadding != 0 fills the end of the ring, if the next record does not fit anymore.
+ * If less than sizeof(RecordHeader) bytes are left at the end of the ring, these bytes are skipped without a padding record. */
+struct FlightRecorder::RecordHeader {
+	std::uint32_t size;
+	std::uint32_t payloadSize;
+	std::int64_t timestamp;
+	std::uint64_t object;
+	std::uint64_t threadId;
+	std::uint32_t typeName;
+	std::uint32_t function;
+	std::uint32_t file;
+	std::uint32_t line;
+	std::uint8_t level;
+	std::uint8_t isPadding;
+	std::uint8_t reserved[6];
+};
+
+namespace {
+constexpr char magic[8] = { 'E', 'S', 'L', 'F', 'L', 'R', 'E', '1' };
+constexpr std::size_t stringTableSize = 64 * 1024;
+
+static_assert(sizeof(std::thread::id) <= sizeof(std::uint64_t), "std::thread::id does not fit into a record");
+
+std::size_t align8(std::size_t size) {
+	return (size + 7) & ~static_cast<std::size_t>(7);
+}
+
+bool equal(const esl::monitoring::Streams::Location& location1, const esl::monitoring::Streams::Location& location2) {
+	return location1.level == location2.level &&
+			location1.object == location2.object &&
+			location1.typeName == location2.typeName &&
+			location1.function == location2.function &&
+			location1.file == location2.file &&
+			location1.threadId == location2.threadId;
+}
+
+} /* anonymous namespace */
+
+FlightRecorder::FlightRecorder(std::size_t size, const std::string& fileName) {
+	size = align8(size);
+	if(size < 4096) {
+		throw std::runtime_error("FlightRecorder needs at least 4096 bytes");
+	}
+
+	int fileDescriptor = -1;
+	if(!fileName.empty()) {
+		fileDescriptor = ::open(fileName.c_str(), O_RDWR | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+		if(fileDescriptor < 0) {
+			throw std::runtime_error("FlightRecorder cannot open file \"" + fileName + "\": " + std::strerror(errno));
+		}
+		if(::ftruncate(fileDescriptor, static_cast<off_t>(sizeof(Header) + stringTableSize + size)) != 0) {
+			int error = errno;
+			::close(fileDescriptor);
+			throw std::runtime_error("FlightRecorder cannot resize file \"" + fileName + "\": " + std::strerror(error));
+		}
+	}
+
+	try {
+		map(fileDescriptor, sizeof(Header) + stringTableSize + size);
+	}
+	catch(...) {
+		if(fileDescriptor >= 0) {
+			::close(fileDescriptor);
+		}
+		throw;
+	}
+	if(fileDescriptor >= 0) {
+		::close(fileDescriptor);
+	}
+
+	header->ringSize = size;
+	header->stringTableSize = stringTableSize;
+	header->stringTableUsed = 1; // offset 0 is the empty string
+	header->first = 0;
+	header->next = 0;
+	stringTable[0] = 0;
+
+	/* magic is written at last, so a reader never sees a half initialized header */
+	std::atomic_signal_fence(std::memory_order_release);
+	std::memcpy(header->magic, magic, sizeof(magic));
+}
+
+FlightRecorder::FlightRecorder(const std::string& fileName)
+: isReadOnly(true)
+{
+	int fileDescriptor = ::open(fileName.c_str(), O_RDONLY | O_CLOEXEC);
+	if(fileDescriptor < 0) {
+		throw std::runtime_error("FlightRecorder cannot open file \"" + fileName + "\": " + std::strerror(errno));
+	}
+
+	struct stat fileStat;
+	if(::fstat(fileDescriptor, &fileStat) != 0 || static_cast<std::size_t>(fileStat.st_size) < sizeof(Header)) {
+		::close(fileDescriptor);
+		throw std::runtime_error("File \"" + fileName + "\" is not a flight recorder file");
+	}
+
+	try {
+		map(fileDescriptor, static_cast<std::size_t>(fileStat.st_size));
+	}
+	catch(...) {
+		::close(fileDescriptor);
+		throw;
+	}
+	::close(fileDescriptor);
+
+	if(std::memcmp(header->magic, magic, sizeof(magic)) != 0
+			|| header->stringTableSize != stringTableSize
+			|| sizeof(Header) + header->stringTableSize + header->ringSize != mappingSize
+			|| header->stringTableUsed > header->stringTableSize
+			|| header->first > header->next
+			|| header->next - header->first > header->ringSize) {
+		::munmap(mapping, mappingSize);
+		throw std::runtime_error("File \"" + fileName + "\" is not a flight recorder file or it is corrupted");
+	}
+}
+
+FlightRecorder::~FlightRecorder() {
+	::munmap(mapping, mappingSize);
+}
+
+void FlightRecorder::append(const esl::monitoring::Streams::Location& location, const char* ptr, std::size_t size) {
+	const std::uint64_t ringSize = header->ringSize;
+	const std::size_t maxPayloadSize = ringSize / 2 - sizeof(RecordHeader);
+	if(size > maxPayloadSize) {
+		size = maxPayloadSize;
+	}
+	const std::size_t recordSize = align8(sizeof(RecordHeader) + size);
+
+	std::uint64_t first = header->first;
+	std::uint64_t next = header->next;
+
+	/* drops oldest records until "required" bytes are free */
+	auto makeRoom = [&](std::size_t required) {
+		while(next + required - first > ringSize) {
+			const char* recordHeader;
+			first += getRecordSize(first, recordHeader);
+		}
+		header->first = first;
+	};
+
+	std::size_t remaining = ringSize - next % ringSize;
+	if(remaining < recordSize) {
+		makeRoom(remaining);
+		if(remaining >= sizeof(RecordHeader)) {
+			RecordHeader padding;
+			std::memset(&padding, 0, sizeof(padding));
+			padding.size = static_cast<std::uint32_t>(remaining);
+			padding.isPadding = 1;
+			std::memcpy(ring + next % ringSize, &padding, sizeof(padding));
+		}
+		next += remaining;
+	}
+	makeRoom(recordSize);
+
+	RecordHeader recordHeader;
+	std::memset(&recordHeader, 0, sizeof(recordHeader));
+	recordHeader.size = static_cast<std::uint32_t>(recordSize);
+	recordHeader.payloadSize = static_cast<std::uint32_t>(size);
+	recordHeader.timestamp = std::chrono::duration_cast<std::chrono::milliseconds>(location.timestamp.time_since_epoch()).count();
+	recordHeader.object = reinterpret_cast<std::uintptr_t>(location.object);
+	std::memcpy(&recordHeader.threadId, &location.threadId, sizeof(location.threadId));
+	recordHeader.typeName = getStringOffset(location.typeName);
+	recordHeader.function = getStringOffset(location.function);
+	recordHeader.file = getStringOffset(location.file);
+	recordHeader.line = static_cast<std::uint32_t>(location.line);
+	recordHeader.level = static_cast<std::uint8_t>(location.level);
+
+	char* record = ring + next % ringSize;
+	std::memcpy(record, &recordHeader, sizeof(recordHeader));
+	std::memcpy(record + sizeof(recordHeader), ptr, size);
+
+	/* record is complete before it becomes visible by "next" */
+	std::atomic_signal_fence(std::memory_order_release);
+	header->next = next + recordSize;
+}
+
+void FlightRecorder::write(std::ostream& oStream, const esl::monitoring::Layout* layout) const {
+	const std::uint64_t ringSize = header->ringSize;
+	const std::uint64_t next = header->next;
+
+	esl::monitoring::Streams::Location lastLocation;
+	bool isFirstCharacterInLine = true;
+
+	for(std::uint64_t position = header->first; position < next;) {
+		const char* recordHeaderPtr;
+		std::size_t size = getRecordSize(position, recordHeaderPtr);
+		if(size == 0 || size > ringSize - position % ringSize || (recordHeaderPtr && size < sizeof(RecordHeader))) {
+			oStream << "\n... flight recorder is corrupted\n";
+			return;
+		}
+		position += size;
+
+		if(recordHeaderPtr == nullptr) {
+			continue;
+		}
+
+		RecordHeader recordHeader;
+		std::memcpy(&recordHeader, recordHeaderPtr, sizeof(recordHeader));
+		if(recordHeader.isPadding || sizeof(RecordHeader) + recordHeader.payloadSize > size) {
+			continue;
+		}
+
+		esl::monitoring::Streams::Location location;
+		location.timestamp = std::chrono::time_point<std::chrono::system_clock>(std::chrono::milliseconds(recordHeader.timestamp));
+		location.level = static_cast<esl::monitoring::Streams::Level>(recordHeader.level);
+		location.object = reinterpret_cast<const void*>(static_cast<std::uintptr_t>(recordHeader.object));
+		location.typeName = getString(recordHeader.typeName);
+		location.function = getString(recordHeader.function);
+		location.file = getString(recordHeader.file);
+		location.line = recordHeader.line;
+		std::memcpy(static_cast<void*>(&location.threadId), &recordHeader.threadId, sizeof(location.threadId));
+
+		if(!equal(lastLocation, location)) {
+			if(!isFirstCharacterInLine) {
+				oStream << "\n";
+				isFirstCharacterInLine = true;
+			}
+			lastLocation = location;
+		}
+
+		const char* ptr = recordHeaderPtr + sizeof(RecordHeader);
+		const char* end = ptr + recordHeader.payloadSize;
+		const char* begin = ptr;
+		for(; ptr != end; ++ptr) {
+			if(isFirstCharacterInLine) {
+				if(layout) {
+					layout->formatTo(location, [&oStream](const char* data, std::size_t length) {
+						oStream.write(data, length);
+					});
+				}
+				isFirstCharacterInLine = false;
+			}
+
+			if(*ptr == '\n') {
+				oStream.write(begin, ptr + 1 - begin);
+				isFirstCharacterInLine = true;
+				begin = ptr + 1;
+			}
+		}
+		oStream.write(begin, end - begin);
+	}
+
+	if(!isFirstCharacterInLine) {
+		oStream << "\n";
+	}
+}
+
+std::uint32_t FlightRecorder::getStringOffset(const char* str) {
+	if(str == nullptr) {
+		return 0;
+	}
+
+	auto iter = stringOffsets.find(str);
+	if(iter != stringOffsets.end()) {
+		return iter->second;
+	}
+
+	std::uint32_t offset = 0;
+	std::size_t size = std::strlen(str) + 1;
+	if(header->stringTableUsed + size <= header->stringTableSize) {
+		offset = static_cast<std::uint32_t>(header->stringTableUsed);
+		std::memcpy(stringTable + offset, str, size);
+		std::atomic_signal_fence(std::memory_order_release);
+		header->stringTableUsed += size;
+	}
+
+	stringOffsets[str] = offset;
+	return offset;
+}
+
+std::size_t FlightRecorder::getRecordSize(std::uint64_t position, const char*& recordHeader) const {
+	std::size_t offset = position % header->ringSize;
+	std::size_t remaining = header->ringSize - offset;
+
+	if(remaining < sizeof(RecordHeader)) {
+		recordHeader = nullptr;
+		return remaining;
+	}
+
+	recordHeader = ring + offset;
+	std::uint32_t size;
+	std::memcpy(&size, recordHeader, sizeof(size));
+	return size;
+}
+
+const char* FlightRecorder::getString(std::uint32_t offset) const {
+	if(offset == 0 || offset >= header->stringTableUsed) {
+		return nullptr;
+	}
+	return stringTable + offset;
+}
+
+void FlightRecorder::map(int fileDescriptor, std::size_t size) {
+	int protection = isReadOnly ? PROT_READ : PROT_READ | PROT_WRITE;
+
+	if(fileDescriptor >= 0) {
+		mapping = ::mmap(nullptr, size, protection, MAP_SHARED, fileDescriptor, 0);
+	}
+	else {
+		mapping = ::mmap(nullptr, size, protection, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+	}
+
+	if(mapping == MAP_FAILED) {
+		mapping = nullptr;
+		throw std::runtime_error(std::string("FlightRecorder cannot map memory: ") + std::strerror(errno));
+	}
+
+	mappingSize = size;
+	header = static_cast<Header*>(mapping);
+	stringTable = static_cast<char*>(mapping) + sizeof(Header);
+	ring = stringTable + stringTableSize;
+}
+
+} /* namespace monitoring */
+} /* inline namespace v1_6 */
+} /* namespace common4esl */
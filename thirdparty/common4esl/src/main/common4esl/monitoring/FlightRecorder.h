@@ -0,0 +1,68 @@
+#ifndef COMMON4ESL_MONITORING_FLIGHTRECORDER_H_
+#define COMMON4ESL_MONITORING_FLIGHTRECORDER_H_
+
+#include <esl/monitoring/Layout.h>
+#include <esl/monitoring/Streams.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <ostream>
+#include <string>
+#include <unordered_map>
+
+namespace common4esl {
+inline namespace v1_6 {
+namespace monitoring {
+
+/* FlightRecorder is a single contiguous ring of length-prefixed binary records.
+ * A record contains the fields of a Location as integers and the raw text that has been logged.
+ * Strings of a Location (type name, function, file) are stored once in a string table, so the records refer to them by offset.
+ * Appending a record is O(1) and does not allocate anything. Oldest records are overwritten if the ring is full.
+ * If the ring is backed by a file, the content survives a crash of the process and can be rendered by "openesl-flightrecorder". */
+class FlightRecorder {
+public:
+	// creates a new ring with "size" bytes. If "fileName" is not empty, the ring is a shared mapping of this file.
+	FlightRecorder(std::size_t size, const std::string& fileName);
+
+	// opens an existing file read only
+	FlightRecorder(const std::string& fileName);
+
+	FlightRecorder(const FlightRecorder&) = delete;
+	~FlightRecorder();
+
+	FlightRecorder& operator=(const FlightRecorder&) = delete;
+
+	/* NOT thread-safe */
+	void append(const esl::monitoring::Streams::Location& location, const char* ptr, std::size_t size);
+
+	/* writes all records from oldest to newest. Each line starts with the layout of its location, if layout is not nullptr. */
+	void write(std::ostream& oStream, const esl::monitoring::Layout* layout) const;
+
+private:
+	struct Header;
+	struct RecordHeader;
+
+	void* mapping = nullptr;
+	std::size_t mappingSize = 0;
+	bool isReadOnly = false;
+
+	Header* header = nullptr;
+	char* stringTable = nullptr;
+	char* ring = nullptr;
+
+	std::unordered_map<const char*, std::uint32_t> stringOffsets;
+
+	/* returns the size of the record at position including padding and sets recordHeader to nullptr if the end of the ring is skipped */
+	std::size_t getRecordSize(std::uint64_t position, const char*& recordHeader) const;
+
+	std::uint32_t getStringOffset(const char* str);
+	const char* getString(std::uint32_t offset) const;
+
+	void map(int fileDescriptor, std::size_t size);
+};
+
+} /* namespace monitoring */
+} /* inline namespace v1_6 */
+} /* namespace common4esl */
+
+#endif /* COMMON4ESL_MONITORING_FLIGHTRECORDER_H_ */
@@ -22,6 +22,9 @@ SOFTWARE.
 
 #include <common4esl/monitoring/MemBufferAppender.h>
 
+#include <algorithm>
+#include <cstring>
+
 namespace common4esl {
 inline namespace v1_6 {
 namespace monitoring {
@@ -39,7 +42,8 @@ bool equal(const esl::monitoring::Streams::Location& location1, const esl::monit
 
 MemBufferAppender::MemBufferAppender(esl::monitoring::MemBufferAppender::Settings aSettings)
 : settings(aSettings),
-  entries(settings.maxLines+1, settings.maxColumns)
+  entries(settings.bufferSize > 0 ? 0 : settings.maxLines+1, settings.maxColumns),
+  flightRecorder(settings.bufferSize > 0 ? new FlightRecorder(settings.bufferSize, settings.file) : nullptr)
 {
 
 }
@@ -66,6 +70,11 @@ void MemBufferAppender::flush(std::ostream* oStream) {
 		return;
 	}
 
+	if(flightRecorder) {
+		flightRecorder->write(*oStream, layout);
+		return;
+	}
+
 	std::vector<std::tuple<esl::monitoring::Streams::Location, std::string>> buffer;
 
 	if(settings.maxColumns > 0) {
@@ -104,6 +113,11 @@ void MemBufferAppender::write(const esl::monitoring::Streams::Location& location
 		break;
 	}
 
+	if(flightRecorder) {
+		flightRecorder->append(location, str, len);
+		return;
+	}
+
 	if(!equal(entries[rowProducer].location, location)) {
 		if(columnsProducer > 0) {
 			newline();
@@ -135,8 +149,10 @@ void MemBufferAppender::write(const char* ptr, std::size_t size) {
         columnsProducer += size;
     }
     else {
-        std::strncat(&entries[rowProducer].lineStaticSize[columnsProducer], ptr, std::min(size, settings.maxColumns - columnsProducer));
-        columnsProducer += std::min(size, settings.maxColumns - columnsProducer);
+        std::size_t count = std::min(size, settings.maxColumns - columnsProducer);
+        std::memcpy(&entries[rowProducer].lineStaticSize[columnsProducer], ptr, count);
+        columnsProducer += count;
+        entries[rowProducer].lineStaticSize[columnsProducer] = 0;
     }
 }
 
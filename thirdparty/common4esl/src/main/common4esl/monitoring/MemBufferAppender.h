@@ -1,6 +1,8 @@
 #ifndef COMMON4ESL_MONITORING_MEMBUFFERAPPENDER_H_
 #define COMMON4ESL_MONITORING_MEMBUFFERAPPENDER_H_
 
+#include <common4esl/monitoring/FlightRecorder.h>
+
 #include <esl/monitoring/Appender.h>
 #include <esl/monitoring/MemBufferAppender.h>
 
@@ -50,6 +52,7 @@ private:
 
     const esl::monitoring::MemBufferAppender::Settings settings;
     std::vector<Entry> entries;
+    std::unique_ptr<FlightRecorder> flightRecorder;
 
 	std::size_t rowProducer = 0;
 	std::size_t rowConsumer = 0;
@@ -0,0 +1,325 @@
+#include <common4esl/utility/Codec.h>
+
+#include <cstring>
+
+#if defined(__x86_64__) && (defined(__GNUC__) || defined(__clang__))
+#define COMMON4ESL_UTILITY_CODEC_X86
+#include <immintrin.h>
+#endif
+
+namespace common4esl {
+inline namespace v1_6 {
+namespace utility {
+
+namespace {
+const char base64Chars[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+const char base64urlChars[] = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_";
+const char base16Chars[] = "0123456789abcdef";
+
+struct Tables {
+	constexpr Tables() {
+		for(int i = 0; i < 256; ++i) {
+			base64Values[i] = -1;
+			base16Values[i] = -1;
+			urlUnreserved[i] = false;
+		}
+		for(int i = 0; i < 64; ++i) {
+			base64Values[static_cast<unsigned char>(base64Chars[i])] = static_cast<signed char>(i);
+			base64Values[static_cast<unsigned char>(base64urlChars[i])] = static_cast<signed char>(i);
+		}
+		for(int i = 0; i < 16; ++i) {
+			base16Values[static_cast<unsigned char>(base16Chars[i])] = static_cast<signed char>(i);
+		}
+		for(int i = 10; i < 16; ++i) {
+			base16Values['A' + i - 10] = static_cast<signed char>(i);
+		}
+		for(int i = 0; i < 62; ++i) {
+			urlUnreserved[static_cast<unsigned char>(base64Chars[i])] = true;
+		}
+		urlUnreserved['-'] = true;
+		urlUnreserved['_'] = true;
+		urlUnreserved['.'] = true;
+		urlUnreserved['~'] = true;
+	}
+
+	signed char base64Values[256] {};
+	signed char base16Values[256] {};
+	bool urlUnreserved[256] {};
+};
+
+constexpr Tables tables;
+
+std::size_t encodeBase64GroupsScalar(const std::uint8_t* in, std::size_t size, char* out, bool url) noexcept {
+	const char* chars = url ? base64urlChars : base64Chars;
+	char* outBegin = out;
+
+	for(std::size_t i = 0; i + 3 <= size; i += 3) {
+		std::uint32_t packed = (static_cast<std::uint32_t>(in[i]) << 16) | (static_cast<std::uint32_t>(in[i+1]) << 8) | in[i+2];
+		out[0] = chars[packed >> 18];
+		out[1] = chars[(packed >> 12) & 0x3f];
+		out[2] = chars[(packed >> 6) & 0x3f];
+		out[3] = chars[packed & 0x3f];
+		out += 4;
+	}
+
+	return static_cast<std::size_t>(out - outBegin);
+}
+
+std::size_t decodeBase64GroupsScalar(const char* in, std::size_t size, std::uint8_t* out) noexcept {
+	std::size_t pos = 0;
+
+	for(; pos + 4 <= size; pos += 4) {
+		int a = tables.base64Values[static_cast<unsigned char>(in[pos])];
+		int b = tables.base64Values[static_cast<unsigned char>(in[pos+1])];
+		int c = tables.base64Values[static_cast<unsigned char>(in[pos+2])];
+		int d = tables.base64Values[static_cast<unsigned char>(in[pos+3])];
+		if((a | b | c | d) < 0) {
+			break;
+		}
+
+		std::uint32_t packed = (static_cast<std::uint32_t>(a) << 18) | (static_cast<std::uint32_t>(b) << 12) | (static_cast<std::uint32_t>(c) << 6) | static_cast<std::uint32_t>(d);
+		out[0] = static_cast<std::uint8_t>(packed >> 16);
+		out[1] = static_cast<std::uint8_t>(packed >> 8);
+		out[2] = static_cast<std::uint8_t>(packed);
+		out += 3;
+	}
+
+	return pos;
+}
+
+void encodeBase16Scalar(const std::uint8_t* in, std::size_t size, char* out) noexcept {
+	for(std::size_t i = 0; i < size; ++i) {
+		out[2*i] = base16Chars[in[i] >> 4];
+		out[2*i+1] = base16Chars[in[i] & 0x0f];
+	}
+}
+
+#ifdef COMMON4ESL_UTILITY_CODEC_X86
+bool hasAVX2() noexcept {
+	static const bool rv = [] {
+		__builtin_cpu_init();
+		return __builtin_cpu_supports("avx2") != 0;
+	}();
+	return rv;
+}
+
+bool hasSSSE3() noexcept {
+	static const bool rv = [] {
+		__builtin_cpu_init();
+		return __builtin_cpu_supports("ssse3") != 0;
+	}();
+	return rv;
+}
+
+/* Algorithm of Wojciech Muła and Daniel Lemire: 24 bytes are spread to 32 indices of 6 bit,
+ * that are translated to characters by an offset looked up by pshufb. */
+__attribute__((target("avx2")))
+std::size_t encodeBase64GroupsAVX2(const std::uint8_t* in, std::size_t size, char* out, bool url) noexcept {
+	const char offset62 = url ? '-' - 62 : '+' - 62;
+	const char offset63 = url ? '_' - 63 : '/' - 63;
+	const __m256i shuffle = _mm256_setr_epi8(
+			1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10,
+			1, 0, 2, 1, 4, 3, 5, 4, 7, 6, 8, 7, 10, 9, 11, 10);
+	const __m256i offsets = _mm256_setr_epi8(
+			'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, offset62, offset63, 'A', 0, 0,
+			'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, offset62, offset63, 'A', 0, 0);
+	std::size_t pos = 0;
+
+	/* each half loads 16 bytes but uses only 12 of them */
+	for(; pos + 28 <= size; pos += 24) {
+		__m256i v = _mm256_inserti128_si256(
+				_mm256_castsi128_si256(_mm_loadu_si128(reinterpret_cast<const __m128i*>(in + pos))),
+				_mm_loadu_si128(reinterpret_cast<const __m128i*>(in + pos + 12)), 1);
+		v = _mm256_shuffle_epi8(v, shuffle);
+
+		const __m256i t0 = _mm256_mulhi_epu16(_mm256_and_si256(v, _mm256_set1_epi32(0x0fc0fc00)), _mm256_set1_epi32(0x04000040));
+		const __m256i t1 = _mm256_mullo_epi16(_mm256_and_si256(v, _mm256_set1_epi32(0x003f03f0)), _mm256_set1_epi32(0x01000010));
+		const __m256i indices = _mm256_or_si256(t0, t1);
+
+		__m256i reduced = _mm256_subs_epu8(indices, _mm256_set1_epi8(51));
+		reduced = _mm256_or_si256(reduced, _mm256_and_si256(_mm256_cmpgt_epi8(_mm256_set1_epi8(26), indices), _mm256_set1_epi8(13)));
+		const __m256i chars = _mm256_add_epi8(_mm256_shuffle_epi8(offsets, reduced), indices);
+
+		_mm256_storeu_si256(reinterpret_cast<__m256i*>(out + pos / 3 * 4), chars);
+	}
+
+	return pos;
+}
+
+__attribute__((target("avx2")))
+std::size_t decodeBase64GroupsAVX2(const char* in, std::size_t size, std::uint8_t* out) noexcept {
+	const __m256i shuffle = _mm256_setr_epi8(
+			2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1,
+			2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1);
+	std::size_t pos = 0;
+
+	for(; pos + 32 <= size; pos += 32) {
+		const __m256i c = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(in + pos));
+
+		/* bytes >= 0x80 are negative and fail all ranges */
+		const __m256i upper = _mm256_and_si256(_mm256_cmpgt_epi8(c, _mm256_set1_epi8('A' - 1)), _mm256_cmpgt_epi8(_mm256_set1_epi8('Z' + 1), c));
+		const __m256i lower = _mm256_and_si256(_mm256_cmpgt_epi8(c, _mm256_set1_epi8('a' - 1)), _mm256_cmpgt_epi8(_mm256_set1_epi8('z' + 1), c));
+		const __m256i digit = _mm256_and_si256(_mm256_cmpgt_epi8(c, _mm256_set1_epi8('0' - 1)), _mm256_cmpgt_epi8(_mm256_set1_epi8('9' + 1), c));
+		const __m256i is62 = _mm256_or_si256(_mm256_cmpeq_epi8(c, _mm256_set1_epi8('+')), _mm256_cmpeq_epi8(c, _mm256_set1_epi8('-')));
+		const __m256i is63 = _mm256_or_si256(_mm256_cmpeq_epi8(c, _mm256_set1_epi8('/')), _mm256_cmpeq_epi8(c, _mm256_set1_epi8('_')));
+
+		const __m256i valid = _mm256_or_si256(_mm256_or_si256(_mm256_or_si256(upper, lower), digit), _mm256_or_si256(is62, is63));
+		if(_mm256_movemask_epi8(valid) != -1) {
+			break;
+		}
+
+		__m256i values = _mm256_add_epi8(c, _mm256_or_si256(_mm256_or_si256(
+				_mm256_and_si256(upper, _mm256_set1_epi8(-'A')),
+				_mm256_and_si256(lower, _mm256_set1_epi8(26 - 'a'))),
+				_mm256_and_si256(digit, _mm256_set1_epi8(52 - '0'))));
+		values = _mm256_blendv_epi8(values, _mm256_set1_epi8(62), is62);
+		values = _mm256_blendv_epi8(values, _mm256_set1_epi8(63), is63);
+
+		/* merge 4 values of 6 bit to 24 bit and move them in big endian order to the front of each lane */
+		__m256i merged = _mm256_maddubs_epi16(values, _mm256_set1_epi32(0x01400140));
+		merged = _mm256_madd_epi16(merged, _mm256_set1_epi32(0x00011000));
+		merged = _mm256_shuffle_epi8(merged, shuffle);
+
+		std::uint8_t buffer[28];
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(buffer), _mm256_castsi256_si128(merged));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(buffer + 12), _mm256_extracti128_si256(merged, 1));
+		std::memcpy(out + pos / 4 * 3, buffer, 24);
+	}
+
+	return pos;
+}
+
+__attribute__((target("ssse3")))
+std::size_t encodeBase16SSSE3(const std::uint8_t* in, std::size_t size, char* out) noexcept {
+	const __m128i chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(base16Chars));
+	const __m128i mask = _mm_set1_epi8(0x0f);
+	std::size_t pos = 0;
+
+	for(; pos + 16 <= size; pos += 16) {
+		const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(in + pos));
+		const __m128i hi = _mm_shuffle_epi8(chars, _mm_and_si128(_mm_srli_epi16(v, 4), mask));
+		const __m128i lo = _mm_shuffle_epi8(chars, _mm_and_si128(v, mask));
+
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(out + 2*pos), _mm_unpacklo_epi8(hi, lo));
+		_mm_storeu_si128(reinterpret_cast<__m128i*>(out + 2*pos + 16), _mm_unpackhi_epi8(hi, lo));
+	}
+
+	return pos;
+}
+#endif
+}
+
+std::size_t Codec::encodeBase64Groups(const std::uint8_t* in, std::size_t size, char* out, bool url) noexcept {
+	std::size_t pos = 0;
+
+#ifdef COMMON4ESL_UTILITY_CODEC_X86
+	if(hasAVX2()) {
+		pos = encodeBase64GroupsAVX2(in, size, out, url);
+	}
+#endif
+
+	return pos / 3 * 4 + encodeBase64GroupsScalar(in + pos, size - pos, out + pos / 3 * 4, url);
+}
+
+std::size_t Codec::encodeBase64Tail(const std::uint8_t* in, std::size_t size, char* out, bool url, bool withPadding) noexcept {
+	if(size == 0) {
+		return 0;
+	}
+
+	const char* chars = url ? base64urlChars : base64Chars;
+	std::uint32_t packed = static_cast<std::uint32_t>(in[0]) << 16;
+	if(size > 1) {
+		packed |= static_cast<std::uint32_t>(in[1]) << 8;
+	}
+
+	char* outBegin = out;
+	*out++ = chars[packed >> 18];
+	*out++ = chars[(packed >> 12) & 0x3f];
+	if(size > 1) {
+		*out++ = chars[(packed >> 6) & 0x3f];
+	}
+
+	if(withPadding) {
+		for(std::size_t i = size; i < 3; ++i) {
+			if(url) {
+				*out++ = '%';
+				*out++ = '3';
+				*out++ = 'd';
+			}
+			else {
+				*out++ = '=';
+			}
+		}
+	}
+
+	return static_cast<std::size_t>(out - outBegin);
+}
+
+std::size_t Codec::getBase64Size(std::size_t size, bool url, bool withPadding) noexcept {
+	std::size_t rest = size % 3;
+	std::size_t rv = size / 3 * 4;
+
+	if(rest > 0) {
+		rv += rest + 1;
+		if(withPadding) {
+			rv += (3 - rest) * (url ? 3 : 1);
+		}
+	}
+
+	return rv;
+}
+
+std::size_t Codec::decodeBase64Groups(const char* in, std::size_t size, std::uint8_t* out) noexcept {
+	std::size_t pos = 0;
+
+#ifdef COMMON4ESL_UTILITY_CODEC_X86
+	if(hasAVX2()) {
+		pos = decodeBase64GroupsAVX2(in, size, out);
+	}
+#endif
+
+	return pos + decodeBase64GroupsScalar(in + pos, size - pos, out + pos / 4 * 3);
+}
+
+std::size_t Codec::decodeBase64Tail(const char* in, std::size_t size, std::uint8_t* out) noexcept {
+	std::uint32_t packed = 0;
+
+	for(std::size_t i = 0; i < size && i < 3; ++i) {
+		int value = getBase64Value(in[i]);
+		packed |= static_cast<std::uint32_t>(value < 0 ? 0 : value) << (18 - 6 * i);
+	}
+
+	for(std::size_t i = 1; i < size && i < 4; ++i) {
+		out[i-1] = static_cast<std::uint8_t>(packed >> (24 - 8 * i));
+	}
+
+	return size > 1 ? size - 1 : 0;
+}
+
+int Codec::getBase64Value(char c) noexcept {
+	return tables.base64Values[static_cast<unsigned char>(c)];
+}
+
+void Codec::encodeBase16(const std::uint8_t* in, std::size_t size, char* out) noexcept {
+	std::size_t pos = 0;
+
+#ifdef COMMON4ESL_UTILITY_CODEC_X86
+	if(hasSSSE3()) {
+		pos = encodeBase16SSSE3(in, size, out);
+	}
+#endif
+
+	encodeBase16Scalar(in + pos, size - pos, out + 2 * pos);
+}
+
+int Codec::getBase16Value(char c) noexcept {
+	return tables.base16Values[static_cast<unsigned char>(c)];
+}
+
+bool Codec::isURLUnreserved(char c) noexcept {
+	return tables.urlUnreserved[static_cast<unsigned char>(c)];
+}
+
+} /* namespace utility */
+} /* inline namespace v1_6 */
+} /* namespace common4esl */
@@ -0,0 +1,51 @@
+#ifndef COMMON4ESL_UTILITY_CODEC_H_
+#define COMMON4ESL_UTILITY_CODEC_H_
+
+#include <cstddef>
+#include <cstdint>
+
+namespace common4esl {
+inline namespace v1_6 {
+namespace utility {
+
+/* Raw buffer kernels of the string codecs. The caller provides an output buffer of the exact size.
+ * On x86-64 the bulk of Base64 is done by AVX2 and Base16 by SSSE3, if the CPU supports it. */
+class Codec {
+public:
+	Codec() = delete;
+
+	/* encodes size/3 complete groups and returns the number of characters written (4 per group) */
+	static std::size_t encodeBase64Groups(const std::uint8_t* in, std::size_t size, char* out, bool url) noexcept;
+
+	/* encodes the remaining 1 or 2 bytes and returns the number of characters written.
+	 * Padding is "=" for base64 and "%3d" for base64url. */
+	static std::size_t encodeBase64Tail(const std::uint8_t* in, std::size_t size, char* out, bool url, bool withPadding) noexcept;
+
+	/* returns the number of characters encodeBase64Groups and encodeBase64Tail write together for size bytes */
+	static std::size_t getBase64Size(std::size_t size, bool url, bool withPadding) noexcept;
+
+	/* decodes complete groups of 4 characters of both alphabets up to the first other character.
+	 * returns the number of characters consumed (a multiple of 4) and writes 3 bytes per group. */
+	static std::size_t decodeBase64Groups(const char* in, std::size_t size, std::uint8_t* out) noexcept;
+
+	/* decodes 1 to 3 characters of an incomplete group and returns the number of bytes written (size-1) */
+	static std::size_t decodeBase64Tail(const char* in, std::size_t size, std::uint8_t* out) noexcept;
+
+	/* returns the 6 bit value of a character of both alphabets or -1 */
+	static int getBase64Value(char c) noexcept;
+
+	/* writes 2 lower case hex digits per byte */
+	static void encodeBase16(const std::uint8_t* in, std::size_t size, char* out) noexcept;
+
+	/* returns the value of a hex digit or -1 */
+	static int getBase16Value(char c) noexcept;
+
+	/* returns true for the unreserved characters of RFC 3986 that are not URL encoded */
+	static bool isURLUnreserved(char c) noexcept;
+};
+
+} /* namespace utility */
+} /* inline namespace v1_6 */
+} /* namespace common4esl */
+
+#endif /* COMMON4ESL_UTILITY_CODEC_H_ */
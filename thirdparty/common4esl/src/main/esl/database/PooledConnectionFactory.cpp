@@ -0,0 +1,118 @@
+/*
+MIT License
+Copyright (c) 2019-2025 Sven Lukas
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <esl/database/PooledConnectionFactory.h>
+
+#include <common4esl/database/PooledConnectionFactory.h>
+
+#include <esl/system/Stacktrace.h>
+#include <esl/utility/String.h>
+
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+
+namespace esl {
+inline namespace v1_6 {
+namespace database {
+
+namespace {
+/* durations are limited, because time points calculated by the pool must not overflow */
+constexpr long long maxMilliseconds = std::numeric_limits<std::int32_t>::max();
+
+long long toNumber(const std::pair<std::string, std::string>& setting, long long maxValue) {
+	long long value = -1;
+	try {
+		value = utility::String::toNumber<long long>(setting.second);
+	}
+	catch(const std::invalid_argument&) {
+	}
+	catch(const std::out_of_range&) {
+	}
+
+	if(value < 0 || value > maxValue) {
+		throw system::Stacktrace::add(std::runtime_error("Invalid value \"" + setting.second + "\" of parameter key \"" + setting.first + "\" for PooledConnectionFactory"));
+	}
+	return value;
+}
+} /* anonymous namespace */
+
+PooledConnectionFactory::Settings::Settings(const std::vector<std::pair<std::string, std::string>>& settings) {
+	bool hasMaxSize = false;
+	bool hasIdleTimeout = false;
+	bool hasTimeout = false;
+	bool hasValidationQuery = false;
+
+	for(auto const& setting : settings) {
+		if(setting.first == "max-size") {
+			if(hasMaxSize) {
+				throw system::Stacktrace::add(std::runtime_error("Multiple definition of parameter key \"" + setting.first + "\" for PooledConnectionFactory"));
+			}
+			hasMaxSize = true;
+			maxSize = static_cast<std::size_t>(toNumber(setting, std::numeric_limits<long long>::max()));
+		}
+		else if(setting.first == "idle-timeout") {
+			if(hasIdleTimeout) {
+				throw system::Stacktrace::add(std::runtime_error("Multiple definition of parameter key \"" + setting.first + "\" for PooledConnectionFactory"));
+			}
+			hasIdleTimeout = true;
+			idleTimeout = std::chrono::milliseconds(toNumber(setting, maxMilliseconds));
+		}
+		else if(setting.first == "timeout") {
+			if(hasTimeout) {
+				throw system::Stacktrace::add(std::runtime_error("Multiple definition of parameter key \"" + setting.first + "\" for PooledConnectionFactory"));
+			}
+			hasTimeout = true;
+			timeout = std::chrono::milliseconds(toNumber(setting, maxMilliseconds));
+		}
+		else if(setting.first == "validation-query") {
+			if(hasValidationQuery) {
+				throw system::Stacktrace::add(std::runtime_error("Multiple definition of parameter key \"" + setting.first + "\" for PooledConnectionFactory"));
+			}
+			hasValidationQuery = true;
+			validationQuery = setting.second;
+		}
+		else {
+			throw system::Stacktrace::add(std::runtime_error("Invalid parameter key \"" + setting.first + "\" for PooledConnectionFactory"));
+		}
+	}
+
+	if(hasTimeout && maxSize == 0) {
+		throw system::Stacktrace::add(std::runtime_error("Parameter key \"timeout\" requires parameter key \"max-size\" for PooledConnectionFactory"));
+	}
+}
+
+PooledConnectionFactory::PooledConnectionFactory(const Settings& settings, std::unique_ptr<ConnectionFactory> aConnectionFactory)
+: connectionFactory(new common4esl::database::PooledConnectionFactory(settings, std::move(aConnectionFactory)))
+{ }
+
+std::unique_ptr<Connection> PooledConnectionFactory::createConnection() {
+	return connectionFactory->createConnection();
+}
+
+PooledConnectionFactory::Statistics PooledConnectionFactory::getStatistics() const {
+	return static_cast<const common4esl::database::PooledConnectionFactory&>(*connectionFactory).getStatistics();
+}
+
+} /* namespace database */
+} /* inline namespace v1_6 */
+} /* namespace esl */
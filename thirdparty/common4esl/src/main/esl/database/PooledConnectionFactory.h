@@ -0,0 +1,87 @@
+/*
+MIT License
+Copyright (c) 2019-2025 Sven Lukas
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef ESL_DATABASE_POOLEDCONNECTIONFACTORY_H_
+#define ESL_DATABASE_POOLEDCONNECTIONFACTORY_H_
+
+#include <esl/database/Connection.h>
+#include <esl/database/ConnectionFactory.h>
+
+#include <chrono>
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace esl {
+inline namespace v1_6 {
+namespace database {
+
+/* PooledConnectionFactory is a decorator for another connection factory.
+ * Connections returned by createConnection() are borrowed from a pool and given back when they are destroyed.
+ * Open transactions are rolled back before a connection is given back. */
+class PooledConnectionFactory : public ConnectionFactory {
+public:
+	struct Settings {
+		Settings() = default;
+		Settings(const std::vector<std::pair<std::string, std::string>>& settings);
+
+		/* maximum number of connections borrowed at the same time. 0 means unlimited. */
+		std::size_t maxSize = 0;
+
+		/* connections are closed if they have not been used for this time. 0 means they are never closed. */
+		std::chrono::milliseconds idleTimeout = std::chrono::milliseconds(0);
+
+		/* maximum time createConnection() waits for a free connection before it throws. 0 means wait forever. */
+		std::chrono::milliseconds timeout = std::chrono::milliseconds(0);
+
+		/* If not empty, this statement is executed before a pooled connection is reused.
+		 * The connection gets replaced by a new one if the statement fails. */
+		std::string validationQuery;
+	};
+
+	struct Statistics {
+		std::size_t checkouts = 0;
+		std::size_t creates = 0;
+		std::size_t validationFailures = 0;
+		std::size_t timeouts = 0;
+
+		/* accumulated time spent in createConnection() waiting for a free connection */
+		std::chrono::nanoseconds waitTime = std::chrono::nanoseconds(0);
+	};
+
+	PooledConnectionFactory(const Settings& settings, std::unique_ptr<ConnectionFactory> connectionFactory);
+
+	std::unique_ptr<Connection> createConnection() override;
+
+	Statistics getStatistics() const;
+
+private:
+	std::unique_ptr<ConnectionFactory> connectionFactory;
+};
+
+} /* namespace database */
+} /* inline namespace v1_6 */
+} /* namespace esl */
+
+#endif /* ESL_DATABASE_POOLEDCONNECTIONFACTORY_H_ */
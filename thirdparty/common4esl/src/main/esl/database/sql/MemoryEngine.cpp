@@ -0,0 +1,53 @@
+/*
+MIT License
+Copyright (c) 2019-2025 Sven Lukas
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <esl/database/sql/MemoryEngine.h>
+
+#include <common4esl/database/sql/Engine.h>
+
+#include <utility>
+
+namespace esl {
+inline namespace v1_6 {
+namespace database {
+namespace sql {
+
+MemoryEngine::MemoryEngine()
+: engine(new common4esl::database::sql::Engine)
+{ }
+
+std::unique_ptr<Engine> MemoryEngine::create() {
+	return std::unique_ptr<Engine>(new MemoryEngine);
+}
+
+void MemoryEngine::addTables(const std::string& id, std::unique_ptr<table::Tables> tables) {
+	engine->addTables(id, std::move(tables));
+}
+
+std::unique_ptr<ConnectionFactory> MemoryEngine::createConnectionFactory() {
+	return engine->createConnectionFactory();
+}
+
+} /* namespace sql */
+} /* namespace database */
+} /* inline namespace v1_6 */
+} /* namespace esl */
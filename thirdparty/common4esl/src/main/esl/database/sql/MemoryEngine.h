@@ -0,0 +1,60 @@
+/*
+MIT License
+Copyright (c) 2019-2025 Sven Lukas
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef ESL_DATABASE_SQL_MEMORYENGINE_H_
+#define ESL_DATABASE_SQL_MEMORYENGINE_H_
+
+#include <esl/database/ConnectionFactory.h>
+#include <esl/database/sql/Engine.h>
+#include <esl/database/table/Tables.h>
+
+#include <memory>
+#include <string>
+
+namespace esl {
+inline namespace v1_6 {
+namespace database {
+namespace sql {
+
+/* MemoryEngine executes SELECT statements in process over tables of table::Tables, e.g. table::MemoryTables
+ * or table::ConnectionFactoryTables. Filters are pushed down into the scans of the tables, projections and
+ * aggregations (COUNT, SUM, AVG, MIN, MAX with GROUP BY) are computed batch by batch column by column.
+ * Tables are referred as "table" or as "id.table" if more tables with this name have been added. */
+class MemoryEngine : public Engine {
+public:
+	MemoryEngine();
+
+	static std::unique_ptr<Engine> create();
+
+	void addTables(const std::string& id, std::unique_ptr<table::Tables> tables) override;
+	std::unique_ptr<ConnectionFactory> createConnectionFactory() override;
+
+private:
+	std::unique_ptr<Engine> engine;
+};
+
+} /* namespace sql */
+} /* namespace database */
+} /* inline namespace v1_6 */
+} /* namespace esl */
+
+#endif /* ESL_DATABASE_SQL_MEMORYENGINE_H_ */
@@ -0,0 +1,153 @@
+/*
+MIT License
+Copyright (c) 2019-2025 Sven Lukas
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <esl/database/table/ConnectionFactoryTables.h>
+#include <esl/database/Connection.h>
+#include <esl/database/PreparedStatement.h>
+#include <esl/database/ResultSet.h>
+#include <esl/system/Stacktrace.h>
+
+#include <algorithm>
+#include <stdexcept>
+#include <utility>
+
+namespace esl {
+inline namespace v1_6 {
+namespace database {
+namespace table {
+
+namespace {
+
+class ConnectionFactoryScan : public Tables::Scan {
+public:
+	ConnectionFactoryScan(std::unique_ptr<Connection> aConnection, const std::string& sql, const std::vector<Field>& parameters)
+	: connection(std::move(aConnection)),
+	  preparedStatement(connection->prepare(sql)),
+	  resultSet(preparedStatement.execute(parameters))
+	{ }
+
+	std::size_t fetchBatch(ResultBatch& batch, std::size_t maxRows) override {
+		return resultSet.fetchBatch(batch, maxRows);
+	}
+
+private:
+	std::unique_ptr<Connection> connection;
+	PreparedStatement preparedStatement;
+	ResultSet resultSet;
+};
+
+const char* toSql(Tables::Predicate::Operator op) {
+	switch(op) {
+	case Tables::Predicate::Operator::equal:
+		return " = ?";
+	case Tables::Predicate::Operator::notEqual:
+		return " <> ?";
+	case Tables::Predicate::Operator::less:
+		return " < ?";
+	case Tables::Predicate::Operator::lessEqual:
+		return " <= ?";
+	case Tables::Predicate::Operator::greater:
+		return " > ?";
+	case Tables::Predicate::Operator::greaterEqual:
+		return " >= ?";
+	case Tables::Predicate::Operator::isNull:
+		return " IS NULL";
+	case Tables::Predicate::Operator::isNotNull:
+		return " IS NOT NULL";
+	}
+	return "";
+}
+
+} /* anonymous namespace */
+
+ConnectionFactoryTables::ConnectionFactoryTables(std::unique_ptr<ConnectionFactory> aConnectionFactory, const std::vector<std::string>& aTableNames)
+: connectionFactory(std::move(aConnectionFactory)),
+  tableNames(aTableNames)
+{
+	if(!connectionFactory) {
+        throw system::Stacktrace::add(std::runtime_error("ConnectionFactoryTables requires a connection factory"));
+	}
+}
+
+std::vector<std::string> ConnectionFactoryTables::getTableNames() const {
+	return tableNames;
+}
+
+std::vector<Column> ConnectionFactoryTables::getColumns(const std::string& tableName) const {
+	checkTableName(tableName);
+
+	std::lock_guard<std::mutex> columnsLock(columnsMutex);
+
+	auto iter = columnsByTableName.find(tableName);
+	if(iter == columnsByTableName.end()) {
+		std::unique_ptr<Connection> connection = connectionFactory->createConnection();
+		if(!connection) {
+	        throw system::Stacktrace::add(std::runtime_error("Cannot create connection to get columns of table \"" + tableName + "\""));
+		}
+		iter = columnsByTableName.emplace(tableName, connection->prepare("SELECT * FROM " + tableName).getResultColumns()).first;
+	}
+	return iter->second;
+}
+
+std::unique_ptr<Tables::Scan> ConnectionFactoryTables::scan(const std::string& tableName, const std::vector<std::size_t>& columns, const std::vector<Predicate>& predicates) const {
+	std::vector<Column> tableColumns = getColumns(tableName);
+
+	std::string sql = "SELECT ";
+	for(std::size_t i = 0; i < columns.size(); ++i) {
+		if(columns[i] >= tableColumns.size()) {
+	        throw system::Stacktrace::add(std::out_of_range("column index " + std::to_string(columns[i]) + " is out of range. Table \"" + tableName + "\" has " + std::to_string(tableColumns.size()) + " columns."));
+		}
+		sql += (i == 0 ? "" : ", ") + tableColumns[columns[i]].getName();
+	}
+	if(columns.empty()) {
+		sql += "1";
+	}
+	sql += " FROM " + tableName;
+
+	std::vector<Field> parameters;
+	for(std::size_t i = 0; i < predicates.size(); ++i) {
+		if(predicates[i].columnIndex >= tableColumns.size()) {
+	        throw system::Stacktrace::add(std::out_of_range("column index " + std::to_string(predicates[i].columnIndex) + " is out of range. Table \"" + tableName + "\" has " + std::to_string(tableColumns.size()) + " columns."));
+		}
+		sql += (i == 0 ? " WHERE " : " AND ") + tableColumns[predicates[i].columnIndex].getName() + toSql(predicates[i].op);
+		if(predicates[i].op != Predicate::Operator::isNull && predicates[i].op != Predicate::Operator::isNotNull) {
+			parameters.push_back(predicates[i].value);
+		}
+	}
+
+	std::unique_ptr<Connection> connection = connectionFactory->createConnection();
+	if(!connection) {
+        throw system::Stacktrace::add(std::runtime_error("Cannot create connection to scan table \"" + tableName + "\""));
+	}
+	return std::unique_ptr<Scan>(new ConnectionFactoryScan(std::move(connection), sql, parameters));
+}
+
+void ConnectionFactoryTables::checkTableName(const std::string& tableName) const {
+	if(std::find(tableNames.begin(), tableNames.end(), tableName) == tableNames.end()) {
+        throw system::Stacktrace::add(std::runtime_error("Table \"" + tableName + "\" is not defined"));
+	}
+}
+
+} /* namespace table */
+} /* namespace database */
+} /* inline namespace v1_6 */
+} /* namespace esl */
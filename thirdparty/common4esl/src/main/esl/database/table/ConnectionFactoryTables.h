@@ -0,0 +1,66 @@
+/*
+MIT License
+Copyright (c) 2019-2025 Sven Lukas
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef ESL_DATABASE_TABLE_CONNECTIONFACTORYTABLES_H_
+#define ESL_DATABASE_TABLE_CONNECTIONFACTORYTABLES_H_
+
+#include <esl/database/Column.h>
+#include <esl/database/ConnectionFactory.h>
+#include <esl/database/table/Tables.h>
+
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace esl {
+inline namespace v1_6 {
+namespace database {
+namespace table {
+
+/* Tables of another database. A scan is executed as SELECT statement with the predicates in its WHERE clause,
+ * so rows are filtered by that database. Columns of a table are read once and cached. */
+class ConnectionFactoryTables : public Tables {
+public:
+	ConnectionFactoryTables(std::unique_ptr<ConnectionFactory> connectionFactory, const std::vector<std::string>& tableNames);
+
+	std::vector<std::string> getTableNames() const override;
+	std::vector<Column> getColumns(const std::string& tableName) const override;
+	std::unique_ptr<Scan> scan(const std::string& tableName, const std::vector<std::size_t>& columns, const std::vector<Predicate>& predicates) const override;
+
+private:
+	std::unique_ptr<ConnectionFactory> connectionFactory;
+	std::vector<std::string> tableNames;
+
+	mutable std::mutex columnsMutex;
+	mutable std::map<std::string, std::vector<Column>> columnsByTableName;
+
+	void checkTableName(const std::string& tableName) const;
+};
+
+} /* namespace table */
+} /* namespace database */
+} /* inline namespace v1_6 */
+} /* namespace esl */
+
+#endif /* ESL_DATABASE_TABLE_CONNECTIONFACTORYTABLES_H_ */
@@ -0,0 +1,430 @@
+/*
+MIT License
+Copyright (c) 2019-2025 Sven Lukas
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <esl/database/table/MemoryTables.h>
+#include <esl/system/Stacktrace.h>
+#include <esl/utility/CSV.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <stdexcept>
+#include <string_view>
+#include <utility>
+
+namespace esl {
+inline namespace v1_6 {
+namespace database {
+namespace table {
+
+namespace {
+
+/* removes all rows from "selection" that are NULL or where "matches" returns false */
+template<typename Matches>
+void filterRows(std::vector<std::size_t>& selection, const ResultBatch::Array& array, Matches matches) {
+	std::size_t count = 0;
+	if(array.hasNulls()) {
+		for(auto row : selection) {
+			if(!array.isNull(row) && matches(row)) {
+				selection[count++] = row;
+			}
+		}
+	}
+	else {
+		for(auto row : selection) {
+			if(matches(row)) {
+				selection[count++] = row;
+			}
+		}
+	}
+	selection.resize(count);
+}
+
+template<typename Get, typename Value>
+void filterCompare(std::vector<std::size_t>& selection, const ResultBatch::Array& array, Tables::Predicate::Operator op, Get get, const Value& value) {
+	switch(op) {
+	case Tables::Predicate::Operator::equal:
+		filterRows(selection, array, [&](std::size_t row) { return get(row) == value; });
+		break;
+	case Tables::Predicate::Operator::notEqual:
+		filterRows(selection, array, [&](std::size_t row) { return get(row) != value; });
+		break;
+	case Tables::Predicate::Operator::less:
+		filterRows(selection, array, [&](std::size_t row) { return get(row) < value; });
+		break;
+	case Tables::Predicate::Operator::lessEqual:
+		filterRows(selection, array, [&](std::size_t row) { return get(row) <= value; });
+		break;
+	case Tables::Predicate::Operator::greater:
+		filterRows(selection, array, [&](std::size_t row) { return get(row) > value; });
+		break;
+	case Tables::Predicate::Operator::greaterEqual:
+		filterRows(selection, array, [&](std::size_t row) { return get(row) >= value; });
+		break;
+	default:
+		break;
+	}
+}
+
+void filter(std::vector<std::size_t>& selection, const ResultBatch::Array& array, const Tables::Predicate& predicate) {
+	if(predicate.op == Tables::Predicate::Operator::isNull || predicate.op == Tables::Predicate::Operator::isNotNull) {
+		bool isNull = predicate.op == Tables::Predicate::Operator::isNull;
+		std::size_t count = 0;
+		for(auto row : selection) {
+			if(array.isNull(row) == isNull) {
+				selection[count++] = row;
+			}
+		}
+		selection.resize(count);
+		return;
+	}
+
+	if(predicate.value.isNull()) {
+		selection.clear();
+		return;
+	}
+
+	switch(array.getStorage()) {
+	case ResultBatch::Storage::integer: {
+		const std::int64_t* integers = array.getIntegers();
+		if(predicate.value.getSimpleType() == Field::Type::storageDouble || predicate.value.getSimpleType() == Field::Type::storageString) {
+			filterCompare(selection, array, predicate.op, [integers](std::size_t row) { return static_cast<double>(integers[row]); }, predicate.value.asDouble());
+		}
+		else {
+			filterCompare(selection, array, predicate.op, [integers](std::size_t row) { return integers[row]; }, predicate.value.asInteger());
+		}
+		break;
+	}
+	case ResultBatch::Storage::real: {
+		const double* doubles = array.getDoubles();
+		filterCompare(selection, array, predicate.op, [doubles](std::size_t row) { return doubles[row]; }, predicate.value.asDouble());
+		break;
+	}
+	case ResultBatch::Storage::string: {
+		const std::size_t* offsets = array.getStringOffsets();
+		const char* data = array.getStringData();
+		std::string value = predicate.value.asString();
+		filterCompare(selection, array, predicate.op, [offsets, data](std::size_t row) { return std::string_view(data + offsets[row], offsets[row+1] - offsets[row]); }, std::string_view(value));
+		break;
+	}
+	}
+}
+
+void copyRows(ResultBatch::Array& to, const ResultBatch::Array& from, const std::vector<std::size_t>& rows) {
+	switch(from.getStorage()) {
+	case ResultBatch::Storage::integer: {
+		const std::int64_t* integers = from.getIntegers();
+		for(auto row : rows) {
+			if(from.isNull(row)) {
+				to.addNull();
+			}
+			else {
+				to.addInteger(integers[row]);
+			}
+		}
+		break;
+	}
+	case ResultBatch::Storage::real: {
+		const double* doubles = from.getDoubles();
+		for(auto row : rows) {
+			if(from.isNull(row)) {
+				to.addNull();
+			}
+			else {
+				to.addDouble(doubles[row]);
+			}
+		}
+		break;
+	}
+	case ResultBatch::Storage::string: {
+		const std::size_t* offsets = from.getStringOffsets();
+		const char* data = from.getStringData();
+		for(auto row : rows) {
+			if(from.isNull(row)) {
+				to.addNull();
+			}
+			else {
+				to.addString(data + offsets[row], offsets[row+1] - offsets[row]);
+			}
+		}
+		break;
+	}
+	}
+}
+
+class MemoryScan : public Tables::Scan {
+public:
+	MemoryScan(const std::vector<ResultBatch::Array>& aArrays, std::size_t aRowCount, const std::vector<std::size_t>& aColumns, const std::vector<Tables::Predicate>& aPredicates)
+	: arrays(aArrays),
+	  rowCount(aRowCount),
+	  columns(aColumns),
+	  predicates(aPredicates)
+	{ }
+
+	std::size_t fetchBatch(ResultBatch& batch, std::size_t maxRows) override {
+		batch.reset(columns.size());
+		for(std::size_t i = 0; i < columns.size(); ++i) {
+			if(batch[i].getStorage() != arrays[columns[i]].getStorage()) {
+				batch[i].setStorage(arrays[columns[i]].getStorage());
+			}
+		}
+
+		std::size_t count = 0;
+		while(count < maxRows && position < rowCount) {
+			std::size_t end = std::min(rowCount, position + (maxRows - count));
+
+			selection.clear();
+			for(; position < end; ++position) {
+				selection.push_back(position);
+			}
+
+			for(const auto& predicate : predicates) {
+				filter(selection, arrays[predicate.columnIndex], predicate);
+				if(selection.empty()) {
+					break;
+				}
+			}
+
+			for(std::size_t i = 0; i < columns.size(); ++i) {
+				copyRows(batch[i], arrays[columns[i]], selection);
+			}
+			count += selection.size();
+		}
+
+		return count;
+	}
+
+private:
+	const std::vector<ResultBatch::Array>& arrays;
+	const std::size_t rowCount;
+	const std::vector<std::size_t> columns;
+	const std::vector<Tables::Predicate> predicates;
+
+	std::size_t position = 0;
+	std::vector<std::size_t> selection;
+};
+
+bool isInteger(const std::string& str) {
+	char* end = nullptr;
+	errno = 0;
+	std::strtoll(str.c_str(), &end, 10);
+	return errno == 0 && end != str.c_str() && *end == 0;
+}
+
+bool isDouble(const std::string& str) {
+	char* end = nullptr;
+	errno = 0;
+	std::strtod(str.c_str(), &end);
+	return errno == 0 && end != str.c_str() && *end == 0;
+}
+
+} /* anonymous namespace */
+
+void MemoryTables::addTable(const std::string& tableName, const std::vector<Column>& columns) {
+	if(tables.find(tableName) != tables.end()) {
+        throw system::Stacktrace::add(std::runtime_error("Table \"" + tableName + "\" is already defined"));
+	}
+
+	Table& table = tables[tableName];
+	table.columns = columns;
+	table.arrays.resize(columns.size());
+	for(std::size_t i = 0; i < columns.size(); ++i) {
+		table.arrays[i].setStorage(ResultBatch::getStorage(columns[i].getType()));
+	}
+}
+
+void MemoryTables::addCSV(const std::string& tableName, const std::string& filename, char separator) {
+	std::ifstream file(filename);
+	if(!file.good()) {
+        throw system::Stacktrace::add(std::runtime_error("Cannot open CSV file \"" + filename + "\""));
+	}
+
+	utility::CSV csv(separator);
+	std::vector<std::string> names;
+	std::vector<std::vector<std::string>> rows;
+
+	std::string line;
+	for(std::size_t lineNo = 1; std::getline(file, line); ++lineNo) {
+		if(!line.empty() && line.back() == '\r') {
+			line.pop_back();
+		}
+
+		if(lineNo == 1) {
+			names = csv.splitRow(line);
+			continue;
+		}
+		if(line.empty()) {
+			continue;
+		}
+
+		rows.push_back(csv.splitRow(line));
+		if(rows.back().size() != names.size()) {
+	        throw system::Stacktrace::add(std::runtime_error("Line " + std::to_string(lineNo) + " of CSV file \"" + filename + "\" has " + std::to_string(rows.back().size()) + " values but " + std::to_string(names.size()) + " columns are defined"));
+		}
+	}
+
+	std::vector<Column> columns;
+	for(std::size_t i = 0; i < names.size(); ++i) {
+		bool allIntegers = true;
+		bool allDoubles = true;
+		for(const auto& row : rows) {
+			if(row[i].empty()) {
+				continue;
+			}
+			allIntegers = allIntegers && isInteger(row[i]);
+			allDoubles = allDoubles && (allIntegers || isDouble(row[i]));
+			if(!allDoubles) {
+				break;
+			}
+		}
+
+		Column::Type type = allIntegers ? Column::Type::sqlInteger : allDoubles ? Column::Type::sqlDouble : Column::Type::sqlVarChar;
+		columns.emplace_back(names[i], type, true, 0, 0, 0, 0, 0);
+	}
+
+	addTable(tableName, columns);
+
+	Table& table = tables[tableName];
+	for(std::size_t i = 0; i < names.size(); ++i) {
+		ResultBatch::Array& array = table.arrays[i];
+		array.reserve(rows.size());
+		for(const auto& row : rows) {
+			if(row[i].empty()) {
+				array.addNull();
+			}
+			else if(array.getStorage() == ResultBatch::Storage::integer) {
+				array.addInteger(std::strtoll(row[i].c_str(), nullptr, 10));
+			}
+			else if(array.getStorage() == ResultBatch::Storage::real) {
+				array.addDouble(std::strtod(row[i].c_str(), nullptr));
+			}
+			else {
+				array.addString(row[i].data(), row[i].size());
+			}
+		}
+	}
+	table.rowCount = rows.size();
+}
+
+void MemoryTables::addRow(const std::string& tableName, const std::vector<Field>& fields) {
+	auto iter = tables.find(tableName);
+	if(iter == tables.end()) {
+        throw system::Stacktrace::add(std::runtime_error("Table \"" + tableName + "\" is not defined"));
+	}
+
+	Table& table = iter->second;
+	if(fields.size() != table.columns.size()) {
+        throw system::Stacktrace::add(std::runtime_error("Wrong number of fields. Given " + std::to_string(fields.size()) + " fields, but table \"" + tableName + "\" has " + std::to_string(table.columns.size()) + " columns."));
+	}
+
+	/* Convert all fields first. If a field cannot be converted to the type of its column,
+	 * no array has been extended and the columns keep the same number of rows. */
+	std::vector<std::int64_t> integers(fields.size());
+	std::vector<double> doubles(fields.size());
+	std::vector<std::string> strings(fields.size());
+	for(std::size_t i = 0; i < fields.size(); ++i) {
+		if(fields[i].isNull()) {
+			continue;
+		}
+
+		switch(table.arrays[i].getStorage()) {
+		case ResultBatch::Storage::integer:
+			integers[i] = fields[i].asInteger();
+			break;
+		case ResultBatch::Storage::real:
+			doubles[i] = fields[i].asDouble();
+			break;
+		case ResultBatch::Storage::string:
+			strings[i] = fields[i].asString();
+			break;
+		}
+	}
+
+	for(std::size_t i = 0; i < fields.size(); ++i) {
+		ResultBatch::Array& array = table.arrays[i];
+		if(fields[i].isNull()) {
+			array.addNull();
+			continue;
+		}
+
+		switch(array.getStorage()) {
+		case ResultBatch::Storage::integer:
+			array.addInteger(integers[i]);
+			break;
+		case ResultBatch::Storage::real:
+			array.addDouble(doubles[i]);
+			break;
+		case ResultBatch::Storage::string:
+			array.addString(strings[i].data(), strings[i].size());
+			break;
+		}
+	}
+	++table.rowCount;
+}
+
+std::size_t MemoryTables::getRowCount(const std::string& tableName) const {
+	return getTable(tableName).rowCount;
+}
+
+std::vector<std::string> MemoryTables::getTableNames() const {
+	std::vector<std::string> tableNames;
+	for(const auto& table : tables) {
+		tableNames.push_back(table.first);
+	}
+	return tableNames;
+}
+
+std::vector<Column> MemoryTables::getColumns(const std::string& tableName) const {
+	return getTable(tableName).columns;
+}
+
+std::unique_ptr<Tables::Scan> MemoryTables::scan(const std::string& tableName, const std::vector<std::size_t>& columns, const std::vector<Predicate>& predicates) const {
+	const Table& table = getTable(tableName);
+
+	for(auto column : columns) {
+		if(column >= table.columns.size()) {
+	        throw system::Stacktrace::add(std::out_of_range("column index " + std::to_string(column) + " is out of range. Table \"" + tableName + "\" has " + std::to_string(table.columns.size()) + " columns."));
+		}
+	}
+	for(const auto& predicate : predicates) {
+		if(predicate.columnIndex >= table.columns.size()) {
+	        throw system::Stacktrace::add(std::out_of_range("column index " + std::to_string(predicate.columnIndex) + " is out of range. Table \"" + tableName + "\" has " + std::to_string(table.columns.size()) + " columns."));
+		}
+	}
+
+	return std::unique_ptr<Scan>(new MemoryScan(table.arrays, table.rowCount, columns, predicates));
+}
+
+const MemoryTables::Table& MemoryTables::getTable(const std::string& tableName) const {
+	auto iter = tables.find(tableName);
+	if(iter == tables.end()) {
+        throw system::Stacktrace::add(std::runtime_error("Table \"" + tableName + "\" is not defined"));
+	}
+	return iter->second;
+}
+
+} /* namespace table */
+} /* namespace database */
+} /* inline namespace v1_6 */
+} /* namespace esl */
@@ -0,0 +1,79 @@
+/*
+MIT License
+Copyright (c) 2019-2025 Sven Lukas
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#ifndef ESL_DATABASE_TABLE_MEMORYTABLES_H_
+#define ESL_DATABASE_TABLE_MEMORYTABLES_H_
+
+#include <esl/database/Column.h>
+#include <esl/database/Field.h>
+#include <esl/database/ResultBatch.h>
+#include <esl/database/table/Tables.h>
+
+#include <cstddef>
+#include <map>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace esl {
+inline namespace v1_6 {
+namespace database {
+namespace table {
+
+/* Tables that are stored in memory column by column, e.g. reference data that is joined by a sql::Engine.
+ * Tables are not synchronized, so rows must be added before the tables are scanned by other threads. */
+class MemoryTables : public Tables {
+public:
+	/* throws if there is a table "tableName" already */
+	void addTable(const std::string& tableName, const std::vector<Column>& columns);
+
+	/* adds a table with the rows of a CSV file. The first line contains the column names.
+	 * A column gets type sqlInteger or sqlDouble if all its values are numbers, otherwise sqlVarChar. Empty values are NULL. */
+	void addCSV(const std::string& tableName, const std::string& filename, char separator = ',');
+
+	/* fields[i] is the value of column i */
+	void addRow(const std::string& tableName, const std::vector<Field>& fields);
+
+	std::size_t getRowCount(const std::string& tableName) const;
+
+	std::vector<std::string> getTableNames() const override;
+	std::vector<Column> getColumns(const std::string& tableName) const override;
+	std::unique_ptr<Scan> scan(const std::string& tableName, const std::vector<std::size_t>& columns, const std::vector<Predicate>& predicates) const override;
+
+private:
+	struct Table {
+		std::vector<Column> columns;
+		std::vector<ResultBatch::Array> arrays;
+		std::size_t rowCount = 0;
+	};
+
+	std::map<std::string, Table> tables;
+
+	const Table& getTable(const std::string& tableName) const;
+};
+
+} /* namespace table */
+} /* namespace database */
+} /* inline namespace v1_6 */
+} /* namespace esl */
+
+#endif /* ESL_DATABASE_TABLE_MEMORYTABLES_H_ */
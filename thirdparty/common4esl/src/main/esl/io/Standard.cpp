@@ -18,26 +18,70 @@
 
 #include <esl/io/Standard.h>
 
+#include <cerrno>
 #include <cstdio>
 
+#include <limits.h>
+#include <sys/uio.h>
+#include <unistd.h>
+
 namespace esl {
 inline namespace v1_6 {
 namespace io {
 
 namespace {
+/* Standard streams are accessed by their file descriptors without the buffer of stdio.
+ * Only data written by stdio is flushed before, data already buffered by stdio for stdin is not seen. */
 class WriterStandard : public Writer {
 public:
 	WriterStandard(bool aIsErrStream)
 	: stream(aIsErrStream ? stderr : stdout),
+	  fd(aIsErrStream ? STDERR_FILENO : STDOUT_FILENO),
 	  isErrStream(aIsErrStream)
 	{ }
 
 	std::size_t write(const void* data, std::size_t size) override {
-		std::size_t rv = std::fwrite(data, size, 1, stream);
-		return rv == EOF ? Writer::npos : rv;
+		if(size == 0) {
+			return 0;
+		}
+
+		std::fflush(stream);
+
+		ssize_t rv;
+		do {
+			rv = ::write(fd, data, size);
+		} while(rv < 0 && errno == EINTR);
+
+		return toSize(rv);
+	}
+
+	std::size_t writev(const Buffer* buffers, std::size_t count) override {
+		struct iovec iov[maxIovCount];
+		int iovCount = 0;
+
+		for(std::size_t i = 0; i < count && iovCount < maxIovCount; ++i) {
+			if(buffers[i].size > 0) {
+				iov[iovCount].iov_base = const_cast<void*>(buffers[i].data);
+				iov[iovCount].iov_len = buffers[i].size;
+				++iovCount;
+			}
+		}
+
+		if(iovCount == 0) {
+			return 0;
+		}
+
+		std::fflush(stream);
+
+		ssize_t rv;
+		do {
+			rv = ::writev(fd, iov, iovCount);
+		} while(rv < 0 && errno == EINTR);
+
+		return toSize(rv);
 	}
 
-	std::size_t getSizeWritable() const {
+	std::size_t getSizeWritable() const override {
 		return Writer::npos;
 	}
 
@@ -46,22 +90,55 @@ public:
 	}
 
 private:
+	static constexpr int maxIovCount = IOV_MAX < 64 ? IOV_MAX : 64;
+
+	static std::size_t toSize(ssize_t rv) noexcept {
+		if(rv >= 0) {
+			return static_cast<std::size_t>(rv);
+		}
+
+		/* non-blocking descriptor is not ready, try again later */
+		if(errno == EAGAIN || errno == EWOULDBLOCK) {
+			return 0;
+		}
+
+		return Writer::npos;
+	}
+
 	FILE* stream;
+	int fd;
 	bool isErrStream;
 };
 
 class ReaderStandard : public Reader {
 public:
-	ReaderStandard(FILE* aStream)
-	: stream(aStream)
+	ReaderStandard(int aFd)
+	: fd(aFd)
 	{ }
 
 	std::size_t read(void* data, std::size_t size) override {
-		std::size_t rv = std::fread(data, size, 1, stream);
-		return rv == EOF ? Reader::npos : rv;
+		if(size == 0) {
+			return 0;
+		}
+
+		ssize_t rv;
+		do {
+			rv = ::read(fd, data, size);
+		} while(rv < 0 && errno == EINTR);
+
+		if(rv > 0) {
+			return static_cast<std::size_t>(rv);
+		}
+
+		/* non-blocking descriptor has no data yet */
+		if(rv < 0 && (errno == EAGAIN || errno == EWOULDBLOCK)) {
+			return 0;
+		}
+
+		return Reader::npos;
 	}
 
-	std::size_t getSizeReadable() const {
+	std::size_t getSizeReadable() const override {
 		return Reader::npos;
 	}
 
@@ -69,12 +146,12 @@ public:
 		return false;
 	}
 
-	std::size_t getSize() const {
+	std::size_t getSize() const override {
 		return Reader::npos;
 	}
 
 private:
-	FILE* stream;
+	int fd;
 };
 
 }
@@ -90,7 +167,7 @@ Writer& Standard::getErr() {
 }
 
 Reader& Standard::getIn() {
-	static ReaderStandard in(stdin);
+	static ReaderStandard in(STDIN_FILENO);
 	return in;
 }
 
@@ -0,0 +1,155 @@
+/*
+ * This file is part of ESL.
+ * Copyright (C) 2020-2023 Sven Lukas
+ *
+ * ESL is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * ESL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser Public License
+ * along with ESL.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <esl/io/input/Base64.h>
+
+#include <common4esl/utility/Codec.h>
+
+#include <algorithm>
+#include <memory>
+#include <thread>
+
+namespace esl {
+inline namespace v1_6 {
+namespace io {
+namespace input {
+
+constexpr std::size_t Base64::maxOutputSize;
+
+esl::io::Input Base64::create(Writer& baseWriter) {
+	return esl::io::Input(std::unique_ptr<Writer>(new Base64(baseWriter)));
+}
+
+Base64::Base64(Writer& aBaseWriter)
+: baseWriter(aBaseWriter)
+{ }
+
+std::size_t Base64::write(const void* aData, std::size_t size) {
+	const char* data = static_cast<const char*>(aData);
+
+	if(isBaseWriterEOF) {
+		return npos;
+	}
+
+	/* signal base writer that no more data will be written */
+	if(size == 0) {
+		finish();
+
+		/* write will not be called anymore, so the remaining data must be written now, even if the base writer stalls */
+		while(outputSize > 0) {
+			if(!flush()) {
+				return npos;
+			}
+			if(outputSize > 0) {
+				std::this_thread::yield();
+			}
+		}
+
+		baseWriter.write(output, 0);
+		return 0;
+	}
+
+	if(!flush()) {
+		return npos;
+	}
+
+	if(isFinished) {
+		return size;
+	}
+
+	/* base writer is stalled */
+	if(outputSize > 0) {
+		return 0;
+	}
+
+	std::size_t pos = 0;
+	while(pos < size && outputSize < maxOutputSize) {
+		/* decode complete groups in bulk */
+		if(groupSize == 0) {
+			std::size_t maxSize = std::min(size - pos, (maxOutputSize - outputSize) / 3 * 4);
+			std::size_t count = common4esl::utility::Codec::decodeBase64Groups(data + pos, maxSize, output + outputSize);
+			pos += count;
+			outputSize += count / 4 * 3;
+
+			if(pos >= size || outputSize >= maxOutputSize) {
+				break;
+			}
+		}
+
+		char c = data[pos];
+		if(c == '\r' || c == '\n' || c == ' ' || c == '\t') {
+			++pos;
+			continue;
+		}
+
+		if(common4esl::utility::Codec::getBase64Value(c) < 0) {
+			finish();
+			pos = size;
+			break;
+		}
+
+		group[groupSize] = c;
+		++groupSize;
+		++pos;
+
+		if(groupSize == 4) {
+			outputSize += common4esl::utility::Codec::decodeBase64Groups(group, 4, output + outputSize) / 4 * 3;
+			groupSize = 0;
+		}
+	}
+
+	flush();
+	return pos;
+}
+
+std::size_t Base64::getSizeWritable() const {
+	return isBaseWriterEOF ? 0 : npos;
+}
+
+bool Base64::flush() {
+	while(outputPos < outputSize) {
+		std::size_t count = baseWriter.write(output + outputPos, outputSize - outputPos);
+		if(count == npos) {
+			isBaseWriterEOF = true;
+			return false;
+		}
+		if(count == 0) {
+			return true;
+		}
+		outputPos += std::min(count, outputSize - outputPos);
+	}
+
+	outputPos = 0;
+	outputSize = 0;
+	return true;
+}
+
+void Base64::finish() {
+	if(isFinished) {
+		return;
+	}
+
+	isFinished = true;
+	outputSize += common4esl::utility::Codec::decodeBase64Tail(group, groupSize, output + outputSize);
+	groupSize = 0;
+}
+
+} /* namespace input */
+} /* namespace io */
+} /* inline namespace v1_6 */
+} /* namespace esl */
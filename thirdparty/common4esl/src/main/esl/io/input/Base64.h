@@ -0,0 +1,72 @@
+/*
+ * This file is part of ESL.
+ * Copyright (C) 2020-2023 Sven Lukas
+ *
+ * ESL is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * ESL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser Public License
+ * along with ESL.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef ESL_IO_INPUT_BASE64_H_
+#define ESL_IO_INPUT_BASE64_H_
+
+#include <esl/io/Input.h>
+#include <esl/io/Writer.h>
+
+#include <cstdint>
+#include <string>
+
+namespace esl {
+inline namespace v1_6 {
+namespace io {
+namespace input {
+
+/* Writer that decodes base64 piece by piece and writes the result to the base writer.
+ * Both alphabets are accepted, CR, LF, space and tab are ignored.
+ * Decoding ends at "=" or any other character, like esl::utility::String::fromBase64 does. Following data is ignored. */
+class Base64 : public Writer {
+public:
+	static Input create(Writer& baseWriter);
+
+	Base64(Writer& baseWriter);
+
+	std::size_t write(const void* data, std::size_t size) override;
+	std::size_t getSizeWritable() const override;
+
+private:
+	/* writes decoded data to base writer until it stalls.
+	 * returns false if base writer will not consume anymore. */
+	bool flush();
+
+	/* decodes an incomplete group and ignores all following data */
+	void finish();
+
+	Writer& baseWriter;
+	bool isFinished = false;
+	bool isBaseWriterEOF = false;
+
+	char group[4];
+	std::size_t groupSize = 0;
+
+	/* 3 bytes for 4 characters of input plus an incomplete group */
+	static constexpr std::size_t maxOutputSize = 3072;
+	std::uint8_t output[maxOutputSize + 3];
+	std::size_t outputPos = 0;
+	std::size_t outputSize = 0;
+};
+
+} /* namespace input */
+} /* namespace io */
+} /* inline namespace v1_6 */
+} /* namespace esl */
+
+#endif /* ESL_IO_INPUT_BASE64_H_ */
@@ -0,0 +1,163 @@
+/*
+ * This file is part of ESL.
+ * Copyright (C) 2020-2023 Sven Lukas
+ *
+ * ESL is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * ESL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser Public License
+ * along with ESL.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <esl/io/input/File.h>
+#include <esl/io/output/File.h>
+#include <esl/Logger.h>
+
+#include <cerrno>
+#include <cstring>
+#include <memory>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace esl {
+inline namespace v1_6 {
+namespace io {
+namespace input {
+
+namespace {
+Logger logger("esl::io::input::File");
+}
+
+esl::io::Input File::create(const std::string& filename, bool append, std::size_t preallocateSize) {
+	return esl::io::Input(std::unique_ptr<Consumer>(new File(filename, append, preallocateSize)));
+}
+
+File::File(const std::string& aFilename, bool aAppend, std::size_t preallocateSize)
+: filename(aFilename),
+  fd(::open(aFilename.c_str(), O_WRONLY | O_CREAT | O_CLOEXEC | (aAppend ? O_APPEND : O_TRUNC), 0644)),
+  append(aAppend)
+{
+	if(fd < 0) {
+		logger.warn << "esl: cannot open file \"" << filename << "\": " << std::strerror(errno) << "\n";
+		return;
+	}
+
+#ifdef __linux__
+	if(preallocateSize > 0) {
+		off_t offset = append ? ::lseek(fd, 0, SEEK_END) : 0;
+
+		/* this is just a hint, so the file size is not changed and errors are ignored */
+		if(offset < 0 || ::fallocate(fd, FALLOC_FL_KEEP_SIZE, offset, static_cast<off_t>(preallocateSize)) != 0) {
+			logger.debug << "esl: cannot preallocate " << preallocateSize << " bytes for file \"" << filename << "\"\n";
+		}
+	}
+#endif
+}
+
+File::~File() {
+	close();
+}
+
+bool File::consume(Reader& reader) {
+	if(fd < 0) {
+		return false;
+	}
+
+	if(output::File* file = dynamic_cast<output::File*>(&reader)) {
+		if(copyFileRange(*file)) {
+			return true;
+		}
+	}
+
+	std::size_t peekSize = 0;
+	const void* peekData = reader.peek(peekSize);
+	if(peekData && peekSize > 0) {
+		if(!write(peekData, peekSize)) {
+			return false;
+		}
+		reader.skip(peekSize);
+		return true;
+	}
+
+	char buffer[4096];
+	std::size_t size = reader.read(buffer, sizeof(buffer));
+	if(size == Reader::npos) {
+		close();
+		return false;
+	}
+
+	return write(buffer, size);
+}
+
+const std::string& File::getFilename() const noexcept {
+	return filename;
+}
+
+std::size_t File::getPosition() const noexcept {
+	return pos;
+}
+
+bool File::copyFileRange(output::File& reader) {
+#ifdef __linux__
+	/* copy_file_range() does not support files opened with O_APPEND */
+	if(append || reader.getFileDescriptor() < 0 || reader.getSizeReadable() == 0) {
+		return false;
+	}
+
+	loff_t offsetIn = static_cast<loff_t>(reader.getPosition());
+	loff_t offsetOut = static_cast<loff_t>(pos);
+	ssize_t rv = ::copy_file_range(reader.getFileDescriptor(), &offsetIn, fd, &offsetOut, reader.getSizeReadable(), 0);
+	if(rv <= 0) {
+		return false;
+	}
+
+	pos += static_cast<std::size_t>(rv);
+	reader.skip(static_cast<std::size_t>(rv));
+	return true;
+#else
+	return false;
+#endif
+}
+
+bool File::write(const void* data, std::size_t size) {
+	std::size_t count = 0;
+
+	while(count < size) {
+		const char* ptr = static_cast<const char*>(data) + count;
+		ssize_t rv = append ? ::write(fd, ptr, size - count) : ::pwrite(fd, ptr, size - count, static_cast<off_t>(pos));
+
+		if(rv < 0) {
+			if(errno == EINTR) {
+				continue;
+			}
+			logger.warn << "esl: cannot write file \"" << filename << "\": " << std::strerror(errno) << "\n";
+			close();
+			return false;
+		}
+
+		count += static_cast<std::size_t>(rv);
+		pos += static_cast<std::size_t>(rv);
+	}
+
+	return true;
+}
+
+void File::close() {
+	if(fd >= 0) {
+		::close(fd);
+		fd = -1;
+	}
+}
+
+} /* namespace input */
+} /* namespace io */
+} /* inline namespace v1_6 */
+} /* namespace esl */
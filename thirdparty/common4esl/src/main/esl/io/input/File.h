@@ -0,0 +1,77 @@
+/*
+ * This file is part of ESL.
+ * Copyright (C) 2020-2023 Sven Lukas
+ *
+ * ESL is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * ESL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser Public License
+ * along with ESL.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef ESL_IO_INPUT_FILE_H_
+#define ESL_IO_INPUT_FILE_H_
+
+#include <esl/io/Consumer.h>
+#include <esl/io/Input.h>
+#include <esl/io/Reader.h>
+
+#include <string>
+
+namespace esl {
+inline namespace v1_6 {
+namespace io {
+namespace output {
+class File;
+} /* namespace output */
+
+namespace input {
+
+class File : public Consumer {
+public:
+	/* append: data is written to the end of an existing file, otherwise the file gets truncated.
+	 * preallocateSize: number of bytes reserved on disk in advance by fallocate(). 0 reserves nothing. */
+	static Input create(const std::string& filename, bool append = false, std::size_t preallocateSize = 0);
+
+	File(const std::string& filename, bool append = false, std::size_t preallocateSize = 0);
+	File(const File&) = delete;
+	~File();
+
+	File& operator=(const File&) = delete;
+
+	bool consume(Reader& reader) override;
+
+	const std::string& getFilename() const noexcept;
+
+	/* returns the number of bytes that have been written already */
+	std::size_t getPosition() const noexcept;
+
+private:
+	/* copies from the file descriptor of reader to this file inside the kernel.
+	 * returns false if nothing has been copied and the data must be read as usual. */
+	bool copyFileRange(output::File& reader);
+
+	/* writes all bytes and returns false on error */
+	bool write(const void* data, std::size_t size);
+
+	void close();
+
+	std::string filename;
+	int fd = -1;
+	bool append;
+	std::size_t pos = 0;
+};
+
+} /* namespace input */
+} /* namespace io */
+} /* inline namespace v1_6 */
+} /* namespace esl */
+
+#endif /* ESL_IO_INPUT_FILE_H_ */
@@ -0,0 +1,126 @@
+/*
+ * This file is part of ESL.
+ * Copyright (C) 2020-2023 Sven Lukas
+ *
+ * ESL is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * ESL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser Public License
+ * along with ESL.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <esl/io/output/Base64.h>
+
+#include <common4esl/utility/Codec.h>
+
+#include <algorithm>
+#include <cstring>
+#include <memory>
+
+namespace esl {
+inline namespace v1_6 {
+namespace io {
+namespace output {
+
+esl::io::Output Base64::create(Reader& baseReader, utility::String::Base64Variant base64Variant, bool withPadding) {
+	return esl::io::Output(std::unique_ptr<Reader>(new Base64(baseReader, base64Variant, withPadding)));
+}
+
+Base64::Base64(Reader& aBaseReader, utility::String::Base64Variant base64Variant, bool aWithPadding)
+: baseReader(aBaseReader),
+  url(base64Variant == utility::String::base64url),
+  withPadding(aWithPadding)
+{ }
+
+std::size_t Base64::read(void* data, std::size_t size) {
+	if(size == 0) {
+		return 0;
+	}
+
+	std::size_t available = fill();
+	if(available == 0) {
+		return isBaseReaderEOF ? npos : 0;
+	}
+
+	size = std::min(size, available);
+	std::memcpy(data, output + outputPos, size);
+	outputPos += size;
+
+	return size;
+}
+
+const void* Base64::peek(std::size_t& size) {
+	size = fill();
+	return size == 0 ? nullptr : output + outputPos;
+}
+
+void Base64::skip(std::size_t size) {
+	std::size_t count = std::min(size, outputSize - outputPos);
+	outputPos += count;
+
+	if(size > count) {
+		Reader::skip(size - count);
+	}
+}
+
+std::size_t Base64::getSizeReadable() const {
+	if(outputPos < outputSize) {
+		return outputSize - outputPos;
+	}
+	return isBaseReaderEOF ? 0 : npos;
+}
+
+bool Base64::hasSize() const {
+	return baseReader.hasSize();
+}
+
+std::size_t Base64::getSize() const {
+	std::size_t size = baseReader.getSize();
+	if(size == npos) {
+		return npos;
+	}
+	return common4esl::utility::Codec::getBase64Size(size, url, withPadding);
+}
+
+std::size_t Base64::fill() {
+	if(outputPos < outputSize) {
+		return outputSize - outputPos;
+	}
+
+	outputPos = 0;
+	outputSize = 0;
+
+	if(isBaseReaderEOF) {
+		return 0;
+	}
+
+	std::size_t size = baseReader.read(input + inputSize, sizeof(input) - inputSize);
+	if(size == npos) {
+		isBaseReaderEOF = true;
+		outputSize = common4esl::utility::Codec::encodeBase64Tail(input, inputSize, output, url, withPadding);
+		inputSize = 0;
+	}
+	else {
+		inputSize += size;
+
+		/* an incomplete group is kept for the next call */
+		std::size_t groupsSize = inputSize - inputSize % 3;
+		outputSize = common4esl::utility::Codec::encodeBase64Groups(input, groupsSize, output, url);
+		std::memmove(input, input + groupsSize, inputSize - groupsSize);
+		inputSize -= groupsSize;
+	}
+
+	return outputSize;
+}
+
+} /* namespace output */
+} /* namespace io */
+} /* inline namespace v1_6 */
+} /* namespace esl */
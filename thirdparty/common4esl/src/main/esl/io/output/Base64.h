@@ -0,0 +1,73 @@
+/*
+ * This file is part of ESL.
+ * Copyright (C) 2020-2023 Sven Lukas
+ *
+ * ESL is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * ESL is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser Public License
+ * along with ESL.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef ESL_IO_OUTPUT_BASE64_H_
+#define ESL_IO_OUTPUT_BASE64_H_
+
+#include <esl/io/Output.h>
+#include <esl/io/Reader.h>
+#include <esl/utility/String.h>
+
+#include <cstdint>
+#include <string>
+
+namespace esl {
+inline namespace v1_6 {
+namespace io {
+namespace output {
+
+/* Reader that returns the data of the base reader encoded as base64, piece by piece.
+ * The result is the same as of esl::utility::String::toBase64 for the whole data. */
+class Base64 : public Reader {
+public:
+	static Output create(Reader& baseReader, utility::String::Base64Variant base64Variant = utility::String::base64url, bool withPadding = false);
+
+	Base64(Reader& baseReader, utility::String::Base64Variant base64Variant = utility::String::base64url, bool withPadding = false);
+
+	std::size_t read(void* data, std::size_t size) override;
+	const void* peek(std::size_t& size) override;
+	void skip(std::size_t size) override;
+	std::size_t getSizeReadable() const override;
+	bool hasSize() const override;
+	std::size_t getSize() const override;
+
+private:
+	/* encodes the next data of base reader if all encoded characters have been read.
+	 * returns the number of encoded characters available. */
+	std::size_t fill();
+
+	Reader& baseReader;
+	bool url;
+	bool withPadding;
+	bool isBaseReaderEOF = false;
+
+	std::uint8_t input[3072];
+	std::size_t inputSize = 0;
+
+	/* 4 characters for 3 bytes of input plus padding of the tail */
+	char output[4096 + 9];
+	std::size_t outputPos = 0;
+	std::size_t outputSize = 0;
+};
+
+} /* namespace output */
+} /* namespace io */
+} /* inline namespace v1_6 */
+} /* namespace esl */
+
+#endif /* ESL_IO_OUTPUT_BASE64_H_ */
@@ -31,7 +31,39 @@ namespace {
 Logger logger("esl::io::output::Buffered");
 }
 
-constexpr std::size_t Buffered::prefetchSize;
+constexpr std::size_t Buffered::blockSize;
+
+Buffered::Cursor::Cursor(Buffered& aBuffered)
+: buffered(aBuffered)
+{ }
+
+std::size_t Buffered::Cursor::read(void* data, std::size_t size) {
+	return buffered.readAt(currentPos, data, size);
+}
+
+const void* Buffered::Cursor::peek(std::size_t& size) {
+	return buffered.peekAt(currentPos, size);
+}
+
+void Buffered::Cursor::skip(std::size_t size) {
+	buffered.skipAt(currentPos, size);
+}
+
+std::size_t Buffered::Cursor::getSizeReadable() const {
+	return buffered.getSizeReadableAt(currentPos);
+}
+
+bool Buffered::Cursor::hasSize() const {
+	return buffered.hasSize();
+}
+
+std::size_t Buffered::Cursor::getSize() const {
+	return buffered.getSize();
+}
+
+void Buffered::Cursor::reset() {
+	currentPos = 0;
+}
 
 esl::io::Output Buffered::create(Reader& baseReader) {
 	return esl::io::Output(std::unique_ptr<Reader>(new Buffered(baseReader)));
@@ -42,114 +74,149 @@ Buffered::Buffered(Reader& aBaseReader)
 { }
 
 std::size_t Buffered::read(void* data, std::size_t size) {
-	/* check if there are still some bytes available in current cache line */
-	if(currentIndex != npos && buffers[currentIndex]->size() > currentPos) {
-		CacheLine& cacheLine = *buffers[currentIndex];
+	return readAt(currentPos, data, size);
+}
 
-		if(size > 0) {
-			size = std::min(size, cacheLine.size() - currentPos);
-			std::memcpy(data, &cacheLine[currentPos], size);
-		}
+const void* Buffered::peek(std::size_t& size) {
+	return peekAt(currentPos, size);
+}
 
-		currentPos += size;
+void Buffered::skip(std::size_t size) {
+	skipAt(currentPos, size);
+}
 
-		if(cacheLine.size() <= currentPos) {
-			if(buffers.size() > currentIndex+1) {
-				currentPos = 0;
-				++currentIndex;
-			}
-		}
-	}
-	/* check if there are no more bytes available in whole buffer */
-	//if(currentIndex == npos || buffers[currentIndex]->size() <= currentPos) {
-	else {
-		if(completed) {
-			return npos;
-		}
+std::size_t Buffered::getSizeReadable() const {
+	return getSizeReadableAt(currentPos);
+}
 
-		std::size_t capacity = baseReader.get().getSizeReadable();
-		if(capacity == 0) {
-			if(baseReader.get().read(nullptr, 0) == npos) {
-				completed = true;
-			}
-			return 0;
-		}
+bool Buffered::hasSize() const {
+	return completed;
+}
 
-		if(capacity == npos) {
-			capacity = prefetchSize;
-		}
-		if(capacity > size) {
-			capacity = size;
-		}
+std::size_t Buffered::getSize() const {
+	return completed ? bufferedSize : Reader::npos;
+}
 
-		buffers.push_back(std::unique_ptr<std::vector<std::uint8_t>>(new std::vector<std::uint8_t>(capacity)));
-		CacheLine& cacheLine = *buffers.back();
+void Buffered::setBaseReader(Reader& aBaseReader) {
+	baseReader = std::ref(aBaseReader);
+}
 
-		size = baseReader.get().read(&cacheLine[0], capacity);
+void Buffered::reset() {
+	currentPos = 0;
+}
 
-		if(size == 0) {
-			buffers.pop_back();
-		}
-		else if(size == npos) {
-			buffers.pop_back();
-			completed = true;
-		}
-		else {
-			if(capacity > size) {
-				cacheLine.resize(size);
-			}
+esl::io::Output Buffered::createCursor() {
+	return esl::io::Output(std::unique_ptr<Reader>(new Cursor(*this)));
+}
 
-			currentIndex = buffers.size() - 1;
-			currentPos = size;
+std::size_t Buffered::readAt(std::size_t& pos, void* aData, std::size_t size) {
+	std::uint8_t* data = static_cast<std::uint8_t*>(aData);
 
-			std::memcpy(data, &cacheLine[0], size);
-		}
+	if(size == 0) {
+		return 0;
 	}
 
-	return size;
-}
+	/* check if there are no more bytes available in whole buffer */
+	if(pos >= bufferedSize) {
+		std::size_t fetchedSize = fetch();
+		if(fetchedSize == npos || fetchedSize == 0) {
+			return fetchedSize;
+		}
+	}
 
-std::size_t Buffered::getSizeReadable() const {
-	/* check if there are still some bytes available in current cache line */
-	if(currentIndex != npos && buffers[currentIndex]->size() > currentPos) {
-		CacheLine& cacheLine = *buffers[currentIndex];
+	std::size_t count = 0;
+	while(count < size && pos < bufferedSize) {
+		std::size_t offset = pos & (blockSize - 1);
+		std::size_t length = std::min(std::min(size - count, blockSize - offset), bufferedSize - pos);
 
-		return cacheLine.size() - currentPos;
+		std::memcpy(data + count, blocks[pos / blockSize].get() + offset, length);
+		count += length;
+		pos += length;
 	}
-	/* check if there are no more bytes available in whole buffer */
-	//if(currentIndex == npos || buffers[currentIndex]->size() <= currentPos) {
-	else {
-		if(completed) {
-			return 0;
+
+	return count;
+}
+
+const void* Buffered::peekAt(std::size_t pos, std::size_t& size) {
+	if(pos >= bufferedSize) {
+		std::size_t fetchedSize = fetch();
+		if(fetchedSize == npos || fetchedSize == 0) {
+			size = 0;
+			return nullptr;
 		}
-		return baseReader.get().getSizeReadable();
 	}
-}
 
-bool Buffered::hasSize() const {
-	return !completed;
+	std::size_t offset = pos & (blockSize - 1);
+	size = std::min(blockSize - offset, bufferedSize - pos);
+	return blocks[pos / blockSize].get() + offset;
 }
 
-std::size_t Buffered::getSize() const {
-	std::size_t rv = Reader::npos;
-	if(completed) {
-		rv = 0;
-		for(const auto& cacheLinePtr : buffers) {
-			if(cacheLinePtr) {
-				rv += cacheLinePtr->size();
+void Buffered::skipAt(std::size_t& pos, std::size_t size) {
+	while(size > 0) {
+		if(pos >= bufferedSize) {
+			std::size_t fetchedSize = fetch();
+			if(fetchedSize == npos || fetchedSize == 0) {
+				break;
 			}
 		}
+
+		std::size_t count = std::min(size, bufferedSize - pos);
+		pos += count;
+		size -= count;
 	}
-	return rv;
 }
 
-void Buffered::setBaseReader(Reader& aBaseReader) {
-	baseReader = std::ref(aBaseReader);
+std::size_t Buffered::getSizeReadableAt(std::size_t pos) const {
+	/* check if there are still some bytes available in buffer */
+	if(pos < bufferedSize) {
+		return bufferedSize - pos;
+	}
+
+	if(completed) {
+		return 0;
+	}
+	return baseReader.get().getSizeReadable();
 }
 
-void Buffered::reset() {
-	currentIndex = buffers.empty() ? npos : 0;
-	currentPos = 0;
+std::size_t Buffered::fetch() {
+	if(completed) {
+		return npos;
+	}
+
+	std::size_t capacity = baseReader.get().getSizeReadable();
+	if(capacity == 0) {
+		if(baseReader.get().read(nullptr, 0) == npos) {
+			completed = true;
+		}
+		return 0;
+	}
+
+	/* small reads are coalesced into the last block until it is full */
+	if(bufferedSize == blocks.size() * blockSize) {
+		blocks.emplace_back(new std::uint8_t[blockSize]);
+	}
+
+	std::size_t offset = bufferedSize & (blockSize - 1);
+	if(capacity > blockSize - offset) {
+		capacity = blockSize - offset;
+	}
+
+	std::size_t size = baseReader.get().read(blocks.back().get() + offset, capacity);
+
+	if(size == npos) {
+		completed = true;
+	}
+	else if(size > capacity) {
+		logger.warn << "esl::io::output::Buffered has been called with a broken reader!\n";
+		logger.warn << "Reader read " << size << " bytes but at most " << capacity << " bytes was allowed to read.\n";
+		size = capacity;
+	}
+
+	if(size != npos) {
+		bufferedSize += size;
+	}
+
+	return size;
 }
 
 } /* namespace output */
@@ -35,11 +35,34 @@ namespace output {
 
 class Buffered : public Reader {
 public:
+	/* independent read position over the data of a Buffered object.
+	 * Data that has not been buffered yet is read from the base reader and is visible for all cursors.
+	 * The Buffered object must outlive its cursors. */
+	class Cursor : public Reader {
+	public:
+		Cursor(Buffered& buffered);
+
+		std::size_t read(void* data, std::size_t size) override;
+		const void* peek(std::size_t& size) override;
+		void skip(std::size_t size) override;
+		std::size_t getSizeReadable() const override;
+		bool hasSize() const override;
+		std::size_t getSize() const override;
+
+		void reset();
+
+	private:
+		Buffered& buffered;
+		std::size_t currentPos = 0;
+	};
+
 	static Output create(Reader& baseReader);
 
 	Buffered(Reader& baseReader);
 
 	std::size_t read(void* data, std::size_t size) override;
+	const void* peek(std::size_t& size) override;
+	void skip(std::size_t size) override;
 	std::size_t getSizeReadable() const override;
 	bool hasSize() const override;
 	std::size_t getSize() const override;
@@ -48,18 +71,30 @@ public:
 
 	void reset();
 
+	/* returns an output with a new cursor that reads from the beginning of the buffered data, e.g. to send a request body again. */
+	Output createCursor();
+
 private:
-	static constexpr std::size_t prefetchSize = 4096;
+	/* size of each block of the arena. Must be a power of two. */
+	static constexpr std::size_t blockSize = 4096;
+	static_assert((blockSize & (blockSize - 1)) == 0, "blockSize must be a power of two");
+
+	std::size_t readAt(std::size_t& pos, void* data, std::size_t size);
+	const void* peekAt(std::size_t pos, std::size_t& size);
+	void skipAt(std::size_t& pos, std::size_t size);
+	std::size_t getSizeReadableAt(std::size_t pos) const;
 
-	using CacheLine = std::vector<std::uint8_t>;
+	/* appends bytes from base reader to the arena, at most up to the end of the last block.
+	 * returns the number of bytes or npos like read(...) of the base reader. */
+	std::size_t fetch();
 
 	std::reference_wrapper<Reader> baseReader;
 
 	bool completed = false;
-	std::size_t currentIndex = npos;
 	std::size_t currentPos = 0;
 
-	std::vector<std::unique_ptr<CacheLine>> buffers;
+	std::vector<std::unique_ptr<std::uint8_t[]>> blocks;
+	std::size_t bufferedSize = 0;
 };
 
 } /* namespace output */
@@ -19,6 +19,15 @@
 #include <esl/io/output/File.h>
 #include <esl/Logger.h>
 
+#include <algorithm>
+#include <cerrno>
+#include <cstring>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
 namespace esl {
 inline namespace v1_6 {
 namespace io {
@@ -28,44 +37,106 @@ namespace {
 Logger logger("esl::io::output::File");
 }
 
-esl::io::Output File::create(const std::string& filename) {
-	return esl::io::Output(std::unique_ptr<Reader>(new File(filename)));
+constexpr std::size_t File::mmapMaxSize;
+
+esl::io::Output File::create(const std::string& filename, Access access) {
+	return esl::io::Output(std::unique_ptr<Reader>(new File(filename, access)));
 }
 
-File::File(const std::string& filename)
-: file(new std::ifstream(filename))
+File::File(const std::string& aFilename, Access access)
+: filename(aFilename),
+  fd(::open(aFilename.c_str(), O_RDONLY | O_CLOEXEC))
 {
-	if(file->good()) {
-		const auto begin = file->tellg();
-		file->seekg(0, std::ios::end);
-		const auto end = file->tellg();
-		size = (end-begin);
+	struct stat st;
+	if(fd < 0 || ::fstat(fd, &st) != 0) {
+		logger.warn << "esl: cannot open file \"" << filename << "\"\n";
+		if(fd >= 0) {
+			::close(fd);
+			fd = -1;
+		}
+		return;
 	}
-	else {
-        logger.warn << "esl: cannot open file \"" << filename << "\"\n";
-        file.reset();
+	size = static_cast<std::size_t>(st.st_size);
+
+	if(access == Access::automatic) {
+		access = size <= mmapMaxSize ? Access::mmap : Access::pread;
+	}
+
+	/* an empty file cannot be mapped */
+	if(access == Access::mmap && size > 0) {
+		data = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+		if(data == MAP_FAILED) {
+			logger.warn << "esl: cannot map file \"" << filename << "\", reading it by pread(): " << std::strerror(errno) << "\n";
+			data = nullptr;
+		}
+		else {
+			::madvise(data, size, MADV_SEQUENTIAL);
+		}
+	}
+	else if(access == Access::pread) {
+		::posix_fadvise(fd, 0, 0, POSIX_FADV_SEQUENTIAL);
+	}
+}
+
+File::~File() {
+	if(data) {
+		::munmap(data, size);
+	}
+	if(fd >= 0) {
+		::close(fd);
 	}
 }
 
 std::size_t File::read(void* buffer, std::size_t count) {
-	if(!file) {
+	if(fd < 0) {
 		return 0;
 	}
 
 	std::size_t remainingSize = getSizeReadable();
+	if(remainingSize == 0) {
+		return npos;
+	}
+
 	if(count > remainingSize) {
 		count = remainingSize;
 	}
 
-	if(count > 0) {
-		file->read(static_cast<char*>(buffer), count);
+	if(count == 0) {
+		return 0;
+	}
+
+	if(data) {
+		std::memcpy(buffer, static_cast<const char*>(data) + pos, count);
+	}
+	else {
+		ssize_t rv;
+		do {
+			rv = ::pread(fd, buffer, count, static_cast<off_t>(pos));
+		} while(rv < 0 && errno == EINTR);
+
+		if(rv <= 0) {
+			/* file has been truncated or cannot be read anymore */
+			logger.warn << "esl: cannot read file \"" << filename << "\" at position " << pos << "\n";
+			return npos;
+		}
+		count = static_cast<std::size_t>(rv);
 	}
+	pos += count;
 
 	return count;
 }
 
+const void* File::peek(std::size_t& count) {
+	count = data ? getSizeReadable() : 0;
+	return count == 0 ? nullptr : static_cast<const char*>(data) + pos;
+}
+
+void File::skip(std::size_t count) {
+	pos += std::min(count, getSizeReadable());
+}
+
 std::size_t File::getSizeReadable() const {
-	if(!file) {
+	if(fd < 0) {
 		return 0;
 	}
 
@@ -73,14 +144,29 @@ std::size_t File::getSizeReadable() const {
 }
 
 bool File::hasSize() const {
-	return file ? true : false;
-//	return (bool) file;
+	return fd >= 0;
 }
 
 std::size_t File::getSize() const {
 	return size;
 }
 
+const std::string& File::getFilename() const noexcept {
+	return filename;
+}
+
+std::size_t File::getPosition() const noexcept {
+	return pos;
+}
+
+const void* File::getData() const noexcept {
+	return data;
+}
+
+int File::getFileDescriptor() const noexcept {
+	return fd;
+}
+
 } /* namespace output */
 } /* namespace io */
 } /* inline namespace v1_6 */
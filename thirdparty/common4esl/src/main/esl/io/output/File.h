@@ -22,7 +22,6 @@
 #include <esl/io/Output.h>
 #include <esl/io/Reader.h>
 
-#include <fstream>
 #include <memory>
 #include <string>
 
@@ -33,17 +32,53 @@ namespace output {
 
 class File : public Reader {
 public:
-	static Output create(const std::string& filename);
+	/* mmap avoids copying the file content, but a mapped file must not be truncated while it is read:
+	 * accessing pages beyond the new end of the file raises SIGBUS and terminates the process.
+	 * Therefore pread is the default and mmap must be requested explicitly for files that are not modified. */
+	enum class Access {
+		/* mmap for files up to mmapMaxSize, pread otherwise */
+		automatic,
 
-	File(const std::string& filename);
+		/* file content is mapped into memory and available by getData() and peek() without copying */
+		mmap,
+
+		/* file content is read by pread() into the buffer given to read(). A truncated file ends the output early. */
+		pread
+	};
+
+	static Output create(const std::string& filename, Access access = Access::pread);
+
+	File(const std::string& filename, Access access = Access::pread);
+	File(const File&) = delete;
+	~File();
+
+	File& operator=(const File&) = delete;
 
 	std::size_t read(void* data, std::size_t size) override;
+	const void* peek(std::size_t& size) override;
+	void skip(std::size_t size) override;
 	std::size_t getSizeReadable() const override;
 	bool hasSize() const override;
 	std::size_t getSize() const override;
 
+	const std::string& getFilename() const noexcept;
+
+	/* returns the number of bytes that have been read already */
+	std::size_t getPosition() const noexcept;
+
+	/* returns the mapped file content or nullptr if the file is not mapped */
+	const void* getData() const noexcept;
+
+	/* returns the file descriptor or -1 if the file could not be opened.
+	 * Reading does not change the file offset, so it can be used with pread(), sendfile() or copy_file_range(). */
+	int getFileDescriptor() const noexcept;
+
 private:
-	std::unique_ptr<std::ifstream> file;
+	static constexpr std::size_t mmapMaxSize = static_cast<std::size_t>(1) << 30;
+
+	std::string filename;
+	int fd = -1;
+	void* data = nullptr;
 	std::size_t size = 0;
 
 	std::size_t pos = 0;
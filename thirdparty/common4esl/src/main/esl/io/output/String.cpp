@@ -66,6 +66,14 @@ std::size_t String::produce(esl::io::Writer& writer) {
 	return count;
 }
 
+const void* String::getData() const noexcept {
+	return &data[currentPos];
+}
+
+std::size_t String::getSize() const noexcept {
+	return (size == esl::io::Writer::npos || currentPos >= size) ? 0 : size - currentPos;
+}
+
 } /* namespace output */
 } /* namespace io */
 } /* inline namespace v1_6 */
@@ -38,6 +38,10 @@ public:
 
 	std::size_t produce(Writer& writer) override;
 
+	/* returns the content that has not been produced so far */
+	const void* getData() const noexcept;
+	std::size_t getSize() const noexcept;
+
 private:
 	std::string str;
 
@@ -0,0 +1,167 @@
+#include <esl/monitoring/FileAppender.h>
+#include <esl/utility/String.h>
+
+#include <common4esl/monitoring/FileAppender.h>
+
+#include <stdexcept>
+
+namespace esl {
+inline namespace v1_6 {
+namespace monitoring {
+
+namespace {
+Streams::Level toLevel(const std::string& str) {
+	std::string level = utility::String::toLower(str);
+
+	if(level == "trace") {
+		return Streams::Level::trace;
+	}
+	else if(level == "debug") {
+		return Streams::Level::debug;
+	}
+	else if(level == "info") {
+		return Streams::Level::info;
+	}
+	else if(level == "warn") {
+		return Streams::Level::warn;
+	}
+	else if(level == "error") {
+		return Streams::Level::error;
+	}
+	throw std::runtime_error("Invalid value \"" + str + "\" of parameter key \"overflow-level\" for FileAppender");
+}
+} /* anonymous namespace */
+
+FileAppender::Settings::Settings(const std::vector<std::pair<std::string, std::string>>& settings) {
+	bool hasQueueSize = false;
+	bool hasOverflow = false;
+	bool hasOverflowLevel = false;
+	bool hasRotateSize = false;
+	bool hasRotateInterval = false;
+	bool hasRotateFiles = false;
+	bool hasSync = false;
+
+	for(auto const& setting : settings) {
+		if(setting.first == "file") {
+			if(!fileName.empty()) {
+				throw std::runtime_error("Multiple definition of parameter key \"" + setting.first + "\" for FileAppender");
+			}
+			fileName = setting.second;
+			if(fileName.empty()) {
+				throw std::runtime_error("Invalid value \"\" of parameter key \"" + setting.first + "\" for FileAppender");
+			}
+		}
+		else if(setting.first == "queue-size") {
+			if(hasQueueSize) {
+				throw std::runtime_error("Multiple definition of parameter key \"" + setting.first + "\" for FileAppender");
+			}
+			hasQueueSize = true;
+			queueSize = static_cast<std::size_t>(std::stoul(setting.second));
+			if(queueSize == 0) {
+				throw std::runtime_error("Invalid value \"" + setting.second + "\" of parameter key \"" + setting.first + "\" for FileAppender");
+			}
+		}
+		else if(setting.first == "overflow") {
+			if(hasOverflow) {
+				throw std::runtime_error("Multiple definition of parameter key \"" + setting.first + "\" for FileAppender");
+			}
+			hasOverflow = true;
+
+			std::string value = utility::String::toLower(setting.second);
+			if(value == "block") {
+				overflow = Overflow::block;
+			}
+			else if(value == "drop") {
+				overflow = Overflow::drop;
+			}
+			else if(value == "drop-below-level") {
+				overflow = Overflow::dropBelowLevel;
+			}
+			else {
+				throw std::runtime_error("Invalid value \"" + setting.second + "\" of parameter key \"" + setting.first + "\" for FileAppender. "
+						"Valid values are \"block\", \"drop\" and \"drop-below-level\"");
+			}
+		}
+		else if(setting.first == "overflow-level") {
+			if(hasOverflowLevel) {
+				throw std::runtime_error("Multiple definition of parameter key \"" + setting.first + "\" for FileAppender");
+			}
+			hasOverflowLevel = true;
+			overflowLevel = toLevel(setting.second);
+		}
+		else if(setting.first == "rotate-size") {
+			if(hasRotateSize) {
+				throw std::runtime_error("Multiple definition of parameter key \"" + setting.first + "\" for FileAppender");
+			}
+			hasRotateSize = true;
+			rotateSize = static_cast<std::size_t>(std::stoul(setting.second));
+		}
+		else if(setting.first == "rotate-interval") {
+			if(hasRotateInterval) {
+				throw std::runtime_error("Multiple definition of parameter key \"" + setting.first + "\" for FileAppender");
+			}
+			hasRotateInterval = true;
+			rotateInterval = std::stoul(setting.second);
+		}
+		else if(setting.first == "rotate-files") {
+			if(hasRotateFiles) {
+				throw std::runtime_error("Multiple definition of parameter key \"" + setting.first + "\" for FileAppender");
+			}
+			hasRotateFiles = true;
+			rotateFiles = static_cast<std::size_t>(std::stoul(setting.second));
+		}
+		else if(setting.first == "sync") {
+			if(hasSync) {
+				throw std::runtime_error("Multiple definition of parameter key \"" + setting.first + "\" for FileAppender");
+			}
+			hasSync = true;
+			sync = utility::String::toBool(setting.second);
+		}
+		else {
+			throw std::runtime_error("Invalid parameter key \"" + setting.first + "\" for FileAppender");
+		}
+	}
+
+	if(fileName.empty()) {
+		throw std::runtime_error("Missing definition of parameter key \"file\" for FileAppender");
+	}
+	if(hasOverflowLevel && overflow != Overflow::dropBelowLevel) {
+		throw std::runtime_error("Parameter key \"overflow-level\" is only allowed with \"overflow\" set to \"drop-below-level\" for FileAppender");
+	}
+}
+
+FileAppender::FileAppender(const Settings& settings)
+: appender(new common4esl::monitoring::FileAppender(settings))
+{ }
+
+std::unique_ptr<Appender> FileAppender::create(const std::vector<std::pair<std::string, std::string>>& settings) {
+	return std::unique_ptr<Appender>(new FileAppender(Settings(settings)));
+}
+
+void FileAppender::setLayout(const Layout* aLayout) {
+	appender->setLayout(aLayout);
+}
+
+const Layout* FileAppender::getLayout() const {
+	return appender->getLayout();
+}
+
+void FileAppender::setRecordLevel(RecordLevel aRecordLevel) {
+	appender->setRecordLevel(aRecordLevel);
+}
+
+Appender::RecordLevel FileAppender::getRecordLevel() const {
+	return appender->getRecordLevel();
+}
+
+void FileAppender::flush(std::ostream* oStream) {
+	appender->flush(oStream);
+}
+
+void FileAppender::write(const Streams::Location& location, const char* ptr, std::size_t size) {
+	appender->write(location, ptr, size);
+}
+
+} /* namespace monitoring */
+} /* inline namespace v1_6 */
+} /* namespace esl */
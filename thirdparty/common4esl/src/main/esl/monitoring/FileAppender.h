@@ -0,0 +1,79 @@
+#ifndef ESL_MONITORING_FILEAPPENDER_H_
+#define ESL_MONITORING_FILEAPPENDER_H_
+
+#include <esl/monitoring/Appender.h>
+#include <esl/monitoring/Layout.h>
+#include <esl/monitoring/Streams.h>
+
+#include <cstddef>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace esl {
+inline namespace v1_6 {
+namespace monitoring {
+
+/* FileAppender hands formatted log lines to a background writer thread through a bounded queue.
+ * The writer thread writes everything that is queued with a single writev call
+ * and rotates the file by size and/or by time. */
+class FileAppender : public Appender {
+public:
+	struct Settings {
+		/* What to do with a log line if the queue is full */
+		enum class Overflow {
+			block,          // wait until writer thread made space
+			drop,           // drop the line
+			dropBelowLevel  // drop the line if its level is below "overflowLevel", otherwise wait
+		};
+
+		Settings() = default;
+		Settings(const std::vector<std::pair<std::string, std::string>>& settings);
+
+		std::string fileName;
+
+		// maximum number of bytes waiting for the writer thread
+		std::size_t queueSize = 1024 * 1024;
+
+		Overflow overflow = Overflow::block;
+		Streams::Level overflowLevel = Streams::Level::warn;
+
+		// rotate file if it would become larger than "rotateSize" bytes. 0 means no rotation by size.
+		std::size_t rotateSize = 0;
+
+		// rotate file if it is older than "rotateInterval" seconds. 0 means no rotation by time.
+		unsigned long rotateInterval = 0;
+
+		// number of rotated files to keep, named "<fileName>.1" (newest) to "<fileName>.<rotateFiles>" (oldest).
+		std::size_t rotateFiles = 5;
+
+		// call fdatasync after each batch that has been written
+		bool sync = false;
+	};
+
+	FileAppender(const Settings& settings);
+
+	static std::unique_ptr<Appender> create(const std::vector<std::pair<std::string, std::string>>& settings);
+
+	void setLayout(const Layout* aLayout) override;
+	const Layout* getLayout() const override;
+
+	/* both methods are NOT thread-safe */
+	void setRecordLevel(RecordLevel aRecordLevel = RecordLevel::SELECTED) override;
+	RecordLevel getRecordLevel() const override;
+
+	void flush(std::ostream* oStream) override;
+
+	void write(const Streams::Location& location, const char* ptr, std::size_t size) override;
+
+private:
+	std::unique_ptr<Appender> appender;
+};
+
+} /* namespace monitoring */
+} /* inline namespace v1_6 */
+} /* namespace esl */
+
+#endif /* ESL_MONITORING_FILEAPPENDER_H_ */
@@ -11,6 +11,8 @@ namespace monitoring {
 MemBufferAppender::Settings::Settings(const std::vector<std::pair<std::string, std::string>>& settings) {
 	bool hasMaxColumns = false;
 	bool hasMaxLines = false;
+	bool hasBufferSize = false;
+	bool hasFile = false;
 
 	for(auto const& setting : settings) {
 		if(setting.first == "max-lines") {
@@ -27,13 +29,37 @@ MemBufferAppender::Settings::Settings(const std::vector<std::pair<std::string, s
 			hasMaxColumns = true;
 			maxColumns = static_cast<std::size_t>(std::stoi(setting.second));
 		}
+		else if(setting.first == "buffer-size") {
+			if(hasBufferSize) {
+				throw std::runtime_error("Multiple definition of parameter key \"" + setting.first + "\" for MemBufferAppender");
+			}
+			hasBufferSize = true;
+			bufferSize = static_cast<std::size_t>(std::stoul(setting.second));
+		}
+		else if(setting.first == "file") {
+			if(hasFile) {
+				throw std::runtime_error("Multiple definition of parameter key \"" + setting.first + "\" for MemBufferAppender");
+			}
+			hasFile = true;
+			file = setting.second;
+		}
 		else {
 			throw std::runtime_error("Invalid parameter key \"" + setting.first + "\" for MemBufferAppender");
 		}
 	}
 
-	if(!hasMaxLines) {
-		throw std::runtime_error("Missing definition of parameter key \"max-lines\" for MemBufferAppender");
+	if(hasBufferSize) {
+		if(hasMaxLines || hasMaxColumns) {
+			throw std::runtime_error("Parameter key \"buffer-size\" cannot be combined with \"max-lines\" or \"max-columns\" for MemBufferAppender");
+		}
+	}
+	else {
+		if(hasFile) {
+			throw std::runtime_error("Parameter key \"file\" requires parameter key \"buffer-size\" for MemBufferAppender");
+		}
+		if(!hasMaxLines) {
+			throw std::runtime_error("Missing definition of parameter key \"max-lines\" for MemBufferAppender");
+		}
 	}
 }
 
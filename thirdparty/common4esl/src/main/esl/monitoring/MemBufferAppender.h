@@ -22,6 +22,12 @@ public:
 
 		std::size_t maxLines = 0;
 		std::size_t maxColumns = 0;
+
+		/* If bufferSize is not 0, the appender records binary records into a ring of bufferSize bytes (flight recorder).
+		 * maxLines and maxColumns are ignored then. If file is not empty, the ring is a shared mapping of this file.
+		 * It survives a crash of the process and can be rendered by "openesl-flightrecorder". */
+		std::size_t bufferSize = 0;
+		std::string file;
 	};
 
 	MemBufferAppender(const Settings& settings);
@@ -95,6 +95,10 @@ std::string SimpleLayout::toString(const Streams::Location& location) const {
 	return layout->toString(location);
 }
 
+std::size_t SimpleLayout::format(const Streams::Location& location, char* buffer, std::size_t size) const {
+	return layout->format(location, buffer, size);
+}
+
 } /* namespace monitoring */
 } /* inline namespace v1_6 */
 } /* namespace esl */
@@ -34,6 +34,7 @@ public:
 	static std::unique_ptr<Layout> create(const std::vector<std::pair<std::string, std::string>>& settings);
 
 	std::string toString(const Streams::Location& location) const override;
+	std::size_t format(const Streams::Location& location, char* buffer, std::size_t size) const override;
 
 private:
 	std::unique_ptr<Layout> layout;
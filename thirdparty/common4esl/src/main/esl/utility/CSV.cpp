@@ -39,7 +39,7 @@ std::vector<std::string> CSV::splitRow(const std::string& row) {
     for(auto const& c : row) {
         if(c == separator && !escapeState) {
         	columns.push_back(column);
-        	columns.clear();
+        	column.clear();
         	escapeState = false;
             continue;
         }
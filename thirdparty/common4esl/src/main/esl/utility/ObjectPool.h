@@ -19,9 +19,10 @@
 #ifndef ESL_UTILITY_OBJECTPOOL_H_
 #define ESL_UTILITY_OBJECTPOOL_H_
 
-#include <esl/monitoring/Logger.h>
+#include <esl/Logger.h>
 
 #include <chrono>
+#include <functional>
 #include <list>
 #include <memory>
 #include <mutex>
@@ -34,11 +35,11 @@ namespace utility {
 
 template<class Object>
 class ObjectPool {
-	static esl::monitoring::Logger<> logger;
+	static esl::Logger logger;
 
 private:
 	struct Deleter {
-		static esl::monitoring::Logger<> logger;
+		static esl::Logger logger;
 
 		Deleter(ObjectPool& aObjectPool, std::chrono::steady_clock::time_point aTimePointBegin)
 		: objectPool(&aObjectPool),
@@ -139,10 +140,10 @@ private:
 };
 
 template<class Object>
-esl::monitoring::Logger<> ObjectPool<Object>::logger("esl::utility::ObjectPool<>");
+esl::Logger ObjectPool<Object>::logger("esl::utility::ObjectPool<>");
 
 template<class Object>
-esl::monitoring::Logger<> ObjectPool<Object>::Deleter::logger("esl::utility::ObjectPool<>::Deleter");
+esl::Logger ObjectPool<Object>::Deleter::logger("esl::utility::ObjectPool<>::Deleter");
 
 template<class Object>
 ObjectPool<Object>::ObjectPool(CreateObject aCreateObject, size_t aObjectsMax, std::chrono::nanoseconds aObjectLifetime, bool aResetLifetimeOnGet, bool aResetLifetimeOnRelease)
@@ -218,8 +219,20 @@ typename ObjectPool<Object>::unique_ptr ObjectPool<Object>::get(std::chrono::nan
 
 	if(objects.empty()) {
 		ESL__LOGGER_TRACE_THIS("createObject()\n");
-        // create new object
-    	std::unique_ptr<Object> object = createObject();
+		/* create new object without holding the lock, because creating an object might be expensive.
+		 * The object is counted as circulating already, so no other thread can exceed objectsMax. */
+		objectsMutexLock.unlock();
+
+		std::unique_ptr<Object> object;
+		try {
+			object = createObject();
+		}
+		catch(...) {
+			objectsMutexLock.lock();
+			--objectsCirculating;
+			objectsCv.notify_one();
+			throw;
+		}
 		return unique_ptr(object.release(), Deleter(*this, std::chrono::steady_clock::now()));
 	}
 
@@ -347,7 +360,7 @@ bool ObjectPool<Object>::isTimeoutOrDirty(const Object& object, std::chrono::ste
 }
 
 template<class Object>
-bool ObjectPool<Object>::isDirty(const Object& object) {
+bool ObjectPool<Object>::isDirty(const Object&) {
 	return false;
 }
 
@@ -18,9 +18,11 @@
 
 #include <esl/utility/String.h>
 
+#include <common4esl/utility/Codec.h>
+
 #include <algorithm>
 #include <cctype>
-#include <cstdio>
+#include <cstdint>
 #include <iterator>
 #include <map>
 #include <utility>
@@ -54,35 +56,6 @@ std::map<std::string, char> asciiFromEscapeSequences = {
 		std::make_pair("\\\0", '\0')
 };
 
-std::string base64Chars("ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/");
-std::string base64urlChars("ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789-_");
-
-std::string decodeBase64Buffer(std::size_t bufferIndex, unsigned char* buffer) {
-	std::string str;
-
-	for(std::size_t index = bufferIndex; index<4; ++index) {
-		buffer[index] = 0;
-	}
-
-	for(std::size_t index = 0; index<4; ++index) {
-		std::size_t pos = base64Chars.find(buffer[index]);
-		if(pos == std::string::npos) {
-			pos = base64urlChars.find(buffer[index]);
-		}
-		buffer[index] = pos;
-	}
-
-	unsigned char tmpBuffer[3];
-	tmpBuffer[0] = (buffer[0] << 2) + ((buffer[1] & 0x30) >> 4);
-	tmpBuffer[1] = ((buffer[1] & 0xf) << 4) + ((buffer[2] & 0x3c) >> 2);
-	tmpBuffer[2] = ((buffer[2] & 0x3) << 6) + buffer[3];
-
-	for(std::size_t index = 0; index<bufferIndex-1; ++index) {
-		str += tmpBuffer[index];
-	}
-
-	return str;
-}
 }
 
 std::vector<std::string> String::split(const std::string& str, const char separator, bool dropEmptyContent) {
@@ -209,69 +182,55 @@ char String::fromEscapeSequence(std::string::const_iterator& escapeSequenceItera
 }
 
 std::string String::toBase16(const std::string& input) {
-	std::vector<char> output;
-	output.resize(1 + (input.size() * 2));
+	std::string output(input.size() * 2, '\0');
 
-	char* outputCurrent = &output[0];
-
-	for(auto inputCurrent : input) {
-		/* '%.2x' is the same as '%02x'. But du we better want to use '%.2X' or '%02X%' ? */
-		std::snprintf(outputCurrent, 3, "%.2x", static_cast<const unsigned char>(inputCurrent));
-		outputCurrent += 2;
+	if(!input.empty()) {
+		common4esl::utility::Codec::encodeBase16(reinterpret_cast<const std::uint8_t*>(input.data()), input.size(), &output[0]);
 	}
 
-	return std::string(&output[0], input.size() * 2);
+	return output;
 }
 
 std::string String::toBase64(const std::string& str, Base64Variant base64Variant, bool withPadding) {
-	std::string result;
-
-	for(std::size_t i = 0; i < str.size(); i += 3) {
-		int packed64 = (str[i] & 0xff) << 16;
-		std::size_t num64Chars = 2;
-
-		if(i + 1 < str.size()) {
-			packed64 = packed64 + ((str[i+1] & 0xff) << 8);
-			num64Chars = 3;
-		}
-
-		if(i + 2 < str.size()) {
-			packed64 = packed64 + (str[i+2] & 0xff);
-			num64Chars = 4;
-		}
-
-		for(std::size_t j = 0; j < 4; ++j) {
-			if(j < num64Chars) {
-				if(base64Variant == base64url) {
-					result += base64urlChars[(packed64 >> (6 * (3 - j))) & 0x3f];
-				}
-				else {
-					result += base64Chars[(packed64 >> (6 * (3 - j))) & 0x3f];
-				}
-			}
-			else if(withPadding) {
-				if(base64Variant == base64url) {
-					result += "%3d";
-				}
-				else {
-					result += "=";
-				}
-			}
-		}
+	const bool url = base64Variant == base64url;
+	std::string result(common4esl::utility::Codec::getBase64Size(str.size(), url, withPadding), '\0');
+
+	if(!str.empty()) {
+		const std::uint8_t* in = reinterpret_cast<const std::uint8_t*>(str.data());
+		std::size_t groupsSize = str.size() - str.size() % 3;
+		std::size_t count = common4esl::utility::Codec::encodeBase64Groups(in, groupsSize, &result[0], url);
+		common4esl::utility::Codec::encodeBase64Tail(in + groupsSize, str.size() - groupsSize, &result[count], url, withPadding);
 	}
+
 	return result;
 }
 
 std::string String::fromBase64(const std::string& base64str, bool acceptFormatting) {
-	std::string str;
+	/* enough space for all characters and a tail of 3 characters */
+	std::string str(base64str.size() / 4 * 3 + 3, '\0');
+	std::uint8_t* out = reinterpret_cast<std::uint8_t*>(&str[0]);
 
 	std::size_t bufferIndex = 0;
-	unsigned char buffer[4];
+	char buffer[4];
 	bool isNewLineCR = true;
 	bool isNewLineLF = true;
 	bool hasCharacters = false;
 
-	for(std::size_t pos = 0; pos < base64str.size(); ++pos) {
+	std::size_t pos = 0;
+	while(pos < base64str.size()) {
+		/* decode complete groups of base64 characters in bulk */
+		if(bufferIndex == 0) {
+			std::size_t count = common4esl::utility::Codec::decodeBase64Groups(&base64str[pos], base64str.size() - pos, out);
+			if(count > 0) {
+				out += count / 4 * 3;
+				pos += count;
+				isNewLineCR = false;
+				isNewLineLF = false;
+				hasCharacters = true;
+				continue;
+			}
+		}
+
 		// abort if characater base64str[pos] is end symbol
 		if(base64str[pos] == '=') {
 			break;
@@ -284,6 +243,7 @@ std::string String::fromBase64(const std::string& base64str, bool acceptFormatti
 				}
 				else {
 					isNewLineLF = true;
+					++pos;
 					continue;
 				}
 			}
@@ -293,6 +253,7 @@ std::string String::fromBase64(const std::string& base64str, bool acceptFormatti
 				}
 				else {
 					isNewLineCR = true;
+					++pos;
 					continue;
 				}
 			}
@@ -304,13 +265,14 @@ std::string String::fromBase64(const std::string& base64str, bool acceptFormatti
 				else {
 					isNewLineCR = true;
 					isNewLineLF = true;
+					++pos;
 					continue;
 				}
 			}
 		}
 
 		// abort if characater base64str[pos] is not base64
-		if(std::isalnum(base64str[pos]) == 0 && base64str[pos] != '+' && base64str[pos] != '/' && base64str[pos] != '-' && base64str[pos] != '_') {
+		if(common4esl::utility::Codec::getBase64Value(base64str[pos]) < 0) {
 			break;
 		}
 
@@ -319,42 +281,39 @@ std::string String::fromBase64(const std::string& base64str, bool acceptFormatti
 		hasCharacters = true;
 		buffer[bufferIndex] = base64str[pos];
 		++bufferIndex;
+		++pos;
 
 		if(bufferIndex==4) {
-			str += decodeBase64Buffer(bufferIndex, buffer);
+			out += common4esl::utility::Codec::decodeBase64Groups(buffer, 4, out) / 4 * 3;
 			bufferIndex = 0;
 		}
 	}
 
 	if(bufferIndex>0) {
-		str += decodeBase64Buffer(bufferIndex, buffer);
+		out += common4esl::utility::Codec::decodeBase64Tail(buffer, bufferIndex, out);
 	}
 
+	str.resize(static_cast<std::size_t>(out - reinterpret_cast<std::uint8_t*>(&str[0])));
 	return str;
 }
 
 std::string String::toURLEncoded(const std::string& str) {
-	std::string rv;
-
-	rv.reserve(str.size()*3);
+	static const char hexChars[] = "0123456789abcdef";
+	std::string rv(str.size() * 3, '\0');
+	std::size_t count = 0;
 
 	for(const auto c : str) {
-		if(std::isalnum(static_cast<unsigned char>(c)) != 0
-		|| static_cast<unsigned char>(c) == '-'
-		|| static_cast<unsigned char>(c) == '_'
-		|| static_cast<unsigned char>(c) == '.'
-		|| static_cast<unsigned char>(c) == '~') {
-			rv += c;
+		if(common4esl::utility::Codec::isURLUnreserved(c)) {
+			rv[count++] = c;
 		}
 		else {
-			char buffer[3];
-			/* '%.2x' is the same as '%02x'. But du we better want to use '%.2X' or '%02X%' ? */
-			std::snprintf(buffer, 3, "%02x", static_cast<char>(c));
-			rv += '%';
-			rv += buffer;
+			rv[count++] = '%';
+			rv[count++] = hexChars[static_cast<unsigned char>(c) >> 4];
+			rv[count++] = hexChars[static_cast<unsigned char>(c) & 0x0f];
 		}
 	}
 
+	rv.resize(count);
 	return rv;
 }
 
@@ -372,6 +331,13 @@ std::string String::fromURLEncoded(const std::string& urlEncodedStr) {
 		else if(i+1 == urlEncodedStr.size()) {
 			rv += urlEncodedStr[i];
 		}
+		/* fast path for the usual case of two hex digits */
+		else if(i+2 < urlEncodedStr.size()
+				&& common4esl::utility::Codec::getBase16Value(urlEncodedStr[i+1]) >= 0
+				&& common4esl::utility::Codec::getBase16Value(urlEncodedStr[i+2]) >= 0) {
+			rv += static_cast<char>((common4esl::utility::Codec::getBase16Value(urlEncodedStr[i+1]) << 4) | common4esl::utility::Codec::getBase16Value(urlEncodedStr[i+2]));
+			i += 2;
+		}
 		else {
 			std::string part = urlEncodedStr.substr(i+1, i+2 == urlEncodedStr.size() ? 1 : 2);
 			char c = std::stoul(part, nullptr, 16);
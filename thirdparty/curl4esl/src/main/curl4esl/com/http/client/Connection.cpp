@@ -21,6 +21,8 @@ SOFTWARE.
 */
 
 #include <curl4esl/com/http/client/Connection.h>
+#include <curl4esl/com/http/client/ConnectionPool.h>
+#include <curl4esl/com/http/client/Multi.h>
 #include <curl4esl/com/http/client/Send.h>
 
 #include <esl/Logger.h>
@@ -40,37 +42,84 @@ namespace client {
 
 namespace {
 esl::Logger logger("curl4esl::com::http::client::Connection");
+
+/* keeps output and the state of the transfer alive until the transfer is done */
+struct AsyncSend {
+	AsyncSend(CURL* curl, const esl::com::http::client::Request& request, const std::string& requestUrl, esl::io::Output aOutput, std::function<esl::io::Input (const esl::com::http::client::Response&)> createInput, esl::com::http::client::Connection::OnDone aOnDone)
+	: output(std::move(aOutput)),
+	  send(curl, request, requestUrl, output, std::move(createInput)),
+	  onDone(std::move(aOnDone))
+	{ }
+
+	esl::io::Output output;
+	Send send;
+	esl::com::http::client::Connection::OnDone onDone;
+};
 }  // anonymer namespace
 
-Connection::Connection(CURL* aCurl, std::string aHostUrl)
-: curl(aCurl),
+Connection::Connection(CURL* aCurl, std::shared_ptr<Multi> aMulti, std::string aHostUrl)
+: multi(std::move(aMulti)),
+  curl(aCurl),
+  hostUrl(aHostUrl)
+{ }
+
+Connection::Connection(std::shared_ptr<ConnectionPool> aConnectionPool, std::shared_ptr<Multi> aMulti, std::string aHostUrl)
+: connectionPool(std::move(aConnectionPool)),
+  multi(std::move(aMulti)),
+  curl(connectionPool->acquire()),
   hostUrl(aHostUrl)
 { }
 
 Connection::~Connection() {
-    curl_easy_cleanup(curl);
+	if(connectionPool) {
+		connectionPool->release(curl);
+	}
+	else {
+		curl_easy_cleanup(curl);
+	}
 }
 
 esl::com::http::client::Response Connection::send(const esl::com::http::client::Request& request, esl::io::Output output, std::function<esl::io::Input (const esl::com::http::client::Response&)> createInput) const {
-	std::string requestUrl = hostUrl;
-	if(request.getPath().empty() == false && request.getPath().at(0) != '/') {
-		requestUrl += "/";
-	}
-	requestUrl += request.getPath();
-
-	Send send(curl, request, requestUrl, output, createInput);
-	return send.execute();
+	Send send(curl, request, getRequestUrl(request), output, createInput);
+	return send.execute(connectionPool.get());
 }
 
 esl::com::http::client::Response Connection::send(const esl::com::http::client::Request& request, esl::io::Output output, esl::io::Input input) const {
+	Send send(curl, request, getRequestUrl(request), output, std::move(input));
+	return send.execute(connectionPool.get());
+}
+
+void Connection::sendAsync(const esl::com::http::client::Request& request, esl::io::Output output, std::function<esl::io::Input (const esl::com::http::client::Response&)> createInput, OnDone onDone) const {
+	std::shared_ptr<AsyncSend> asyncSend = std::make_shared<AsyncSend>(curl, request, getRequestUrl(request), std::move(output), std::move(createInput), std::move(onDone));
+
+	multi->add(curl, [asyncSend](CURLcode rc) mutable {
+		esl::com::http::client::Response response;
+		std::exception_ptr exception;
+
+		try {
+			response = asyncSend->send.complete(rc);
+		}
+		catch(...) {
+			exception = std::current_exception();
+		}
+
+		/* Destroy the state of the transfer before calling onDone,
+		 * because onDone is allowed to destroy the connection and Send is still using its handle. */
+		esl::com::http::client::Connection::OnDone onDone = std::move(asyncSend->onDone);
+		asyncSend.reset();
+
+		onDone(response, exception);
+	});
+}
+
+std::string Connection::getRequestUrl(const esl::com::http::client::Request& request) const {
 	std::string requestUrl = hostUrl;
 	if(request.getPath().empty() == false && request.getPath().at(0) != '/') {
 		requestUrl += "/";
 	}
 	requestUrl += request.getPath();
 
-	Send send(curl, request, requestUrl, output, std::move(input));
-	return send.execute();
+	return requestUrl;
 }
 
 } /* namespace client */
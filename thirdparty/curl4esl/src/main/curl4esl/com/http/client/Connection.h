@@ -32,6 +32,7 @@ SOFTWARE.
 #include <curl/curl.h>
 
 #include <functional>
+#include <memory>
 #include <string>
 
 namespace curl4esl {
@@ -40,16 +41,29 @@ namespace com {
 namespace http {
 namespace client {
 
+class ConnectionPool;
+class Multi;
+
 class Connection : public esl::com::http::client::Connection {
 friend class Send;
 public:
-	Connection(CURL* curl, std::string hostUrl);
+	// multi is the reactor used by sendAsync
+	Connection(CURL* curl, std::shared_ptr<Multi> multi, std::string hostUrl);
+
+	// uses a handle of connectionPool as long as the connection exists
+	Connection(std::shared_ptr<ConnectionPool> connectionPool, std::shared_ptr<Multi> multi, std::string hostUrl);
 	~Connection();
 
 	esl::com::http::client::Response send(const esl::com::http::client::Request& request, esl::io::Output output, std::function<esl::io::Input (const esl::com::http::client::Response&)> createInput) const override;
 	esl::com::http::client::Response send(const esl::com::http::client::Request& request, esl::io::Output output, esl::io::Input input) const override;
 
+	void sendAsync(const esl::com::http::client::Request& request, esl::io::Output output, std::function<esl::io::Input (const esl::com::http::client::Response&)> createInput, OnDone onDone) const override;
+
 private:
+	std::string getRequestUrl(const esl::com::http::client::Request& request) const;
+
+	std::shared_ptr<ConnectionPool> connectionPool;
+	std::shared_ptr<Multi> multi;
 	CURL* curl;
 	std::string hostUrl;
 };
@@ -22,6 +22,8 @@ SOFTWARE.
 
 #include <curl4esl/com/http/client/ConnectionFactory.h>
 #include <curl4esl/com/http/client/Connection.h>
+#include <curl4esl/com/http/client/ConnectionPool.h>
+#include <curl4esl/com/http/client/Multi.h>
 
 #include <esl/Logger.h>
 #include <esl/system/Stacktrace.h>
@@ -68,10 +70,29 @@ std::string createAuthenticationStr(const std::string& username, const std::stri
 }
 
 ConnectionFactory::ConnectionFactory(const esl::com::http::client::CURLConnectionFactory::Settings& aSettings)
-: settings(aSettings)
+: settings(aSettings),
+  multi(std::make_shared<Multi>()),
+  connectionPool(settings.poolSize > 0 ? std::make_shared<ConnectionPool>(settings, multi) : nullptr)
 { }
 
+ConnectionFactory::~ConnectionFactory() = default;
+
 std::unique_ptr<esl::com::http::client::Connection> ConnectionFactory::createConnection() const {
+	if(connectionPool) {
+		return std::unique_ptr<esl::com::http::client::Connection>(new Connection(connectionPool, multi, settings.url));
+	}
+
+	return std::unique_ptr<esl::com::http::client::Connection>(new Connection(createHandle(settings), multi, settings.url));
+}
+
+esl::com::http::client::CURLConnectionFactory::Statistics ConnectionFactory::getStatistics() const {
+	if(connectionPool) {
+		return connectionPool->getStatistics();
+	}
+	return esl::com::http::client::CURLConnectionFactory::Statistics();
+}
+
+CURL* ConnectionFactory::createHandle(const esl::com::http::client::CURLConnectionFactory::Settings& settings) {
 	CURL* curl = curlSingleton.easyInit();
 
 	curl_easy_setopt(curl, CURLOPT_NOSIGNAL, 1L);
@@ -121,7 +142,7 @@ std::unique_ptr<esl::com::http::client::Connection> ConnectionFactory::createCon
 		curl_easy_setopt(curl, CURLOPT_SSL_VERIFYPEER, 0L);
 	}
 
-	return std::unique_ptr<esl::com::http::client::Connection>(new Connection(curl, settings.url));
+	return curl;
 }
 
 } /* namespace client */
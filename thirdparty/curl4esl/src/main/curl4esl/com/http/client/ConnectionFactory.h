@@ -37,14 +37,27 @@ namespace com {
 namespace http {
 namespace client {
 
+class ConnectionPool;
+class Multi;
+
 class ConnectionFactory : public esl::com::http::client::ConnectionFactory {
 public:
 	ConnectionFactory(const esl::com::http::client::CURLConnectionFactory::Settings& settings);
+	~ConnectionFactory();
 
 	std::unique_ptr<esl::com::http::client::Connection> createConnection() const override;
 
+	esl::com::http::client::CURLConnectionFactory::Statistics getStatistics() const;
+
+	/* creates a new curl handle with all options of settings that are the same for all requests */
+	static CURL* createHandle(const esl::com::http::client::CURLConnectionFactory::Settings& settings);
+
 private:
 	esl::com::http::client::CURLConnectionFactory::Settings settings;
+
+	// connections keep the reactor and the pool alive, so they are shared between factory and its connections
+	std::shared_ptr<Multi> multi;
+	std::shared_ptr<ConnectionPool> connectionPool;
 };
 
 } /* namespace client */
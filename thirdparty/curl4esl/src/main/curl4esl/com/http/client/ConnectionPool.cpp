@@ -0,0 +1,169 @@
+/*
+MIT License
+Copyright (c) 2019-2023 Sven Lukas
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#include <curl4esl/com/http/client/ConnectionPool.h>
+#include <curl4esl/com/http/client/ConnectionFactory.h>
+
+#include <esl/Logger.h>
+#include <esl/system/Stacktrace.h>
+
+#include <chrono>
+#include <stdexcept>
+
+namespace curl4esl {
+inline namespace v1_6 {
+namespace com {
+namespace http {
+namespace client {
+
+namespace {
+esl::Logger logger("curl4esl::com::http::client::ConnectionPool");
+}
+
+ConnectionPool::ConnectionPool(const esl::com::http::client::CURLConnectionFactory::Settings& aSettings, std::shared_ptr<Multi> aMulti)
+: settings(aSettings),
+  share(curl_share_init())
+{
+	if(share == nullptr) {
+		throw esl::system::Stacktrace::add(std::runtime_error("curl share init error"));
+	}
+
+	curl_share_setopt(share, CURLSHOPT_LOCKFUNC, lockCallback);
+	curl_share_setopt(share, CURLSHOPT_UNLOCKFUNC, unlockCallback);
+	curl_share_setopt(share, CURLSHOPT_USERDATA, this);
+	curl_share_setopt(share, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS);
+	curl_share_setopt(share, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION);
+
+	if(settings.multiplexing) {
+		// connections are shared by the multi handle
+		multi = std::move(aMulti);
+	}
+	else {
+		curl_share_setopt(share, CURLSHOPT_SHARE, CURL_LOCK_DATA_CONNECT);
+	}
+
+	idleHandles.reserve(settings.poolSize);
+}
+
+ConnectionPool::~ConnectionPool() {
+	multi.reset();
+
+	for(CURL* curl : idleHandles) {
+		curl_easy_cleanup(curl);
+	}
+
+	curl_share_cleanup(share);
+}
+
+CURL* ConnectionPool::acquire() {
+	std::unique_lock<std::mutex> lock(mutex);
+
+	if(idleHandles.empty() && handleCount < settings.poolSize) {
+		++handleCount;
+		++statistics.misses;
+		lock.unlock();
+
+		try {
+			return createHandle();
+		}
+		catch(...) {
+			lock.lock();
+			--handleCount;
+			throw;
+		}
+	}
+
+	if(idleHandles.empty()) {
+		auto startTime = std::chrono::steady_clock::now();
+		++statistics.waits;
+
+		if(settings.poolTimeout.count() == 0) {
+			condVar.wait(lock, [this] {
+				return !idleHandles.empty();
+			});
+		}
+		else if(!condVar.wait_for(lock, settings.poolTimeout, [this] {
+				return !idleHandles.empty();
+			})) {
+			statistics.waitTime += std::chrono::steady_clock::now() - startTime;
+			throw esl::system::Stacktrace::add(std::runtime_error("curl4esl: timeout while waiting for a free connection of pool for \"" + settings.url + "\"."));
+		}
+
+		statistics.waitTime += std::chrono::steady_clock::now() - startTime;
+	}
+	else {
+		++statistics.hits;
+	}
+
+	CURL* curl = idleHandles.back();
+	idleHandles.pop_back();
+	return curl;
+}
+
+void ConnectionPool::release(CURL* curl) noexcept {
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		idleHandles.push_back(curl);
+	}
+	condVar.notify_one();
+}
+
+CURLcode ConnectionPool::perform(CURL* curl) {
+	if(multi) {
+		return multi->perform(curl);
+	}
+	return curl_easy_perform(curl);
+}
+
+esl::com::http::client::CURLConnectionFactory::Statistics ConnectionPool::getStatistics() const {
+	std::lock_guard<std::mutex> lock(mutex);
+	return statistics;
+}
+
+void ConnectionPool::lockCallback(CURL*, curl_lock_data data, curl_lock_access, void* poolPtr) {
+	static_cast<ConnectionPool*>(poolPtr)->shareMutexes[data].lock();
+}
+
+void ConnectionPool::unlockCallback(CURL*, curl_lock_data data, void* poolPtr) {
+	static_cast<ConnectionPool*>(poolPtr)->shareMutexes[data].unlock();
+}
+
+CURL* ConnectionPool::createHandle() {
+	CURL* curl = ConnectionFactory::createHandle(settings);
+
+	curl_easy_setopt(curl, CURLOPT_SHARE, share);
+
+	if(multi) {
+		curl_easy_setopt(curl, CURLOPT_HTTP_VERSION, CURL_HTTP_VERSION_2TLS);
+		// wait for a connection that can be multiplexed instead of opening a new one
+		curl_easy_setopt(curl, CURLOPT_PIPEWAIT, 1L);
+	}
+
+	return curl;
+}
+
+} /* namespace client */
+} /* namespace http */
+} /* namespace com */
+} /* inline namespace v1_6 */
+} /* namespace curl4esl */
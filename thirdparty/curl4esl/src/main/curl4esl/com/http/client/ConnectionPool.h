@@ -0,0 +1,92 @@
+/*
+MIT License
+Copyright (c) 2019-2023 Sven Lukas
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#ifndef CURL4ESL_COM_HTTP_CLIENT_CONNECTIONPOOL_H_
+#define CURL4ESL_COM_HTTP_CLIENT_CONNECTIONPOOL_H_
+
+#include <curl4esl/com/http/client/Multi.h>
+
+#include <esl/com/http/client/CURLConnectionFactory.h>
+
+#include <curl/curl.h>
+
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace curl4esl {
+inline namespace v1_6 {
+namespace com {
+namespace http {
+namespace client {
+
+/* ConnectionPool keeps preconfigured curl handles for reuse.
+ * All handles share one CURLSH, so DNS cache, TLS sessions and open connections are reused by every handle of the pool. */
+class ConnectionPool {
+public:
+	// multi is used to perform transfers if multiplexing is enabled
+	ConnectionPool(const esl::com::http::client::CURLConnectionFactory::Settings& settings, std::shared_ptr<Multi> multi);
+	ConnectionPool(const ConnectionPool&) = delete;
+	~ConnectionPool();
+
+	ConnectionPool& operator=(const ConnectionPool&) = delete;
+
+	/* thread-safe. Returns an idle handle, creates a new handle or waits until a handle gets released. */
+	CURL* acquire();
+
+	/* thread-safe */
+	void release(CURL* curl) noexcept;
+
+	/* thread-safe. Performs the transfer on the multi handle if multiplexing is enabled, otherwise by curl_easy_perform. */
+	CURLcode perform(CURL* curl);
+
+	esl::com::http::client::CURLConnectionFactory::Statistics getStatistics() const;
+
+private:
+	static void lockCallback(CURL* curl, curl_lock_data data, curl_lock_access access, void* poolPtr);
+	static void unlockCallback(CURL* curl, curl_lock_data data, void* poolPtr);
+
+	CURL* createHandle();
+
+	esl::com::http::client::CURLConnectionFactory::Settings settings;
+
+	CURLSH* share = nullptr;
+	std::mutex shareMutexes[CURL_LOCK_DATA_LAST];
+
+	mutable std::mutex mutex;
+	std::condition_variable condVar;
+	std::vector<CURL*> idleHandles;
+	unsigned int handleCount = 0;
+	esl::com::http::client::CURLConnectionFactory::Statistics statistics;
+
+	std::shared_ptr<Multi> multi;
+};
+
+} /* namespace client */
+} /* namespace http */
+} /* namespace com */
+} /* inline namespace v1_6 */
+} /* namespace curl4esl */
+
+#endif /* CURL4ESL_COM_HTTP_CLIENT_CONNECTIONPOOL_H_ */
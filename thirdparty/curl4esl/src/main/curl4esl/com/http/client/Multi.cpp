@@ -0,0 +1,206 @@
+/*
+MIT License
+Copyright (c) 2019-2023 Sven Lukas
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#include <curl4esl/com/http/client/Multi.h>
+
+#include <esl/Logger.h>
+#include <esl/system/Stacktrace.h>
+
+#include <stdexcept>
+
+namespace curl4esl {
+inline namespace v1_6 {
+namespace com {
+namespace http {
+namespace client {
+
+namespace {
+esl::Logger logger("curl4esl::com::http::client::Multi");
+}
+
+Multi::Multi()
+: multi(curl_multi_init())
+{
+	if(multi == nullptr) {
+		throw esl::system::Stacktrace::add(std::runtime_error("curl multi init error"));
+	}
+
+	curl_multi_setopt(multi, CURLMOPT_PIPELINING, CURLPIPE_MULTIPLEX);
+}
+
+Multi::~Multi() {
+	bool wasStarted;
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		isStopped = true;
+		wasStarted = isStarted;
+	}
+
+	if(wasStarted) {
+		if(std::this_thread::get_id() == thread.get_id()) {
+			/* A completion handler has released the last reference to this object.
+			 * The reactor thread cannot join itself, so run() returns as soon as the handler is done. */
+			*reactorDestroyed = true;
+			thread.detach();
+		}
+		else {
+			curl_multi_wakeup(multi);
+			thread.join();
+		}
+	}
+
+	for(auto& transfer : runningTransfers) {
+		curl_multi_remove_handle(multi, transfer.first);
+		done(transfer.second, CURLE_ABORTED_BY_CALLBACK);
+	}
+	for(auto& transfer : pendingTransfers) {
+		done(transfer.second, CURLE_ABORTED_BY_CALLBACK);
+	}
+
+	curl_multi_cleanup(multi);
+}
+
+void Multi::add(CURL* curl, std::function<void(CURLcode)> onDone) {
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+		if(isStopped) {
+			throw esl::system::Stacktrace::add(std::runtime_error("curl4esl: cannot add transfer because reactor has been stopped."));
+		}
+
+		pendingTransfers.emplace_back(curl, std::move(onDone));
+
+		if(!isStarted) {
+			isStarted = true;
+			thread = std::thread(&Multi::run, this);
+		}
+	}
+	curl_multi_wakeup(multi);
+}
+
+CURLcode Multi::perform(CURL* curl) {
+	std::mutex doneMutex;
+	std::condition_variable doneCondVar;
+	bool isDone = false;
+	CURLcode rc = CURLE_OK;
+
+	add(curl, [&](CURLcode aRc) {
+		std::lock_guard<std::mutex> lock(doneMutex);
+		rc = aRc;
+		isDone = true;
+		doneCondVar.notify_one();
+	});
+
+	std::unique_lock<std::mutex> lock(doneMutex);
+	doneCondVar.wait(lock, [&isDone] {
+		return isDone;
+	});
+
+	return rc;
+}
+
+void Multi::run() {
+	/* set by the destructor if it is called by a completion handler, so we must not touch this object anymore */
+	bool isDestroyed = false;
+	reactorDestroyed = &isDestroyed;
+
+	std::vector<std::pair<CURL*, std::function<void(CURLcode)>>> failedTransfers;
+
+	while(true) {
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			if(isStopped) {
+				break;
+			}
+
+			for(auto& transfer : pendingTransfers) {
+				CURLMcode mrc = curl_multi_add_handle(multi, transfer.first);
+				if(mrc != CURLM_OK) {
+					logger.warn << "curl_multi_add_handle failed: " << curl_multi_strerror(mrc) << "\n";
+					failedTransfers.push_back(std::move(transfer));
+					continue;
+				}
+				runningTransfers.insert(std::move(transfer));
+			}
+			pendingTransfers.clear();
+		}
+
+		/* completion handlers are called without holding the mutex, because they might destroy this object */
+		while(!failedTransfers.empty()) {
+			{
+				std::function<void(CURLcode)> onDone = std::move(failedTransfers.back().second);
+				failedTransfers.pop_back();
+				done(onDone, CURLE_FAILED_INIT);
+			}
+			if(isDestroyed) {
+				return;
+			}
+		}
+
+		int runningHandles = 0;
+		curl_multi_perform(multi, &runningHandles);
+
+		int messagesLeft = 0;
+		while(CURLMsg* message = curl_multi_info_read(multi, &messagesLeft)) {
+			if(message->msg != CURLMSG_DONE) {
+				continue;
+			}
+
+			CURL* curl = message->easy_handle;
+			CURLcode rc = message->data.result;
+			curl_multi_remove_handle(multi, curl);
+
+			auto iter = runningTransfers.find(curl);
+			if(iter == runningTransfers.end()) {
+				continue;
+			}
+			{
+				std::function<void(CURLcode)> onDone = std::move(iter->second);
+				runningTransfers.erase(iter);
+				done(onDone, rc);
+			}
+			if(isDestroyed) {
+				return;
+			}
+		}
+
+		curl_multi_poll(multi, nullptr, 0, 1000, nullptr);
+	}
+}
+
+void Multi::done(std::function<void(CURLcode)>& onDone, CURLcode rc) noexcept {
+	try {
+		onDone(rc);
+	}
+	catch(const std::exception& e) {
+		logger.error << "Exception thrown by completion handler of transfer: " << e.what() << "\n";
+	}
+	catch(...) {
+		logger.error << "Unknown exception thrown by completion handler of transfer\n";
+	}
+}
+
+} /* namespace client */
+} /* namespace http */
+} /* namespace com */
+} /* inline namespace v1_6 */
+} /* namespace curl4esl */
@@ -0,0 +1,86 @@
+/*
+MIT License
+Copyright (c) 2019-2023 Sven Lukas
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#ifndef CURL4ESL_COM_HTTP_CLIENT_MULTI_H_
+#define CURL4ESL_COM_HTTP_CLIENT_MULTI_H_
+
+#include <curl/curl.h>
+
+#include <condition_variable>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace curl4esl {
+inline namespace v1_6 {
+namespace com {
+namespace http {
+namespace client {
+
+/* Multi runs all transfers that have been added on one curl_multi handle by a separate reactor thread.
+ * Transfers to the same host share their connections, so HTTP/2 requests are multiplexed on one connection.
+ * The reactor thread is started when the first transfer is added.
+ * A completion handler may release the last reference to Multi. Then the reactor thread is detached instead of joined. */
+class Multi {
+public:
+	Multi();
+	Multi(const Multi&) = delete;
+	~Multi();
+
+	Multi& operator=(const Multi&) = delete;
+
+	/* thread-safe. "onDone" is called by the reactor thread as soon as the transfer is done.
+	 * All callbacks of "curl" are called by the reactor thread as well. */
+	void add(CURL* curl, std::function<void(CURLcode)> onDone);
+
+	/* thread-safe. Blocks until the transfer is done. */
+	CURLcode perform(CURL* curl);
+
+private:
+	void run();
+	static void done(std::function<void(CURLcode)>& onDone, CURLcode rc) noexcept;
+
+	CURLM* multi = nullptr;
+
+	std::mutex mutex;
+	std::vector<std::pair<CURL*, std::function<void(CURLcode)>>> pendingTransfers;
+	bool isStopped = false;
+	bool isStarted = false;
+
+	// accessed by reactor thread only
+	std::map<CURL*, std::function<void(CURLcode)>> runningTransfers;
+	bool* reactorDestroyed = nullptr;
+
+	std::thread thread;
+};
+
+} /* namespace client */
+} /* namespace http */
+} /* namespace com */
+} /* inline namespace v1_6 */
+} /* namespace curl4esl */
+
+#endif /* CURL4ESL_COM_HTTP_CLIENT_MULTI_H_ */
@@ -22,6 +22,7 @@ SOFTWARE.
 
 #include <curl4esl/com/http/client/Send.h>
 #include <curl4esl/com/http/client/Connection.h>
+#include <curl4esl/com/http/client/ConnectionPool.h>
 
 #include <esl/Logger.h>
 #include <esl/io/Reader.h>
@@ -138,14 +139,22 @@ Send::Send(CURL* aCurl, const esl::com::http::client::Request& request, const st
 }
 
 Send::~Send() {
+	/* reset options that refer to this object or that are not set by every request, so the handle can be used for the next request */
+	curl_easy_setopt(curl, CURLOPT_HTTPHEADER, nullptr);
+	curl_easy_setopt(curl, CURLOPT_POSTFIELDSIZE, -1L);
+	curl_easy_setopt(curl, CURLOPT_READFUNCTION, nullptr);
+	curl_easy_setopt(curl, CURLOPT_READDATA, nullptr);
+
 	if(requestHeaders) {
 		curl_slist_free_all(requestHeaders);
 	}
 }
 
-esl::com::http::client::Response Send::execute() {
-	CURLcode rc = curl_easy_perform(curl);
+esl::com::http::client::Response Send::execute(ConnectionPool* connectionPool) {
+	return complete(connectionPool ? connectionPool->perform(curl) : curl_easy_perform(curl));
+}
 
+esl::com::http::client::Response Send::complete(CURLcode rc) {
 	if(exceptionPtr) {
 		std::rethrow_exception(exceptionPtr);
 	}
@@ -46,13 +46,19 @@ namespace com {
 namespace http {
 namespace client {
 
+class ConnectionPool;
+
 class Send {
 public:
 	Send(CURL* curl, const esl::com::http::client::Request& request, const std::string& requestUrl, esl::io::Output& output, std::function<esl::io::Input (const esl::com::http::client::Response&)> createInput);
 	Send(CURL* curl, const esl::com::http::client::Request& request, const std::string& requestUrl, esl::io::Output& output, esl::io::Input input);
 	~Send();
 
-	esl::com::http::client::Response execute();
+	// connectionPool is nullptr if the handle is not pooled
+	esl::com::http::client::Response execute(ConnectionPool* connectionPool);
+
+	// returns the response of a transfer that has been performed with result code "rc"
+	esl::com::http::client::Response complete(CURLcode rc);
 
 private:
 	Send(CURL* curl, const esl::com::http::client::Request& request, const std::string& requestUrl, esl::io::Output& output, esl::io::Input input, std::function<esl::io::Input (const esl::com::http::client::Response&)> createInput);
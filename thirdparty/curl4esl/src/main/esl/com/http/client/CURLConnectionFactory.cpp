@@ -42,6 +42,9 @@ CURLConnectionFactory::Settings::Settings(const std::vector<std::pair<std::strin
 	bool hasUserAgent = false;
 	bool hasTimeout = false;
 	bool hasSkipSSLVerification = false;
+	bool hasPoolSize = false;
+	bool hasPoolTimeout = false;
+	bool hasMultiplexing = false;
 
     for(const auto& setting : settings) {
 		if(setting.first == "url") {
@@ -166,6 +169,47 @@ CURLConnectionFactory::Settings::Settings(const std::vector<std::pair<std::strin
 			}
 		}
 
+		else if(setting.first == "pool-size") {
+			if(hasPoolSize) {
+	            throw system::Stacktrace::add(std::runtime_error("curl4esl: multiple definition of attribute 'pool-size'."));
+			}
+			hasPoolSize = true;
+			int i = utility::String::toNumber<int>(setting.second);
+			if(i < 0) {
+	            throw system::Stacktrace::add(std::runtime_error("curl4esl: Invalid value \"" + setting.second + "\" for attribute 'pool-size'."));
+			}
+			poolSize = static_cast<unsigned int>(i);
+		}
+
+		else if(setting.first == "pool-timeout") {
+			if(hasPoolTimeout) {
+	            throw system::Stacktrace::add(std::runtime_error("curl4esl: multiple definition of attribute 'pool-timeout'."));
+			}
+			hasPoolTimeout = true;
+			long ms = utility::String::toNumber<long>(setting.second);
+			if(ms < 0) {
+	            throw system::Stacktrace::add(std::runtime_error("curl4esl: Invalid value \"" + setting.second + "\" for attribute 'pool-timeout'."));
+			}
+			poolTimeout = std::chrono::milliseconds(ms);
+		}
+
+		else if(setting.first == "multiplexing") {
+			if(hasMultiplexing) {
+	            throw system::Stacktrace::add(std::runtime_error("curl4esl: multiple definition of attribute 'multiplexing'."));
+			}
+			hasMultiplexing = true;
+			std::string value = utility::String::toLower(setting.second);
+			if(value == "true") {
+				multiplexing = true;
+			}
+			else if(value == "false") {
+				multiplexing = false;
+			}
+			else {
+		    	throw system::Stacktrace::add(std::runtime_error("curl4esl: Invalid value \"" + setting.second + "\" for attribute 'multiplexing'"));
+			}
+		}
+
 		else {
 			throw system::Stacktrace::add(std::runtime_error("Key \"" + setting.first + "\" is unknown"));
 		}
@@ -211,6 +255,10 @@ std::unique_ptr<Connection> CURLConnectionFactory::createConnection() const {
 	return connectionFactory->createConnection();
 }
 
+CURLConnectionFactory::Statistics CURLConnectionFactory::getStatistics() const {
+	return static_cast<const curl4esl::com::http::client::ConnectionFactory&>(*connectionFactory).getStatistics();
+}
+
 } /* namespace client */
 } /* namespace http */
 } /* namespace com */
@@ -26,6 +26,8 @@ SOFTWARE.
 #include <esl/com/http/client/Connection.h>
 #include <esl/com/http/client/ConnectionFactory.h>
 
+#include <chrono>
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <utility>
@@ -59,6 +61,28 @@ public:
 		std::string userAgent = "esl-http-client";
 
 		bool skipSSLVerification = false;
+
+		/* Maximum number of curl handles that are kept by the factory. 0 disables pooling, so each connection gets its own handle.
+		 * Pooled handles share DNS cache, TLS sessions and open connections. */
+		unsigned int poolSize = 0;
+
+		/* Maximum time createConnection() waits for a free handle if all handles of the pool are in use. 0 means to wait forever. */
+		std::chrono::milliseconds poolTimeout = std::chrono::milliseconds(0);
+
+		/* Runs all transfers of pooled handles on one curl_multi handle, so concurrent requests share HTTP/2 connections. Requires "pool-size" > 0. */
+		bool multiplexing = false;
+	};
+
+	struct Statistics {
+		// number of connections that got an idle handle of the pool
+		std::uint64_t hits = 0;
+
+		// number of connections that got a new handle
+		std::uint64_t misses = 0;
+
+		// number of connections that had to wait for a handle because all handles of the pool were in use
+		std::uint64_t waits = 0;
+		std::chrono::nanoseconds waitTime = std::chrono::nanoseconds(0);
 	};
 
 	CURLConnectionFactory(const Settings& settings);
@@ -68,6 +92,9 @@ public:
 
 	std::unique_ptr<Connection> createConnection() const override;
 
+	/* returns empty statistics if pooling is disabled */
+	Statistics getStatistics() const;
+
 private:
 	std::unique_ptr<ConnectionFactory> connectionFactory;
 };
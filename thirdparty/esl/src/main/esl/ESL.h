@@ -55,8 +55,11 @@ SOFTWARE.
 #include <esl/database/PreparedStatement.h>
 #include <esl/database/ResultSet.h>
 
+#include <esl/io/input/Base64.h>
 #include <esl/io/input/Closed.h>
+#include <esl/io/input/File.h>
 #include <esl/io/input/String.h>
+#include <esl/io/output/Base64.h>
 #include <esl/io/output/Buffered.h>
 #include <esl/io/output/File.h>
 #include <esl/io/output/Function.h>
@@ -31,8 +31,10 @@ inline namespace v1_6 {
 
 #ifdef ESL_MONITORING_LEVEL_DEBUG
 using Logger = monitoring::Logger<monitoring::Streams::Level::trace>;
+using BinaryLogger = monitoring::Logger<monitoring::Streams::Level::trace, monitoring::Streams::Binary>;
 #else
 using Logger = monitoring::Logger<monitoring::Streams::Level::warn>;
+using BinaryLogger = monitoring::Logger<monitoring::Streams::Level::warn, monitoring::Streams::Binary>;
 #endif
 
 } /* inline namespace v1_6 */
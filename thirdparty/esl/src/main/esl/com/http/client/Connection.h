@@ -28,6 +28,7 @@ SOFTWARE.
 #include <esl/io/Input.h>
 #include <esl/io/Output.h>
 
+#include <exception>
 #include <functional>
 
 namespace esl {
@@ -43,6 +44,15 @@ public:
 
 	virtual Response send(const Request& request, io::Output output, std::function<io::Input (const Response&)> createInput) const = 0;
 	virtual Response send(const Request& request, io::Output output, io::Input input) const = 0;
+
+	/* "exception" is set if the request failed. In this case "response" is empty. */
+	using OnDone = std::function<void(const Response& response, std::exception_ptr exception)>;
+
+	/* Sends the request without blocking the calling thread. "onDone" is called as soon as the request is done.
+	 * The reader of "output", "createInput", the writer of the input and "onDone" might be called by another thread.
+	 * The connection must neither be destroyed nor used for another request until "onDone" has been called.
+	 * Default implementation calls "send" and "onDone" in the calling thread. */
+	virtual void sendAsync(const Request& request, io::Output output, std::function<io::Input (const Response&)> createInput, OnDone onDone) const;
 };
 
 } /* namespace client */
@@ -41,6 +41,16 @@ public:
 
 	virtual bool send(const Response& response, io::Output output) = 0;
 	virtual bool sendFile(const Response& response, const std::string& path) = 0;
+
+	/* Tells the socket that the response will be sent later, maybe by another thread.
+	 * This method has to be called within RequestHandler::accept or while the request body is written to the returned input.
+	 * The connection is suspended as soon as the request body has been read completely, so no worker thread of the socket is blocked while waiting.
+	 * Call "send" or "sendFile" followed by "resume" to complete the request. "resume" has to be called exactly once and before the socket is released.
+	 * Default implementation throws an exception because suspending is not supported. */
+	virtual void suspend();
+
+	/* thread-safe. Completes a suspended request. The queued response is sent by the socket. */
+	virtual void resume();
 };
 
 } /* namespace server */
@@ -41,6 +41,9 @@ public:
 	//virtual ResultSet getTable(const std::string& tableName) = 0;
 
 	virtual void commit() const = 0;
+
+	/* Does nothing if there is no open transaction, e.g. in autocommit mode.
+	 * PooledConnectionFactory calls it for every connection that is given back. */
 	virtual void rollback() const = 0;
 
 	virtual bool isClosed() const = 0;
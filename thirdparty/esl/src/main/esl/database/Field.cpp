@@ -26,9 +26,12 @@ SOFTWARE.
 #include <esl/system/Stacktrace.h>
 
 #include <cctype>
+#include <cstring>
 #include <algorithm>
+#include <new>
 #include <vector>
 #include <stdexcept>
+#include <utility>
 
 namespace esl {
 inline namespace v1_6 {
@@ -111,8 +114,8 @@ std::string Field::toString(double i) {
 }
 
 template<>
-std::string Field::toString(const std::string& str) {
-	return str;
+std::string Field::toString(std::string_view str) {
+	return std::string(str);
 }
 
 template<>
@@ -131,8 +134,8 @@ std::int64_t Field::toInteger(double i) {
 }
 
 template<>
-std::int64_t Field::toInteger(const std::string& str) {
-	return std::stoll(str);
+std::int64_t Field::toInteger(std::string_view str) {
+	return std::stoll(std::string(str));
 }
 
 template<>
@@ -151,8 +154,8 @@ double Field::toDouble(double i) {
 }
 
 template<>
-double Field::toDouble(const std::string& str) {
-	return std::stod(str);
+double Field::toDouble(std::string_view str) {
+	return std::stod(std::string(str));
 }
 
 template<>
@@ -171,9 +174,9 @@ bool Field::toBoolean(double i) {
 }
 
 template<>
-bool Field::toBoolean(const std::string& str) {
-	std::string s;
-	std::transform(str.begin(), str.end(), s.begin(),
+bool Field::toBoolean(std::string_view str) {
+	std::string s(str);
+	std::transform(s.begin(), s.end(), s.begin(),
 			[](unsigned char c) { return std::toupper(c); });
 
 	if(s == "TRUE" || s == "-1" || s == "1" || s == "T" || s == "J" || s == "Y" || s == "YES") {
@@ -182,48 +185,41 @@ bool Field::toBoolean(const std::string& str) {
 	return false;
 }
 
+Field::Field()
+{ }
+
 Field::Field(const Field& aField)
 : columnType(aField.getColumnType())
 {
-	if(aField.isNull()) {
-		(*this) = nullptr;
-	}
-	else {
-		switch(toFieldType(aField.getColumnType())) {
-
-		case Type::storageBoolean:
-			setValue(aField.valueBoolean);
-			break;
-
-		case Type::storageInteger:
-			setValue(aField.valueInteger);
-			break;
-
-		case Type::storageDouble:
-			setValue(aField.valueDouble);
-			break;
-
-		case Type::storageString:
-			setValue(aField.valueString);
-			break;
-
-		case Type::storageEmpty:
-		default:
-			break;
-		}
-	}
+	setValue(aField);
 }
 
 Field::Field(Field&& aField)
 : resultSet(aField.resultSet),
   columnIndex(aField.columnIndex),
   columnType(aField.columnType),
-  valueIsNull(aField.valueIsNull),
-  valueBoolean(aField.valueBoolean),
-  valueInteger(aField.valueInteger),
-  valueDouble(aField.valueDouble),
-  valueString(std::move(aField.valueString))
+  valueIsNull(aField.valueIsNull)
 {
+	switch(aField.stringStorage) {
+	case StringStorage::longString:
+		new (&longString) std::string(std::move(aField.longString));
+		stringStorage = StringStorage::longString;
+		break;
+	case StringStorage::shortString:
+		std::memcpy(shortString, aField.shortString, aField.shortStringSize);
+		shortStringSize = aField.shortStringSize;
+		stringStorage = StringStorage::shortString;
+		break;
+	case StringStorage::view:
+		/* the buffer of the view belongs to the driver, so this field needs its own copy */
+		storeString(aField.viewString);
+		break;
+	default:
+		valueInteger = aField.valueInteger;
+		break;
+	}
+
+	aField.destroyString();
 	aField.resultSet = nullptr;
 	aField.columnIndex = 0;
 	aField.columnType = Column::Type::sqlUnknown;
@@ -236,7 +232,7 @@ Field::Field(Column::Type aColumnType)
 
 Field::Field(ResultSet& aResultSet, std::size_t aColumnIndex)
 : resultSet(&aResultSet),
-  columnIndex(aColumnIndex)
+  columnIndex(static_cast<std::uint32_t>(aColumnIndex))
 {
 	const Column* column = getColumn();
 	if(column) {
@@ -246,9 +242,10 @@ Field::Field(ResultSet& aResultSet, std::size_t aColumnIndex)
 
 Field::Field(bool value)
 : columnType(toColumnType(Type::storageBoolean)),
-  valueIsNull(false),
-  valueBoolean(value)
-{ }
+  valueIsNull(false)
+{
+	valueBoolean = value;
+}
 
 Field::Field(int value)
 : columnType(toColumnType(Type::storageInteger)),
@@ -264,21 +261,38 @@ Field::Field(std::int64_t value)
 
 Field::Field(double value)
 : columnType(toColumnType(Type::storageDouble)),
-  valueIsNull(false),
-  valueDouble(value)
-{ }
+  valueIsNull(false)
+{
+	valueDouble = value;
+}
 
 Field::Field(const std::string& value)
-: columnType(toColumnType(Type::storageString)),
-  valueIsNull(false),
-  valueString(value)
-{ }
+: columnType(toColumnType(Type::storageString))
+{
+	setValue(std::string_view(value));
+}
+
+Field::Field(std::string&& value)
+: columnType(toColumnType(Type::storageString))
+{
+	setValue(std::move(value));
+}
+
+Field::Field(std::string_view value)
+: columnType(toColumnType(Type::storageString))
+{
+	setValue(value);
+}
 
 Field::Field(const char* value)
-: columnType(toColumnType(Type::storageString)),
-  valueIsNull(false),
-  valueString(value ? value : "")
-{ }
+: columnType(toColumnType(Type::storageString))
+{
+	setValue(std::string_view(value ? value : ""));
+}
+
+Field::~Field() {
+	destroyString();
+}
 
 Field::operator bool() const {
 	return asBoolean();
@@ -313,28 +327,18 @@ bool Field::asBoolean() const {
         throw system::Stacktrace::add(std::runtime_error("null value"));
 	}
 
-	switch(columnType) {
-	case Column::Type::sqlBoolean:
+	switch(toFieldType(columnType)) {
+	case Type::storageBoolean:
 		return valueBoolean;
 
-	case Column::Type::sqlInteger:
-	case Column::Type::sqlSmallInt:
+	case Type::storageInteger:
 		return toBoolean(valueInteger);
 
-	case Column::Type::sqlDouble:
-	case Column::Type::sqlNumeric:
-	case Column::Type::sqlDecimal:
-	case Column::Type::sqlFloat:
-	case Column::Type::sqlReal:
+	case Type::storageDouble:
 		return toBoolean(valueDouble);
 
-	case Column::Type::sqlVarChar:
-	case Column::Type::sqlChar:
-		return toBoolean<const std::string&>(valueString);
-	/*{
-		const std::string& v(valueString);
-		return toBoolean(v);
-	}*/
+	case Type::storageString:
+		return toBoolean(getStringView());
 
 	default:
 		break;
@@ -347,24 +351,18 @@ std::int64_t Field::asInteger() const {
         throw system::Stacktrace::add(std::runtime_error("null value"));
 	}
 
-	switch(columnType) {
-	case Column::Type::sqlBoolean:
+	switch(toFieldType(columnType)) {
+	case Type::storageBoolean:
 		return toInteger(valueBoolean);
 
-	case Column::Type::sqlInteger:
-	case Column::Type::sqlSmallInt:
+	case Type::storageInteger:
 		return valueInteger;
 
-	case Column::Type::sqlDouble:
-	case Column::Type::sqlNumeric:
-	case Column::Type::sqlDecimal:
-	case Column::Type::sqlFloat:
-	case Column::Type::sqlReal:
+	case Type::storageDouble:
 		return toInteger(valueDouble);
 
-	case Column::Type::sqlVarChar:
-	case Column::Type::sqlChar:
-		return toInteger<const std::string&>(valueString);
+	case Type::storageString:
+		return toInteger(getStringView());
 
 	default:
 		break;
@@ -377,24 +375,18 @@ double Field::asDouble() const {
         throw system::Stacktrace::add(std::runtime_error("null value"));
 	}
 
-	switch(columnType) {
-	case Column::Type::sqlBoolean:
+	switch(toFieldType(columnType)) {
+	case Type::storageBoolean:
 		return toDouble(valueBoolean);
 
-	case Column::Type::sqlInteger:
-	case Column::Type::sqlSmallInt:
+	case Type::storageInteger:
 		return toDouble(valueInteger);
 
-	case Column::Type::sqlDouble:
-	case Column::Type::sqlNumeric:
-	case Column::Type::sqlDecimal:
-	case Column::Type::sqlFloat:
-	case Column::Type::sqlReal:
+	case Type::storageDouble:
 		return valueDouble;
 
-	case Column::Type::sqlVarChar:
-	case Column::Type::sqlChar:
-		return toDouble<const std::string&>(valueString);
+	case Type::storageString:
+		return toDouble(getStringView());
 
 	default:
 		break;
@@ -407,24 +399,18 @@ std::string Field::asString() const {
         throw system::Stacktrace::add(std::runtime_error("null value"));
 	}
 
-	switch(columnType) {
-	case Column::Type::sqlBoolean:
+	switch(toFieldType(columnType)) {
+	case Type::storageBoolean:
 		return toString(valueBoolean);
 
-	case Column::Type::sqlInteger:
-	case Column::Type::sqlSmallInt:
+	case Type::storageInteger:
 		return toString(valueInteger);
 
-	case Column::Type::sqlDouble:
-	case Column::Type::sqlNumeric:
-	case Column::Type::sqlDecimal:
-	case Column::Type::sqlFloat:
-	case Column::Type::sqlReal:
+	case Type::storageDouble:
 		return toString(valueDouble);
 
-	case Column::Type::sqlVarChar:
-	case Column::Type::sqlChar:
-		return valueString;
+	case Type::storageString:
+		return std::string(getStringView());
 
 	default:
 		break;
@@ -432,51 +418,62 @@ std::string Field::asString() const {
 	return "";
 }
 
-Field& Field::operator=(const Field& aField) {
-	if(resultSet == nullptr) {
-		columnType = aField.getColumnType();
+std::string_view Field::asStringView() const {
+	if(isNull()) {
+        throw system::Stacktrace::add(std::runtime_error("null value"));
 	}
 
-	if(aField.isNull()) {
-		(*this) = nullptr;
+	if(toFieldType(columnType) != Type::storageString) {
+        throw system::Stacktrace::add(std::runtime_error("value is not stored as string"));
 	}
-	else {
-		switch(toFieldType(aField.getColumnType())) {
-		case Type::storageBoolean:
-			setValue(aField.valueBoolean);
-			break;
 
-		case Type::storageInteger:
-			setValue(aField.valueInteger);
-			break;
-
-		case Type::storageDouble:
-			setValue(aField.valueDouble);
-			break;
+	return getStringView();
+}
 
-		case Type::storageString:
-			setValue(aField.valueString);
-			break;
+Field& Field::operator=(const Field& aField) {
+	if(&aField == this) {
+		return *this;
+	}
 
-		case Type::storageEmpty:
-		default:
-			break;
+	if(resultSet == nullptr) {
+		if(toFieldType(columnType) == Type::storageString && toFieldType(aField.getColumnType()) != Type::storageString) {
+			destroyString();
 		}
+		columnType = aField.getColumnType();
 	}
+
+	setValue(aField);
 	return *this;
 }
 
 Field& Field::operator=(Field&& other) {
 	if(&other != this) {
+		destroyString();
+
 		resultSet = other.resultSet;
 		columnIndex = other.columnIndex;
 		columnType = other.columnType;
 		valueIsNull = other.valueIsNull;
-		valueBoolean = other.valueBoolean;
-		valueInteger = other.valueInteger;
-		valueDouble = other.valueDouble;
-		valueString = std::move(other.valueString);
 
+		switch(other.stringStorage) {
+		case StringStorage::longString:
+			new (&longString) std::string(std::move(other.longString));
+			stringStorage = StringStorage::longString;
+			break;
+		case StringStorage::shortString:
+			std::memcpy(shortString, other.shortString, other.shortStringSize);
+			shortStringSize = other.shortStringSize;
+			stringStorage = StringStorage::shortString;
+			break;
+		case StringStorage::view:
+			storeString(other.viewString);
+			break;
+		default:
+			valueInteger = other.valueInteger;
+			break;
+		}
+
+		other.destroyString();
 		other.resultSet = nullptr;
 		other.columnIndex = 0;
 		other.columnType = Column::Type::sqlUnknown;
@@ -523,10 +520,43 @@ Field& Field::operator=(double value) {
 }
 
 Field& Field::operator=(const std::string& value) {
-	setValueOperator<const std::string&>(value);
+	setValueOperator(std::string_view(value));
+	return *this;
+}
+
+Field& Field::operator=(std::string&& value) {
+	Type fieldType = toFieldType(columnType);
+	if(fieldType == Type::storageString || columnType == Column::Type::sqlUnknown) {
+		setValue(std::move(value));
+	}
+	else {
+		setValueOperator(std::string_view(value));
+	}
 	return *this;
 }
 
+Field& Field::operator=(std::string_view value) {
+	setValueOperator(value);
+	return *this;
+}
+
+Field& Field::operator=(const char* value) {
+	setValueOperator(std::string_view(value ? value : ""));
+	return *this;
+}
+
+void Field::setView(std::string_view value) {
+	checkStringColumn();
+	destroyString();
+
+	viewString = value;
+	stringStorage = StringStorage::view;
+	valueIsNull = false;
+	if(resultSet) {
+		resultSet->setChanged(columnIndex);
+	}
+}
+
 const Column* Field::getColumn() const {
 	if(resultSet && resultSet->getColumns()) {
 		if(columnIndex >= resultSet->getColumns()->size()) {
@@ -551,15 +581,15 @@ Field::Type Field::getSimpleType() const {
 }
 
 template<>
-void Field::setValueOperator(const std::string& value) {
+void Field::setValueOperator(std::string_view value) {
 	switch(columnType) {
 	case Column::Type::sqlBoolean: {
-		setValue(toBoolean<const std::string&>(value));
+		setValue(toBoolean(value));
 		break;
 	}
 	case Column::Type::sqlInteger:
 	case Column::Type::sqlSmallInt: {
-		setValue(toInteger<const std::string&>(value));
+		setValue(toInteger(value));
 		break;
 	}
 	case Column::Type::sqlDouble:
@@ -567,19 +597,11 @@ void Field::setValueOperator(const std::string& value) {
 	case Column::Type::sqlDecimal:
 	case Column::Type::sqlFloat:
 	case Column::Type::sqlReal: {
-		setValue(toDouble<const std::string&>(value));
-		break;
-	}
-	case Column::Type::sqlVarChar:
-	case Column::Type::sqlChar: {
-		setValue(toString<const std::string&>(value));
-		break;
-	}
-	case Column::Type::sqlUnknown: {
-		setValue(value);
+		setValue(toDouble(value));
 		break;
 	}
 	default:
+		setValue(value);
 		break;
 	}
 }
@@ -601,6 +623,7 @@ void Field::setValue(bool value) {
 		}
 	}
 
+	destroyString();
 	valueIsNull = false;
 	valueBoolean = value;
 	if(resultSet) {
@@ -626,6 +649,7 @@ void Field::setValue(std::int64_t value) {
 		}
 	}
 
+	destroyString();
 	valueIsNull = false;
 	valueInteger = value;
 	if(resultSet) {
@@ -654,6 +678,7 @@ void Field::setValue(double value) {
 		}
 	}
 
+	destroyString();
 	valueIsNull = false;
 	valueDouble = value;
 	if(resultSet) {
@@ -661,31 +686,120 @@ void Field::setValue(double value) {
 	}
 }
 
-void Field::setValue(const std::string& value) {
-	if(columnType == Column::Type::sqlUnknown) {
-		columnType = Column::Type::sqlVarChar;
+void Field::setValue(std::string_view value) {
+	checkStringColumn();
+	if(valueIsNull == false && getStringView() == value) {
+		return;
 	}
-	else {
-		switch(columnType) {
-		case Column::Type::sqlVarChar:
-		case Column::Type::sqlChar:
-			break;
-		default:
-	        throw system::Stacktrace::add(std::runtime_error("column is not string"));
-		}
 
-		if(valueIsNull == false && valueString == value) {
-			return;
-		}
+	storeString(value);
+	valueIsNull = false;
+	if(resultSet) {
+		resultSet->setChanged(columnIndex);
+	}
+}
+
+void Field::setValue(std::string&& value) {
+	checkStringColumn();
+	if(valueIsNull == false && getStringView() == value) {
+		return;
+	}
+
+	if(stringStorage == StringStorage::longString) {
+		longString = std::move(value);
+	}
+	else if(value.size() <= shortStringCapacity) {
+		std::memcpy(shortString, value.data(), value.size());
+		shortStringSize = static_cast<std::uint8_t>(value.size());
+		stringStorage = StringStorage::shortString;
+	}
+	else {
+		new (&longString) std::string(std::move(value));
+		stringStorage = StringStorage::longString;
 	}
 
 	valueIsNull = false;
-	valueString = value;
 	if(resultSet) {
 		resultSet->setChanged(columnIndex);
 	}
 }
 
+void Field::storeString(std::string_view value) {
+	if(stringStorage == StringStorage::longString) {
+		/* keep the capacity of the long string */
+		longString.assign(value.data(), value.size());
+	}
+	else if(value.size() <= shortStringCapacity) {
+		std::memcpy(shortString, value.data(), value.size());
+		shortStringSize = static_cast<std::uint8_t>(value.size());
+		stringStorage = StringStorage::shortString;
+	}
+	else {
+		new (&longString) std::string(value);
+		stringStorage = StringStorage::longString;
+	}
+}
+
+void Field::checkStringColumn() {
+	if(columnType == Column::Type::sqlUnknown) {
+		columnType = Column::Type::sqlVarChar;
+	}
+	else if(toFieldType(columnType) != Type::storageString) {
+        throw system::Stacktrace::add(std::runtime_error("column is not string"));
+	}
+}
+
+void Field::setValue(const Field& other) {
+	if(other.isNull()) {
+		(*this) = nullptr;
+		return;
+	}
+
+	switch(toFieldType(other.getColumnType())) {
+	case Type::storageBoolean:
+		setValue(other.valueBoolean);
+		break;
+
+	case Type::storageInteger:
+		setValue(other.valueInteger);
+		break;
+
+	case Type::storageDouble:
+		setValue(other.valueDouble);
+		break;
+
+	case Type::storageString:
+		setValue(other.getStringView());
+		break;
+
+	case Type::storageEmpty:
+	default:
+		break;
+	}
+}
+
+void Field::destroyString() noexcept {
+	if(stringStorage == StringStorage::longString) {
+		longString.~basic_string();
+	}
+	stringStorage = StringStorage::none;
+	shortStringSize = 0;
+}
+
+std::string_view Field::getStringView() const noexcept {
+	switch(stringStorage) {
+	case StringStorage::shortString:
+		return std::string_view(shortString, shortStringSize);
+	case StringStorage::longString:
+		return longString;
+	case StringStorage::view:
+		return viewString;
+	default:
+		break;
+	}
+	return std::string_view();
+}
+
 } /* namespace database */
 } /* inline namespace v1_6 */
 } /* namespace esl */
@@ -28,17 +28,28 @@ SOFTWARE.
 #include <cstdint>
 #include <cstddef>
 #include <string>
+#include <string_view>
 
 namespace esl {
 inline namespace v1_6 {
 namespace database {
 
-class ResultSet;
 class Column;
 
+/* Field, and the classes that hold it by value or take it as argument, are in namespace v1_7 since the
+ * layout of Field has changed. Binaries built against the previous layout do not link with this version. */
+inline namespace v1_7 {
+
+class ResultSet;
+
+/* Field stores its value in a tagged union. Strings up to shortStringCapacity characters are stored inline,
+ * longer strings in a std::string that keeps its capacity for following assignments of the same field.
+ * Drivers can also store a view to their own buffer by setView, see below. */
 class Field {
 	friend class ResultSet;
 public:
+	static constexpr std::size_t shortStringCapacity = 31;
+
 	enum class Type {
 		storageBoolean,
 		storageInteger,
@@ -47,7 +58,7 @@ public:
 		storageEmpty
 	};
 
-	Field() = default;
+	Field();
 	Field(const Field&);
 	Field(Field&& field);
 
@@ -58,7 +69,10 @@ public:
 	Field(std::int64_t value);
 	Field(double value);
 	Field(const std::string& value);
+	Field(std::string&& value);
+	Field(std::string_view value);
 	Field(const char* value);
+	~Field();
 
 
 	explicit operator bool() const;
@@ -74,6 +88,10 @@ public:
 	double asDouble() const;
 	std::string asString() const;
 
+	/* returns the string without a copy. It is valid until the field gets changed or destroyed.
+	 * Throws if the value is NULL or if it is not stored as string. */
+	std::string_view asStringView() const;
+
 	Field& operator=(const Field&);
 	Field& operator=(Field&& other);
 	Field& operator=(std::nullptr_t);
@@ -83,9 +101,16 @@ public:
 	Field& operator=(float value);
 	Field& operator=(double value);
 	Field& operator=(const std::string& value);
+	Field& operator=(std::string&& value);
+
+	/* copies the string, e.g. from a buffer owned by a driver */
+	Field& operator=(std::string_view value);
+	Field& operator=(const char* value);
 
-	// TODO : see unixODBC4esl::...::BindResult::setField(...)
-	// Field& operator=(std::string&& value);
+	/* stores a reference to the string or blob without a copy. This is used by drivers to refer directly to their
+	 * buffers, so the view must stay valid until the field gets changed again, e.g. by the next fetch.
+	 * Copies of this field store a copy of the string. */
+	void setView(std::string_view value);
 
 	const Column* getColumn() const;
 
@@ -111,6 +136,13 @@ private:
 	template<typename T>
 	static bool toBoolean(T t);
 
+	enum class StringStorage : std::uint8_t {
+		none,
+		shortString,
+		longString,
+		view
+	};
+
 	template<typename T>
 	void setValueOperator(T value) {
 		switch(columnType) {
@@ -132,40 +164,58 @@ private:
 			setValue(toDouble(value));
 			break;
 		}
-		case Column::Type::sqlVarChar:
-		case Column::Type::sqlChar: {
-			setValue(toString(value));
-			break;
-		}
 		case Column::Type::sqlUnknown: {
 			setValue(value);
 			break;
 		}
-		default:
+		default: {
+			std::string str = toString(value);
+			setValue(std::string_view(str));
 			break;
 		}
+		}
 	}
 
 	void setValue(bool value);
 	void setValue(std::int64_t value);
 	void setValue(double value);
-	void setValue(const std::string& value);
+	void setValue(std::string_view value);
+	void setValue(std::string&& value);
+
+	/* copies value into the inline or long string storage */
+	void storeString(std::string_view value);
+
+	/* throws if the column type cannot store a string */
+	void checkStringColumn();
+
+	/* copies value and type of "other" if it is not null */
+	void setValue(const Field& other);
+
+	void destroyString() noexcept;
+	std::string_view getStringView() const noexcept;
 
 	ResultSet* resultSet = nullptr;
-	std::size_t columnIndex = 0;
+	std::uint32_t columnIndex = 0;
 	Column::Type columnType = Column::Type::sqlUnknown;
 
 	bool valueIsNull = true;
-
-	bool valueBoolean = false;
-	std::int64_t valueInteger = 0;
-	double valueDouble = 0;
-	std::string valueString;
+	StringStorage stringStorage = StringStorage::none;
+	std::uint8_t shortStringSize = 0;
+
+	union {
+		bool valueBoolean;
+		std::int64_t valueInteger = 0;
+		double valueDouble;
+		char shortString[shortStringCapacity];
+		std::string longString;
+		std::string_view viewString;
+	};
 };
 
 template<>
-void Field::setValueOperator(const std::string& value);
+void Field::setValueOperator(std::string_view value);
 
+} /* inline namespace v1_7 */
 } /* namespace database */
 } /* inline namespace v1_6 */
 } /* namespace esl */
@@ -25,6 +25,9 @@ SOFTWARE.
 #include <esl/monitoring/Streams.h>
 #include <esl/monitoring/Logger.h>
 
+#include <exception>
+#include <utility>
+
 namespace esl {
 inline namespace v1_6 {
 namespace database {
@@ -37,6 +40,26 @@ PreparedBulkStatement::PreparedBulkStatement(std::unique_ptr<Binding> aBinding)
 : binding(std::move(aBinding))
 { }
 
+PreparedBulkStatement::~PreparedBulkStatement() {
+	try {
+		flush();
+	}
+	catch(const std::exception& e) {
+		logger.warn << "Flushing bulk statement in destructor failed: " << e.what() << "\n";
+	}
+	catch(...) {
+		logger.warn << "Flushing bulk statement in destructor failed with unknown exception\n";
+	}
+}
+
+PreparedBulkStatement& PreparedBulkStatement::operator=(PreparedBulkStatement&& other) {
+	if(this != &other) {
+		flush();
+		binding = std::move(other.binding);
+	}
+	return *this;
+}
+
 PreparedBulkStatement::operator bool() const noexcept {
 	return binding ? true : false;
 }
@@ -55,6 +78,21 @@ PreparedBulkStatement& PreparedBulkStatement::execute(const std::vector<Field>&
 	return *this;
 }
 
+PreparedBulkStatement& PreparedBulkStatement::execute(const std::vector<std::vector<Field>>& rows) {
+	if(binding) {
+		for(const auto& fields : rows) {
+			binding->execute(fields);
+		}
+	}
+	return *this;
+}
+
+void PreparedBulkStatement::flush() {
+	if(binding) {
+		binding->flush();
+	}
+}
+
 void* PreparedBulkStatement::getNativeHandle() const {
 	if(binding) {
 		return binding->getNativeHandle();
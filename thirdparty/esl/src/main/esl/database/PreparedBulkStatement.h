@@ -33,6 +33,7 @@ SOFTWARE.
 namespace esl {
 inline namespace v1_6 {
 namespace database {
+inline namespace v1_7 {
 
 class PreparedBulkStatement {
 public:
@@ -41,7 +42,11 @@ public:
 		virtual ~Binding() = default;
 
 		virtual const std::vector<Column>& getParameterColumns() const = 0;
+
+		/* Implementations may collect rows and send them as a batch. flush() has to send collected rows. */
 		virtual void execute(const std::vector<Field>& fields) = 0;
+		virtual void flush() { }
+
 		virtual void* getNativeHandle() const = 0;
 	};
 
@@ -55,11 +60,15 @@ public:
 	explicit operator bool() const noexcept;
 
 	PreparedBulkStatement& operator=(const PreparedBulkStatement&) = delete;
-	PreparedBulkStatement& operator=(PreparedBulkStatement&& other) = default;
+	/* flushes rows collected by this statement before it takes over the binding of "other" */
+	PreparedBulkStatement& operator=(PreparedBulkStatement&& other);
 
 	const std::vector<Column>& getParameterColumns() const;
 
+	/* Rows might be collected by the implementation and sent as a batch.
+	 * Call flush() to make sure all rows have been sent, e.g. before commit. */
 	PreparedBulkStatement& execute(const std::vector<Field>& fields);
+	PreparedBulkStatement& execute(const std::vector<std::vector<Field>>& rows);
 
     template<typename... Args>
     PreparedBulkStatement& execute(Args... args) {
@@ -110,6 +119,7 @@ private:
 	std::unique_ptr<Binding> binding;
 };
 
+} /* inline namespace v1_7 */
 } /* namespace database */
 } /* inline namespace v1_6 */
 } /* namespace esl */
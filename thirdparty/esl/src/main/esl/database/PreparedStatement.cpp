@@ -23,6 +23,12 @@ SOFTWARE.
 #include <esl/database/PreparedStatement.h>
 #include <esl/monitoring/Streams.h>
 #include <esl/monitoring/Logger.h>
+#include <esl/io/Reader.h>
+#include <esl/system/Stacktrace.h>
+
+#include <stdexcept>
+#include <string>
+#include <utility>
 
 namespace esl {
 inline namespace v1_6 {
@@ -31,6 +37,34 @@ namespace {
 std::vector<Column> emptyColumns;
 monitoring::Logger<monitoring::Streams::Level::trace> logger("esl::database::PreparedStatement");
 }
+
+ResultSet PreparedStatement::Binding::execute(const std::vector<Field>& fields, std::vector<io::Output>& outputs) {
+	if(outputs.empty()) {
+		return execute(fields);
+	}
+
+	if(outputs.size() != fields.size()) {
+	    throw system::Stacktrace::add(std::runtime_error("Wrong number of outputs. Given " + std::to_string(outputs.size()) + " outputs but " + std::to_string(fields.size()) + " fields."));
+	}
+
+	std::vector<Field> values(fields);
+	for(std::size_t i=0; i<outputs.size(); ++i) {
+		if(!outputs[i]) {
+			continue;
+		}
+
+		io::Reader& reader = outputs[i].getReader();
+		std::string str;
+		char buffer[4096];
+		for(std::size_t size = reader.read(buffer, sizeof(buffer)); size != io::Reader::npos; size = reader.read(buffer, sizeof(buffer))) {
+			str.append(buffer, size);
+		}
+		values[i] = std::move(str);
+	}
+
+	return execute(values);
+}
+
 /*
 PreparedStatement::PreparedStatement(PreparedStatement&& other)
 : binding(std::move(other.binding))
@@ -76,6 +110,13 @@ ResultSet PreparedStatement::execute(const std::vector<Field>& fields) {
 	return ResultSet();
 }
 
+ResultSet PreparedStatement::execute(const std::vector<Field>& fields, std::vector<io::Output>& outputs) {
+	if(binding) {
+		return binding->execute(fields, outputs);
+	}
+	return ResultSet();
+}
+
 void* PreparedStatement::getNativeHandle() const {
 	if(binding) {
 		return binding->getNativeHandle();
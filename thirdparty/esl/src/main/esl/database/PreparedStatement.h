@@ -26,6 +26,7 @@ SOFTWARE.
 #include <esl/database/Column.h>
 #include <esl/database/ResultSet.h>
 #include <esl/database/Field.h>
+#include <esl/io/Output.h>
 
 #include <vector>
 #include <memory>
@@ -33,6 +34,7 @@ SOFTWARE.
 namespace esl {
 inline namespace v1_6 {
 namespace database {
+inline namespace v1_7 {
 
 class PreparedStatement {
 public:
@@ -43,6 +45,11 @@ public:
 		virtual const std::vector<Column>& getParameterColumns() const = 0;
 		virtual const std::vector<Column>& getResultColumns() const = 0;
 		virtual ResultSet execute(const std::vector<Field>& fields) = 0;
+
+		/* Like execute(fields), but parameters with a valid entry in "outputs" get their value from this output.
+		 * Drivers like ODBC send it in chunks, the default implementation reads it into a field first. */
+		virtual ResultSet execute(const std::vector<Field>& fields, std::vector<io::Output>& outputs);
+
 		virtual void* getNativeHandle() const = 0;
 	};
 
@@ -63,6 +70,10 @@ public:
 
 	ResultSet execute(const std::vector<Field>& fields);
 
+	/* "outputs" is empty or has an entry for each parameter. Parameters with a valid output are streamed
+	 * from it, e.g. a large document from the body of a HTTP request, and their entry in "fields" is ignored. */
+	ResultSet execute(const std::vector<Field>& fields, std::vector<io::Output>& outputs);
+
 	ResultSet execute();
 
     template<typename... Args>
@@ -112,6 +123,7 @@ private:
 	std::unique_ptr<Binding> binding;
 };
 
+} /* inline namespace v1_7 */
 } /* namespace database */
 } /* inline namespace v1_6 */
 } /* namespace esl */
@@ -0,0 +1,236 @@
+/*
+MIT License
+Copyright (c) 2019-2025 Sven Lukas
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+#include <esl/database/ResultBatch.h>
+#include <esl/system/Stacktrace.h>
+
+#include <stdexcept>
+
+namespace esl {
+inline namespace v1_6 {
+namespace database {
+
+ResultBatch::Storage ResultBatch::Array::getStorage() const noexcept {
+	return storage;
+}
+
+void ResultBatch::Array::setStorage(Storage aStorage) {
+	storage = aStorage;
+	clear();
+}
+
+std::size_t ResultBatch::Array::size() const noexcept {
+	return rowCount;
+}
+
+bool ResultBatch::Array::isNull(std::size_t row) const noexcept {
+	return nullCount > 0 && (nullBitmap[row / 64] & (std::uint64_t(1) << (row % 64))) != 0;
+}
+
+bool ResultBatch::Array::hasNulls() const noexcept {
+	return nullCount > 0;
+}
+
+const std::uint64_t* ResultBatch::Array::getNullBitmap() const noexcept {
+	return nullBitmap.data();
+}
+
+const std::int64_t* ResultBatch::Array::getIntegers() const noexcept {
+	return integers.data();
+}
+
+const double* ResultBatch::Array::getDoubles() const noexcept {
+	return doubles.data();
+}
+
+const std::size_t* ResultBatch::Array::getStringOffsets() const noexcept {
+	return stringOffsets.data();
+}
+
+const char* ResultBatch::Array::getStringData() const noexcept {
+	return stringData.data();
+}
+
+std::string ResultBatch::Array::getString(std::size_t row) const {
+	if(storage != Storage::string) {
+        throw system::Stacktrace::add(std::runtime_error("cannot get string of a column that has no string storage."));
+	}
+	if(row >= rowCount) {
+        throw system::Stacktrace::add(std::out_of_range("row " + std::to_string(row) + " is out of range. Batch has " + std::to_string(rowCount) + " rows."));
+	}
+	return std::string(stringData.data() + stringOffsets[row], stringOffsets[row+1] - stringOffsets[row]);
+}
+
+void ResultBatch::Array::clear() {
+	rowCount = 0;
+	nullCount = 0;
+	nullBitmap.clear();
+	integers.clear();
+	doubles.clear();
+	stringOffsets.resize(1);
+	stringData.clear();
+}
+
+void ResultBatch::Array::reserve(std::size_t rows) {
+	nullBitmap.reserve((rows + 63) / 64);
+	switch(storage) {
+	case Storage::integer:
+		integers.reserve(rows);
+		break;
+	case Storage::real:
+		doubles.reserve(rows);
+		break;
+	case Storage::string:
+		stringOffsets.reserve(rows + 1);
+		break;
+	}
+}
+
+void ResultBatch::Array::addNull() {
+	switch(storage) {
+	case Storage::integer:
+		integers.push_back(0);
+		break;
+	case Storage::real:
+		doubles.push_back(0.0);
+		break;
+	case Storage::string:
+		stringOffsets.push_back(stringData.size());
+		break;
+	}
+	addRow(true);
+}
+
+void ResultBatch::Array::addInteger(std::int64_t value) {
+	switch(storage) {
+	case Storage::integer:
+		integers.push_back(value);
+		break;
+	case Storage::real:
+		doubles.push_back(static_cast<double>(value));
+		break;
+	case Storage::string: {
+		std::string str = std::to_string(value);
+		stringData.insert(stringData.end(), str.begin(), str.end());
+		stringOffsets.push_back(stringData.size());
+		break;
+	}
+	}
+	addRow(false);
+}
+
+void ResultBatch::Array::addDouble(double value) {
+	switch(storage) {
+	case Storage::integer:
+		integers.push_back(static_cast<std::int64_t>(value));
+		break;
+	case Storage::real:
+		doubles.push_back(value);
+		break;
+	case Storage::string: {
+		std::string str = std::to_string(value);
+		stringData.insert(stringData.end(), str.begin(), str.end());
+		stringOffsets.push_back(stringData.size());
+		break;
+	}
+	}
+	addRow(false);
+}
+
+void ResultBatch::Array::addString(const char* data, std::size_t size) {
+	switch(storage) {
+	case Storage::integer:
+		integers.push_back(std::stoll(std::string(data, size)));
+		break;
+	case Storage::real:
+		doubles.push_back(std::stod(std::string(data, size)));
+		break;
+	case Storage::string:
+		stringData.insert(stringData.end(), data, data + size);
+		stringOffsets.push_back(stringData.size());
+		break;
+	}
+	addRow(false);
+}
+
+void ResultBatch::Array::addRow(bool isNull) {
+	if(rowCount % 64 == 0) {
+		nullBitmap.push_back(0);
+	}
+	if(isNull) {
+		nullBitmap.back() |= std::uint64_t(1) << (rowCount % 64);
+		++nullCount;
+	}
+	++rowCount;
+}
+
+ResultBatch::Storage ResultBatch::getStorage(Column::Type columnType) noexcept {
+	switch(columnType) {
+	case Column::Type::sqlInteger:
+	case Column::Type::sqlSmallInt:
+		return Storage::integer;
+
+	case Column::Type::sqlDouble:
+	case Column::Type::sqlNumeric:
+	case Column::Type::sqlDecimal:
+	case Column::Type::sqlFloat:
+	case Column::Type::sqlReal:
+		return Storage::real;
+
+	default:
+		break;
+	}
+	return Storage::string;
+}
+
+std::size_t ResultBatch::getRowCount() const noexcept {
+	return arrays.empty() ? 0 : arrays.front().size();
+}
+
+std::size_t ResultBatch::getColumnCount() const noexcept {
+	return arrays.size();
+}
+
+const ResultBatch::Array& ResultBatch::operator[](std::size_t index) const {
+	if(index >= arrays.size()) {
+        throw system::Stacktrace::add(std::out_of_range("column index " + std::to_string(index) + " is out of range. Batch has " + std::to_string(arrays.size()) + " columns."));
+	}
+	return arrays[index];
+}
+
+ResultBatch::Array& ResultBatch::operator[](std::size_t index) {
+	if(index >= arrays.size()) {
+        throw system::Stacktrace::add(std::out_of_range("column index " + std::to_string(index) + " is out of range. Batch has " + std::to_string(arrays.size()) + " columns."));
+	}
+	return arrays[index];
+}
+
+void ResultBatch::reset(std::size_t columnCount) {
+	arrays.resize(columnCount);
+	for(auto& array : arrays) {
+		array.clear();
+	}
+}
+
+} /* namespace database */
+} /* inline namespace v1_6 */
+} /* namespace esl */
@@ -0,0 +1,116 @@
+/*
+MIT License
+Copyright (c) 2019-2025 Sven Lukas
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#ifndef ESL_DATABASE_RESULTBATCH_H_
+#define ESL_DATABASE_RESULTBATCH_H_
+
+#include <esl/database/Column.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace esl {
+inline namespace v1_6 {
+namespace database {
+
+/* ResultBatch contains a block of rows of a ResultSet column by column.
+ * Values of a column are stored in a contiguous array of its storage type, so consumers can loop over a column
+ * without touching Field objects. Buffers are kept if a batch is reused for the next ResultSet::fetchBatch call. */
+class ResultBatch {
+public:
+	enum class Storage {
+		integer,
+		real,
+		string
+	};
+
+	class Array {
+	public:
+		Storage getStorage() const noexcept;
+
+		/* changes the storage type and removes all values */
+		void setStorage(Storage storage);
+
+		std::size_t size() const noexcept;
+
+		bool isNull(std::size_t row) const noexcept;
+		bool hasNulls() const noexcept;
+
+		/* bit (row % 64) of element (row / 64) is set if the value of row is NULL */
+		const std::uint64_t* getNullBitmap() const noexcept;
+
+		/* values of storage type integer or real. NULL values are stored as 0. */
+		const std::int64_t* getIntegers() const noexcept;
+		const double* getDoubles() const noexcept;
+
+		/* values of storage type string. Value of row is located at getStringData() + getStringOffsets()[row]
+		 * and ends at getStringData() + getStringOffsets()[row+1]. NULL values are empty. */
+		const std::size_t* getStringOffsets() const noexcept;
+		const char* getStringData() const noexcept;
+		std::string getString(std::size_t row) const;
+
+		void clear();
+		void reserve(std::size_t rows);
+
+		void addNull();
+		void addInteger(std::int64_t value);
+		void addDouble(double value);
+		void addString(const char* data, std::size_t size);
+
+	private:
+		Storage storage = Storage::string;
+		std::size_t rowCount = 0;
+		std::size_t nullCount = 0;
+
+		std::vector<std::uint64_t> nullBitmap;
+		std::vector<std::int64_t> integers;
+		std::vector<double> doubles;
+		std::vector<std::size_t> stringOffsets = std::vector<std::size_t>(1, 0);
+		std::vector<char> stringData;
+
+		void addRow(bool isNull);
+	};
+
+	/* returns the storage type that is used for values of columnType */
+	static Storage getStorage(Column::Type columnType) noexcept;
+
+	std::size_t getRowCount() const noexcept;
+	std::size_t getColumnCount() const noexcept;
+
+	const Array& operator[](std::size_t index) const;
+	Array& operator[](std::size_t index);
+
+	/* sets the number of columns and removes all values but keeps storage types and buffers */
+	void reset(std::size_t columnCount);
+
+private:
+	std::vector<Array> arrays;
+};
+
+} /* namespace database */
+} /* inline namespace v1_6 */
+} /* namespace esl */
+
+#endif /* ESL_DATABASE_RESULTBATCH_H_ */
@@ -26,7 +26,11 @@ SOFTWARE.
 #include <esl/monitoring/Streams.h>
 #include <esl/system/Stacktrace.h>
 
+#include <algorithm>
+#include <cstring>
 #include <stdexcept>
+#include <string>
+#include <string_view>
 
 namespace esl {
 inline namespace v1_6 {
@@ -34,10 +38,74 @@ namespace database {
 
 namespace {
 monitoring::Logger<monitoring::Streams::Level::trace> logger("esl::database::ResultSet");
+
+class FieldReader : public io::Reader {
+public:
+	FieldReader(const Field& field);
+
+	std::size_t read(void* data, std::size_t size) override;
+	const void* peek(std::size_t& size) override;
+	void skip(std::size_t size) override;
+	std::size_t getSizeReadable() const override;
+	bool hasSize() const override;
+	std::size_t getSize() const override;
+
+private:
+	/* used if the value is not stored as string */
+	std::string str;
+	std::string_view value;
+	std::size_t pos = 0;
+};
+
+FieldReader::FieldReader(const Field& field) {
+	if(field.getSimpleType() == Field::Type::storageString) {
+		value = field.asStringView();
+	}
+	else {
+		str = field.asString();
+		value = str;
+	}
+}
+
+std::size_t FieldReader::read(void* data, std::size_t size) {
+	if(pos >= value.size()) {
+		return npos;
+	}
+
+	if(size > value.size() - pos) {
+		size = value.size() - pos;
+	}
+	std::memcpy(data, value.data() + pos, size);
+	pos += size;
+
+	return size;
+}
+
+const void* FieldReader::peek(std::size_t& size) {
+	size = getSizeReadable();
+	return size == 0 ? nullptr : value.data() + pos;
+}
+
+void FieldReader::skip(std::size_t size) {
+	pos += std::min(size, getSizeReadable());
+}
+
+std::size_t FieldReader::getSizeReadable() const {
+	return value.size() - pos;
+}
+
+bool FieldReader::hasSize() const {
+	return true;
+}
+
+std::size_t FieldReader::getSize() const {
+	return value.size();
+}
 }
 
 ResultSet::Binding::Binding(const std::vector<Column>& aColumns)
-: columns(aColumns)
+: columns(aColumns),
+  deferred(aColumns.size(), false)
 {
 }
 
@@ -45,6 +113,61 @@ const std::vector<Column>& ResultSet::Binding::getColumns() const {
 	return columns;
 }
 
+bool ResultSet::Binding::fetchBatch(ResultBatch& batch, std::size_t maxRows, std::vector<Field>& fields) {
+	for(std::size_t i=0; i<columns.size(); ++i) {
+		batch[i].setStorage(ResultBatch::getStorage(columns[i].getType()));
+		batch[i].reserve(maxRows);
+	}
+
+	for(std::size_t row = 0; row < maxRows; ++row) {
+		if(row > 0 && fetch(fields) == false) {
+			return false;
+		}
+
+		for(std::size_t i=0; i<columns.size(); ++i) {
+			ResultBatch::Array& array = batch[i];
+			if(fields[i].isNull()) {
+				array.addNull();
+				continue;
+			}
+
+			switch(array.getStorage()) {
+			case ResultBatch::Storage::integer:
+				array.addInteger(fields[i].asInteger());
+				break;
+			case ResultBatch::Storage::real:
+				array.addDouble(fields[i].asDouble());
+				break;
+			case ResultBatch::Storage::string: {
+				std::string str = fields[i].asString();
+				array.addString(str.data(), str.size());
+				break;
+			}
+			}
+		}
+	}
+
+	return true;
+}
+
+bool ResultSet::Binding::isDeferred(std::size_t index) const noexcept {
+	return deferred[index];
+}
+
+void ResultSet::Binding::setDeferred(std::size_t index, bool isDeferred) {
+	deferred[index] = isDeferred;
+}
+
+void ResultSet::Binding::loadDeferred(std::size_t, std::vector<Field>&) {
+}
+
+io::Output ResultSet::Binding::getOutput(std::size_t, const Field& field) {
+	if(field.isNull()) {
+		return io::Output();
+	}
+	return io::Output(std::unique_ptr<io::Reader>(new FieldReader(field)));
+}
+
 ResultSet::ResultSet(ResultSet&& other)
 : binding(std::move(other.binding)),
   fields(std::move(other.fields)),
@@ -105,6 +228,7 @@ const Field& ResultSet::operator[](const std::string& name) const {
 	if(iter == nameToIndex.end()) {
         throw system::Stacktrace::add(std::runtime_error("unknown field \"" + name + "\" requested."));
 	}
+	loadDeferred(iter->second);
 	return fields[iter->second];
 }
 
@@ -117,6 +241,7 @@ Field& ResultSet::operator[](const std::string& name) {
 	if(iter == nameToIndex.end()) {
         throw system::Stacktrace::add(std::runtime_error("unknown field \"" + name + "\" requested."));
 	}
+	loadDeferred(iter->second);
 	return fields[iter->second];
 }
 
@@ -133,6 +258,7 @@ const Field& ResultSet::operator[](std::size_t index) const {
 	        throw system::Stacktrace::add(std::out_of_range("field index " + std::to_string(index) + " is out of range. Valid index is between 0 and " + std::to_string(fields.size() - 1) + "."));
 		}
 	}
+	loadDeferred(index);
 	return fields[index];
 }
 
@@ -149,9 +275,41 @@ Field& ResultSet::operator[](std::size_t index) {
 	        throw system::Stacktrace::add(std::out_of_range("field index " + std::to_string(index) + " is out of range. Valid index is between 0 and " + std::to_string(fields.size() - 1) + "."));
 		}
 	}
+	loadDeferred(index);
 	return fields[index];
 }
 
+std::string_view ResultSet::getView(const std::string& name) const {
+	return (*this)[name].asStringView();
+}
+
+std::string_view ResultSet::getView(std::size_t index) const {
+	return (*this)[index].asStringView();
+}
+
+io::Output ResultSet::getOutput(const std::string& name) {
+	if(!binding) {
+        throw system::Stacktrace::add(std::runtime_error("cannot access field \"" + name + "\" because record set it empty."));
+	}
+
+	auto iter = nameToIndex.find(name);
+	if(iter == nameToIndex.end()) {
+        throw system::Stacktrace::add(std::runtime_error("unknown field \"" + name + "\" requested."));
+	}
+	return binding->getOutput(iter->second, fields[iter->second]);
+}
+
+io::Output ResultSet::getOutput(std::size_t index) {
+	if(!binding) {
+        throw system::Stacktrace::add(std::runtime_error("cannot access field at index \"" + std::to_string(index) + "\" because record set it empty."));
+	}
+
+	if(index >= fields.size()) {
+        throw system::Stacktrace::add(std::out_of_range("field index " + std::to_string(index) + " is out of range. ResultSet has " + std::to_string(fields.size()) + " fields."));
+	}
+	return binding->getOutput(index, fields[index]);
+}
+
 const std::vector<Column>* ResultSet::getColumns() const {
 	if(binding) {
 		return &binding->getColumns();
@@ -181,6 +339,30 @@ void ResultSet::next() {
 	valuesChanged = false;
 }
 
+std::size_t ResultSet::fetchBatch(ResultBatch& batch, std::size_t maxRows) {
+	batch.reset(fields.size());
+	if(!binding || maxRows == 0) {
+		return 0;
+	}
+
+	save();
+
+	fetching = true;
+	try {
+		if(binding->fetchBatch(batch, maxRows, fields) == false || binding->fetch(fields) == false) {
+			binding.reset();
+		}
+	}
+	catch(...) {
+		fetching = false;
+		throw;
+	}
+	fetching = false;
+	valuesChanged = false;
+
+	return batch.getRowCount();
+}
+
 void ResultSet::add() {
 	if(!binding) {
         throw system::Stacktrace::add(std::runtime_error("cannot add a new row because result set is already at the end."));
@@ -203,6 +385,22 @@ void ResultSet::save() {
 	valuesChanged = false;
 }
 
+void ResultSet::loadDeferred(std::size_t index) const {
+	if(binding->isDeferred(index) == false) {
+		return;
+	}
+
+	fetching = true;
+	try {
+		binding->loadDeferred(index, fields);
+	}
+	catch(...) {
+		fetching = false;
+		throw;
+	}
+	fetching = false;
+}
+
 void ResultSet::setChanged(std::size_t index) {
 	if(binding && fetching == false && binding->isEditable(index) == false) {
         throw system::Stacktrace::add(std::runtime_error("cannot edit field."));
@@ -25,9 +25,12 @@ SOFTWARE.
 
 #include <esl/database/Column.h>
 #include <esl/database/Field.h>
+#include <esl/database/ResultBatch.h>
+#include <esl/io/Output.h>
 
 #include <cstddef>
 #include <string>
+#include <string_view>
 #include <map>
 #include <vector>
 #include <memory>
@@ -35,6 +38,7 @@ SOFTWARE.
 namespace esl {
 inline namespace v1_6 {
 namespace database {
+inline namespace v1_7 {
 
 class ResultSet {
 	friend class Field;
@@ -47,12 +51,32 @@ public:
 		const std::vector<Column>& getColumns() const;
 
 		virtual bool fetch(std::vector<Field>& fields) = 0;
+
+		/* Adds the row of the last successful fetch and up to maxRows-1 following rows to batch.
+		 * "fields" contains the values of the last fetch. Afterwards the binding is positioned on the last added row.
+		 * Returns false if there are no more rows. The default implementation uses fetch(fields). */
+		virtual bool fetchBatch(ResultBatch& batch, std::size_t maxRows, std::vector<Field>& fields);
+
+		/* Returns true if the value of column "index" has not been stored in "fields" by the last fetch.
+		 * Drivers do this for large values, that are read on demand by loadDeferred(...) or getOutput(...). */
+		bool isDeferred(std::size_t index) const noexcept;
+		void setDeferred(std::size_t index, bool deferred);
+
+		/* Stores the deferred value of column "index" in "fields" and resets its deferred flag.
+		 * The default implementation does nothing. */
+		virtual void loadDeferred(std::size_t index, std::vector<Field>& fields);
+
+		/* Returns a reader for the value of column "index" of the last fetch. The default implementation reads "field".
+		 * Drivers read deferred values in chunks. The output is valid until the next fetch. */
+		virtual io::Output getOutput(std::size_t index, const Field& field);
+
 		virtual bool isEditable(std::size_t columnIndex) = 0;
 		virtual void add(std::vector<Field>& fields) = 0;
 		virtual void save(std::vector<Field>& fields) = 0;
 
 	private:
 		const std::vector<Column> columns;
+		std::vector<bool> deferred;
 	};
 
 	ResultSet() = default;
@@ -71,22 +95,43 @@ public:
 	const Field& operator[](std::size_t index) const;
 	Field& operator[](std::size_t index);
 
+	/* returns the string or blob value of the current row without a copy. SQLite and ODBC refer directly to
+	 * their own buffers, so the view is valid until next() or fetchBatch(...) is called.
+	 * Throws if the value is NULL or if it is not stored as string. */
+	std::string_view getView(const std::string& name) const;
+	std::string_view getView(std::size_t index) const;
+
 	const std::vector<Column>* getColumns() const;
 
+	/* Returns a reader for the value of the current row. Large values are read in chunks by drivers like ODBC
+	 * instead of storing them in the field. The output is valid until next() or fetchBatch(...) is called.
+	 * Returns an empty output if the value is NULL. */
+	io::Output getOutput(const std::string& name);
+	io::Output getOutput(std::size_t index);
+
 	void next();
+
+	/* Moves the current row and up to maxRows-1 following rows into batch and fetches the next row.
+	 * Returns the number of rows in batch, that is 0 if the result set is already at the end. */
+	std::size_t fetchBatch(ResultBatch& batch, std::size_t maxRows);
+
 	void add();
 	void save();
 
 private:
 	void setChanged(std::size_t index);
 
+	/* loads the field if the binding has deferred its value */
+	void loadDeferred(std::size_t index) const;
+
 	std::unique_ptr<Binding> binding;
-	std::vector<Field> fields;
+	mutable std::vector<Field> fields;
 	std::map<std::string, std::size_t> nameToIndex;
 	bool valuesChanged = false;
-	bool fetching = false;
+	mutable bool fetching = false;
 };
 
+} /* inline namespace v1_7 */
 } /* namespace database */
 } /* inline namespace v1_6 */
 } /* namespace esl */
@@ -23,17 +23,68 @@ SOFTWARE.
 #ifndef ESL_DATABASE_TABLE_TABLES_H_
 #define ESL_DATABASE_TABLE_TABLES_H_
 
+#include <esl/database/Column.h>
+#include <esl/database/Field.h>
+#include <esl/database/ResultBatch.h>
 #include <esl/object/Object.h>
 
+#include <cstddef>
+#include <memory>
+#include <string>
+#include <vector>
+
 namespace esl {
 inline namespace v1_6 {
 namespace database {
 namespace table {
+inline namespace v1_7 {
 
+/* Tables provides the tables of a sql::Engine. Rows are read by a scan in blocks of ResultBatch,
+ * so the engine processes them column by column. */
 class Tables : public virtual object::Object {
 public:
+	/* Condition "column <op> value" of a scan. A comparison with a NULL value is never true. */
+	struct Predicate {
+		enum class Operator {
+			equal,
+			notEqual,
+			less,
+			lessEqual,
+			greater,
+			greaterEqual,
+			isNull,
+			isNotNull
+		};
+
+		/* index of the column in the table */
+		std::size_t columnIndex = 0;
+		Operator op = Operator::equal;
+
+		/* not used by isNull and isNotNull */
+		Field value;
+	};
+
+	class Scan {
+	public:
+		virtual ~Scan() = default;
+
+		/* replaces the content of "batch" by the next rows, but not more than maxRows.
+		 * Returns the number of rows, 0 if there are no more rows. */
+		virtual std::size_t fetchBatch(ResultBatch& batch, std::size_t maxRows) = 0;
+	};
+
+	virtual std::vector<std::string> getTableNames() const = 0;
+
+	/* throws if there is no table "tableName" */
+	virtual std::vector<Column> getColumns(const std::string& tableName) const = 0;
+
+	/* returns a scan of all rows of table "tableName" that match every predicate. Column i of a batch
+	 * contains the values of table column columns[i]. Providers evaluate the predicates where the data is,
+	 * e.g. in a WHERE clause of another database. */
+	virtual std::unique_ptr<Scan> scan(const std::string& tableName, const std::vector<std::size_t>& columns, const std::vector<Predicate>& predicates) const = 0;
 };
 
+} /* inline namespace v1_7 */
 } /* namespace table */
 } /* namespace database */
 } /* inline namespace v1_6 */
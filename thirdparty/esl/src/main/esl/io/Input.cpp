@@ -25,6 +25,7 @@ SOFTWARE.
 #include <esl/monitoring/Logger.h>
 #include <esl/monitoring/Streams.h>
 
+#include <algorithm>
 #include <string>
 #include <stdexcept>
 #include <cstdint>
@@ -55,10 +56,17 @@ private:
 
 private:
 #endif
+	/* writes bytes the reader holds in memory already without copying them to the buffer.
+	 * returns false if the reader has no such bytes. */
+	bool consumePeek(Reader& reader);
+
 	static constexpr std::size_t maxBufferSize = 4096;
 	std::size_t currentBufferSize = 0;
 #ifdef ESL_1_6
 	std::size_t flushedBufferSize = 0;
+#else
+	/* end of the bytes read into buffer, the unwritten ones are in front of it */
+	std::size_t currentBufferEnd = 0;
 #endif
 	char buffer[maxBufferSize];
 	Writer& writer;
@@ -72,6 +80,29 @@ ConsumerWriter::ConsumerWriter(Writer& aWriter)
 : writer(aWriter)
 { }
 
+bool ConsumerWriter::consumePeek(Reader& reader) {
+	std::size_t peekSize = 0;
+	const void* peekData = reader.peek(peekSize);
+	if(peekData == nullptr || peekSize == 0) {
+		return false;
+	}
+
+	std::size_t producedSize = writer.write(peekData, peekSize);
+
+	if(producedSize == Writer::npos) {
+		isWriterEOF = true;
+		return true;
+	}
+
+	if(producedSize > peekSize) {
+		logger.warn << "esl::io::Input-ConsumerWriter::consumePeek has " << producedSize << " bytes written but only " << peekSize << " bytes have been allowed to write.\n";
+		producedSize = peekSize;
+	}
+
+	reader.skip(producedSize);
+	return true;
+}
+
 #ifdef ESL_1_6
 bool ConsumerWriter::consume(Reader& reader) {
 	while(flushBuffer()) {
@@ -81,6 +112,10 @@ bool ConsumerWriter::consume(Reader& reader) {
 		return false;
 	}
 
+	if(currentBufferSize == 0 && isReaderEOF == false && consumePeek(reader)) {
+		return isWriterEOF == false;
+	}
+
 	if(currentBufferSize == 0 && isReaderEOF == false) {
 		std::size_t consumedSize = reader.read(buffer, maxBufferSize);
 
@@ -140,6 +175,10 @@ bool ConsumerWriter::consume(Reader& reader) {
 		return false;
 	}
 
+	if(currentBufferSize == 0 && isReaderEOF == false && consumePeek(reader)) {
+		return isWriterEOF == false;
+	}
+
 	if(currentBufferSize == 0 && isReaderEOF == false) {
 		std::size_t consumedSize = reader.read(buffer, maxBufferSize);
 
@@ -153,6 +192,7 @@ bool ConsumerWriter::consume(Reader& reader) {
 			}
 
 			currentBufferSize = consumedSize;
+			currentBufferEnd = consumedSize;
 		}
 	}
 
@@ -171,7 +211,7 @@ std::size_t ConsumerWriter::getCurrentBufferSize() const noexcept {
 
 void ConsumerWriter::flushBuffer() {
 	if(currentBufferSize > 0 && isWriterEOF == false) {
-		std::size_t producedSize = writer.write(&buffer[maxBufferSize-currentBufferSize], currentBufferSize);
+		std::size_t producedSize = writer.write(&buffer[currentBufferEnd-currentBufferSize], currentBufferSize);
 
 		if(producedSize == Writer::npos) {
 			isWriterEOF = true;
@@ -196,6 +236,8 @@ public:
 	ReaderMemory(const void* data, std::size_t size);
 
 	std::size_t read(void* data, std::size_t size) override;
+	const void* peek(std::size_t& size) override;
+	void skip(std::size_t size) override;
 	std::size_t getSizeReadable() const override;
 	bool hasSize() const override;
 	std::size_t getSize() const override;
@@ -228,6 +270,15 @@ std::size_t ReaderMemory::read(void* data, std::size_t size) {
 	return size;
 }
 
+const void* ReaderMemory::peek(std::size_t& size) {
+	size = getSizeReadable();
+	return size == 0 ? nullptr : static_cast<const char*>(getData()) + currentPos;
+}
+
+void ReaderMemory::skip(std::size_t size) {
+	currentPos += std::min(size, getSizeReadable());
+}
+
 std::size_t ReaderMemory::getSizeReadable() const {
 	if(currentPos >= getSize()) {
 		return 0;
@@ -49,6 +49,8 @@ public:
 private:
 	static constexpr std::size_t maxBufferSize = 4096;
 	std::size_t currentBufferSize = 0;
+	/* end of the bytes read into buffer, the unwritten ones are in front of it */
+	std::size_t currentBufferEnd = 0;
 	char buffer[maxBufferSize];
 	Reader& reader;
 	bool isReaderEOF = false;
@@ -67,6 +69,26 @@ std::size_t ProducerReader::produce(Writer& writer) {
 	}
 
 	if(currentBufferSize == 0 && isReaderEOF == false) {
+		/* hand over bytes the reader holds in memory already without copying them to the buffer */
+		std::size_t peekSize = 0;
+		const void* peekData = reader.peek(peekSize);
+		if(peekData && peekSize > 0) {
+			std::size_t producedSize = writer.write(peekData, peekSize);
+
+			if(producedSize == Writer::npos) {
+				isWriterEOF = true;
+				return Writer::npos;
+			}
+
+			if(producedSize > peekSize) {
+				logger.warn << "esl::io::Output-ProducerReader::produce has " << producedSize << " bytes written but only " << peekSize << " bytes have been allowed to write.\n";
+				producedSize = peekSize;
+			}
+
+			reader.skip(producedSize);
+			return producedSize;
+		}
+
 		std::size_t consumedSize = reader.read(buffer, maxBufferSize);
 		if(consumedSize == Reader::npos) {
 			isReaderEOF = true;
@@ -79,11 +101,12 @@ std::size_t ProducerReader::produce(Writer& writer) {
 		}
 
 		currentBufferSize = consumedSize;
+		currentBufferEnd = consumedSize;
 	}
 
 	std::size_t producedSize = 0;
 	if(currentBufferSize > 0) {
-		producedSize = writer.write(&buffer[maxBufferSize-currentBufferSize], currentBufferSize);
+		producedSize = writer.write(&buffer[currentBufferEnd-currentBufferSize], currentBufferSize);
 
 		if(producedSize == Writer::npos) {
 			isWriterEOF = true;
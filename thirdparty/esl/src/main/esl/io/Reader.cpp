@@ -0,0 +1,74 @@
+/*
+MIT License
+Copyright (c) 2019-2025 Sven Lukas
+
+Permission is hereby granted, free of charge, to any person obtaining a copy
+of this software and associated documentation files (the "Software"), to deal
+in the Software without restriction, including without limitation the rights
+to use, copy, modify, merge, publish, distribute, sublicense, and/or sell
+copies of the Software, and to permit persons to whom the Software is
+furnished to do so, subject to the following conditions:
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+SOFTWARE.
+*/
+
+
+#include <esl/io/Reader.h>
+
+#include <algorithm>
+
+namespace esl {
+inline namespace v1_6 {
+namespace io {
+
+std::size_t Reader::readv(const Buffer* buffers, std::size_t count) {
+	std::size_t totalSize = 0;
+
+	for(std::size_t i = 0; i < count; ++i) {
+		/* read(...) with size=0 would signal that reading is done */
+		if(buffers[i].size == 0) {
+			continue;
+		}
+
+		std::size_t size = read(buffers[i].data, buffers[i].size);
+		if(size == npos) {
+			return totalSize == 0 ? npos : totalSize;
+		}
+
+		totalSize += size;
+		if(size < buffers[i].size) {
+			break;
+		}
+	}
+
+	return totalSize;
+}
+
+const void* Reader::peek(std::size_t& size) {
+	size = 0;
+	return nullptr;
+}
+
+void Reader::skip(std::size_t size) {
+	char buffer[4096];
+
+	while(size > 0) {
+		std::size_t sizeRead = read(buffer, std::min(size, sizeof(buffer)));
+		if(sizeRead == npos || sizeRead == 0) {
+			break;
+		}
+		size -= std::min(size, sizeRead);
+	}
+}
+
+} /* namespace io */
+} /* inline namespace v1_6 */
+} /* namespace esl */
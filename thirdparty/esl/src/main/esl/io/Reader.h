@@ -33,6 +33,11 @@ class Reader {
 public:
 	static const std::size_t npos = static_cast<std::size_t>(-1);
 
+	struct Buffer {
+		void* data;
+		std::size_t size;
+	};
+
 	Reader() = default;
 	virtual ~Reader() = default;
 
@@ -42,6 +47,21 @@ public:
 	// -> this can be used for cleanup stuff.
 	virtual std::size_t read(void* data, std::size_t size) = 0;
 
+	/* reads into several buffers in the given order and returns the total number of bytes that have been read.
+	 * npos is returned only if no more data is available and nothing has been read.
+	 * The default implementation calls read(...) for each buffer until a buffer is not filled completely. */
+	virtual std::size_t readv(const Buffer* buffers, std::size_t count);
+
+	/* returns a pointer to bytes that are already available in memory and sets size to their number, without consuming them.
+	 * The bytes stay valid until the next call of any other method of this reader.
+	 * nullptr is returned and size is set to 0 if the reader has no such region. Then use read(...) as usual.
+	 * The default implementation returns always nullptr. */
+	virtual const void* peek(std::size_t& size);
+
+	/* consumes size bytes as they would have been read by read(...), e.g. after writing the region returned by peek(...).
+	 * The default implementation reads and discards the bytes. */
+	virtual void skip(std::size_t size);
+
 	// returns available bytes that can be read with next call of read(...).
 	// npos is returned if available size is unknown.
 	// 0 just means, that there are currently no bytes available and read() would return as well 0.
@@ -33,6 +33,11 @@ class Writer {
 public:
 	static const std::size_t npos = static_cast<std::size_t>(-1);
 
+	struct Buffer {
+		const void* data;
+		std::size_t size;
+	};
+
 	Writer() = default;
 	virtual ~Writer() = default;
 
@@ -42,6 +47,11 @@ public:
 	// npos is returned if writer will not consume anymore.
 	virtual std::size_t write(const void* data, std::size_t size) = 0;
 
+	/* writes several buffers in the given order and returns the total number of consumed bytes.
+	 * npos is returned only if writer will not consume anymore and nothing has been written.
+	 * The default implementation calls write(...) for each buffer until a buffer is not consumed completely. */
+	virtual std::size_t writev(const Buffer* buffers, std::size_t count);
+
 	// returns consumable bytes to write.
 	// npos is returned if available size is unknown.
 	virtual std::size_t getSizeWritable() const = 0;
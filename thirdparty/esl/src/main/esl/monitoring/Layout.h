@@ -26,6 +26,8 @@ SOFTWARE.
 #include <esl/monitoring/Streams.h>
 #include <esl/object/Object.h>
 
+#include <cstddef>
+#include <cstring>
 #include <string>
 
 namespace esl {
@@ -35,6 +37,32 @@ namespace monitoring {
 class Layout : public object::Object {
 public:
 	virtual std::string toString(const Streams::Location& location) const = 0;
+
+	// Writes the layout of location to buffer and returns the length of the complete layout, like snprintf.
+	// If the returned length is larger than size, the output has been truncated to size characters.
+	// Default implementation copies the result of toString(...).
+	virtual std::size_t format(const Streams::Location& location, char* buffer, std::size_t size) const {
+		std::string str = toString(location);
+
+		std::memcpy(buffer, str.data(), str.size() < size ? str.size() : size);
+
+		return str.size();
+	}
+
+	// Writes the layout of location to sink(const char* data, std::size_t size).
+	// Uses a buffer on the stack and falls back to toString(...) if the layout does not fit into it.
+	template<typename Sink>
+	void formatTo(const Streams::Location& location, Sink&& sink) const {
+		char buffer[256];
+		std::size_t length = format(location, buffer, sizeof(buffer));
+		if(length <= sizeof(buffer)) {
+			sink(buffer, length);
+		}
+		else {
+			std::string str = toString(location);
+			sink(str.data(), str.size());
+		}
+	}
 };
 
 } /* namespace monitoring */
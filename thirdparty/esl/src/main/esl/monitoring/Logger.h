@@ -29,11 +29,13 @@ namespace esl {
 inline namespace v1_6 {
 namespace monitoring {
 
-template<Streams::Level level>
+/* RealStream is the type of all enabled streams. Use Streams::Binary instead of Streams::Real to capture
+ * arguments of ESL__LOGGER_* macros in binary form and to format them later, maybe by another thread. */
+template<Streams::Level level, typename RealStream = Streams::Real>
 struct Logger;
 
-template<>
-struct Logger<Streams::Level::trace> : Streams {
+template<typename RealStream>
+struct Logger<Streams::Level::trace, RealStream> : Streams {
 	Logger(const char* aTypeName)
 	: Streams(aTypeName),
 	  trace(aTypeName, Level::trace),
@@ -43,15 +45,15 @@ struct Logger<Streams::Level::trace> : Streams {
 	  error(aTypeName, Level::error)
 	{ }
 
-	Real trace;
-	Real debug;
-	Real info;
-	Real warn;
-	Real error;
+	RealStream trace;
+	RealStream debug;
+	RealStream info;
+	RealStream warn;
+	RealStream error;
 };
 
-template<>
-struct Logger<Streams::Level::debug> : Streams {
+template<typename RealStream>
+struct Logger<Streams::Level::debug, RealStream> : Streams {
 	Logger(const char* aTypeName)
 	: Streams(aTypeName),
 	  debug(aTypeName, Level::debug),
@@ -61,14 +63,14 @@ struct Logger<Streams::Level::debug> : Streams {
 	{ }
 
 	Empty trace;
-	Real debug;
-	Real info;
-	Real warn;
-	Real error;
+	RealStream debug;
+	RealStream info;
+	RealStream warn;
+	RealStream error;
 };
 
-template<>
-struct Logger<Streams::Level::info> : Streams {
+template<typename RealStream>
+struct Logger<Streams::Level::info, RealStream> : Streams {
 	Logger(const char* aTypeName)
 	: Streams(aTypeName),
 	  info(aTypeName, Level::info),
@@ -78,13 +80,13 @@ struct Logger<Streams::Level::info> : Streams {
 
 	Empty trace;
 	Empty debug;
-	Real info;
-	Real warn;
-	Real error;
+	RealStream info;
+	RealStream warn;
+	RealStream error;
 };
 
-template<>
-struct Logger<Streams::Level::warn> : Streams {
+template<typename RealStream>
+struct Logger<Streams::Level::warn, RealStream> : Streams {
 	Logger(const char* aTypeName)
 	: Streams(aTypeName),
 	  warn(aTypeName, Level::warn),
@@ -94,12 +96,12 @@ struct Logger<Streams::Level::warn> : Streams {
 	Empty trace;
 	Empty debug;
 	Empty info;
-	Real warn;
-	Real error;
+	RealStream warn;
+	RealStream error;
 };
 
-template<>
-struct Logger<Streams::Level::error> : Streams {
+template<typename RealStream>
+struct Logger<Streams::Level::error, RealStream> : Streams {
 	Logger(const char* aTypeName)
 	: Streams(aTypeName),
 	  error(aTypeName, Level::error)
@@ -109,11 +111,11 @@ struct Logger<Streams::Level::error> : Streams {
 	Empty debug;
 	Empty info;
 	Empty warn;
-	Real error;
+	RealStream error;
 };
 
-template<>
-struct Logger<Streams::Level::silent> : Streams {
+template<typename RealStream>
+struct Logger<Streams::Level::silent, RealStream> : Streams {
 	Logger(const char* aTypeName)
 	: Streams(aTypeName)
 	{ }
@@ -28,6 +28,7 @@ SOFTWARE.
 #include <esl/monitoring/Layout.h>
 #include <esl/monitoring/Streams.h>
 
+#include <atomic>
 #include <memory>
 #include <ostream>
 #include <string>
@@ -53,7 +54,28 @@ public:
 	virtual void setLevel(Streams::Level logLevel, const std::string& typeName) = 0;
 
 	virtual bool isEnabled(const char* typeName, Streams::Level level) = 0;
+
+	// thread safe
+	// Returns a pointer to the mask of enabled levels for the given type name or nullptr if this is not supported.
+	// Bit "1 << level" is set, if level is enabled or if an appender records all levels (RecordLevel::ALL).
+	// Streams::Binary does not create a record of a level without its bit. The mask is updated in place by setLevel(...)
+	// and the pointer stays valid as long as this object exists.
+	virtual const std::atomic<unsigned int>* getEnabledMask(const char* /*typeName*/) {
+		return nullptr;
+	}
+
 	virtual std::unique_ptr<OStream> createOStream(const Streams::Location& location) = 0;
+
+	// thread safe
+	// Writes a record captured by Streams::Binary. Implementations might copy the record and format it later.
+	// Default implementation formats the record immediately to an OStream created by createOStream(...).
+	virtual void write(const Streams::Location& location, const Streams::Record& record) {
+		std::unique_ptr<OStream> oStream = createOStream(location);
+		if(oStream && oStream->getOStream()) {
+			record.format(*oStream->getOStream());
+		}
+	}
+
 	virtual unsigned int getThreadNo(std::thread::id threadId) = 0;
 
 	virtual void flush(std::ostream* oStream) = 0;
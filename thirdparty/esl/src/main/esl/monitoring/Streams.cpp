@@ -54,7 +54,15 @@ Streams::Writer& Streams::Writer::operator<<(std::ostream& (*pf)(std::ostream&))
 
 Streams::Real::Real(const char* aTypeName, Level aLevel)
 : typeName(aTypeName),
-  level(aLevel)
+  level(aLevel),
+  enabledMask(nullptr)
+{ }
+
+Streams::Real::Real(const Real& real)
+: typeName(real.typeName),
+  level(real.level),
+  logging(real.logging),
+  enabledMask(real.enabledMask.load(std::memory_order_relaxed))
 { }
 
 Streams::Writer Streams::Real::operator()(const void* object) {
@@ -76,19 +84,153 @@ Streams::Writer Streams::Real::operator<<(std::ostream& (*pf)(std::ostream&)) {
 }
 
 Streams::Real::operator bool() const {
-	return logging ? logging->isEnabled(typeName, level) : plugin::Registry::get().findObject<Logging>() ? plugin::Registry::get().findObject<Logging>()->isEnabled(typeName, level) : false;
-	//return isEnabled();
+	const std::atomic<unsigned int>* mask = enabledMask.load(std::memory_order_acquire);
+
+	if(mask == nullptr) {
+		Logging* currentLogging = logging ? logging : plugin::Registry::get().findObject<Logging>();
+		if(!currentLogging) {
+			return false;
+		}
+
+		mask = currentLogging->getEnabledMask(typeName);
+		if(mask == nullptr) {
+			return currentLogging->isEnabled(typeName, level);
+		}
+		enabledMask.store(mask, std::memory_order_release);
+	}
+
+	return (mask->load(std::memory_order_relaxed) >> static_cast<int>(level)) & 1u;
 }
 
 Streams::Writer Streams::Real::getWriter(const void* object, const char* function, const char* file, unsigned int lineNo) {
+	if(!getLogging()) {
+		return Writer(nullptr);
+	}
+
+	return Writer(logging->createOStream(Location(level, object, typeName, function, file, lineNo, std::this_thread::get_id())));
+}
+
+Logging* Streams::Real::getLogging() {
 	if(!logging) {
 		logging = plugin::Registry::get().findObject<Logging>();
 	}
-	if(!logging) {
-		return Writer(nullptr);
+	return logging;
+}
+
+
+void Streams::Record::format(std::ostream& oStream) const {
+	format(oStream, data, size);
+}
+
+void Streams::Record::format(std::ostream& oStream, const void* aData, std::size_t aSize) {
+	const char* ptr = static_cast<const char*>(aData);
+	const char* end = ptr + aSize;
+
+	while(ptr < end) {
+		Tag tag = static_cast<Tag>(*ptr);
+		++ptr;
+
+		switch(tag) {
+		case tagBool: {
+			bool value;
+			std::memcpy(&value, ptr, sizeof(value));
+			ptr += sizeof(value);
+			oStream << value;
+			break;
+		}
+		case tagChar:
+			oStream << *ptr;
+			++ptr;
+			break;
+		case tagSigned: {
+			std::int64_t value;
+			std::memcpy(&value, ptr, sizeof(value));
+			ptr += sizeof(value);
+			oStream << value;
+			break;
+		}
+		case tagUnsigned: {
+			std::uint64_t value;
+			std::memcpy(&value, ptr, sizeof(value));
+			ptr += sizeof(value);
+			oStream << value;
+			break;
+		}
+		case tagDouble: {
+			double value;
+			std::memcpy(&value, ptr, sizeof(value));
+			ptr += sizeof(value);
+			oStream << value;
+			break;
+		}
+		case tagPointer: {
+			const void* value;
+			std::memcpy(&value, ptr, sizeof(value));
+			ptr += sizeof(value);
+			oStream << value;
+			break;
+		}
+		case tagString: {
+			std::uint16_t length;
+			std::memcpy(&length, ptr, sizeof(length));
+			ptr += sizeof(length);
+			oStream.write(ptr, length);
+			ptr += length;
+			break;
+		}
+		default: /* tagTruncated or corrupted data */
+			oStream << "...";
+			return;
+		}
 	}
+}
 
-	return Writer(logging->createOStream(Location(level, object, typeName, function, file, lineNo, std::this_thread::get_id())));
+void Streams::Record::putString(const char* str, std::size_t length) {
+	if(!reserve(1 + sizeof(std::uint16_t))) {
+		return;
+	}
+
+	std::size_t available = capacity - 1 - size - 1 - sizeof(std::uint16_t);
+	std::size_t count = length < available ? length : available;
+	std::memcpy(data + size + 1 + sizeof(std::uint16_t), str, count);
+	commitString(count);
+
+	if(count < length) {
+		truncate();
+	}
+}
+
+void Streams::Record::commitString(std::size_t length) {
+	std::uint16_t length16 = static_cast<std::uint16_t>(length);
+
+	data[size] = static_cast<char>(tagString);
+	std::memcpy(data + size + 1, &length16, sizeof(length16));
+	size += 1 + sizeof(length16) + length;
+}
+
+bool Streams::Record::reserve(std::size_t length) {
+	/* last byte is always left free for tagTruncated */
+	if(truncated || size + length > capacity - 1) {
+		truncate();
+		return false;
+	}
+	return true;
+}
+
+void Streams::Record::truncate() {
+	if(truncated) {
+		return;
+	}
+	truncated = true;
+	data[size] = static_cast<char>(tagTruncated);
+	++size;
+}
+
+
+void Streams::Binary::write(const Location& location, const Record& record) {
+	if(getLogging()) {
+		getLogging()->write(location, record);
+	}
 }
 
 } /* namespace monitoring */
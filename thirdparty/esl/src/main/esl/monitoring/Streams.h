@@ -25,11 +25,20 @@ SOFTWARE.
 
 #include <esl/monitoring/OStream.h>
 
+#include <atomic>
 #include <chrono>
+#include <cstddef>
+#include <cstdint>
 #include <cstring>
 #include <memory>
 #include <ostream>
+#include <streambuf>
+#include <string>
 #include <thread>
+#include <type_traits>
+#if __cplusplus >= 201703L
+#include <string_view>
+#endif
 
 namespace esl {
 inline namespace v1_6 {
@@ -96,6 +105,7 @@ public:
 	class Real {
 	public:
 		Real(const char* typeName, Level level);
+		Real(const Real& real);
 
 	    Writer operator()(const void* object);
 	    Writer operator()(const char* function, const char* file, unsigned int lineNo);
@@ -118,16 +128,191 @@ public:
 			return level;
 		}
 
+		// thread safe
+		// After the first call it costs just a relaxed atomic load, if the logging implementation supports enabled masks.
 		explicit operator bool() const;
 
 	private:
 	    Writer getWriter(const void* object, const char* function, const char* file, unsigned int lineNo);
 
+	protected:
+	    Logging* getLogging();
+
+	private:
 	    const char* typeName;
 		Level level;
 		Logging* logging = nullptr;
+
+		// resolved at first use, because loggers are typically static objects
+		mutable std::atomic<const std::atomic<unsigned int>*> enabledMask;
+	};
+
+	/* Record contains the arguments of a log statement in binary form.
+	 * Integers, floating point numbers, pointers and strings are copied as they are into a fixed buffer.
+	 * Formatting to text is done later by format(...), maybe by a different thread.
+	 * Arguments of any other type are formatted immediately, but into the same buffer.
+	 * Nothing is allocated. If the buffer is full, further arguments are dropped and "..." is written at the end. */
+	class Record {
+	public:
+		static constexpr std::size_t capacity = 200;
+
+		Record() = default;
+		Record(const Record&) = delete;
+		Record& operator=(const Record&) = delete;
+
+		inline void add() {
+		}
+
+		template<typename T, typename... Args>
+		inline void add(const T& t, const Args&... args) {
+			put(t);
+			add(args...);
+		}
+
+		const void* getData() const {
+			return data;
+		}
+
+		std::size_t getSize() const {
+			return size;
+		}
+
+		void format(std::ostream& oStream) const;
+
+		// formats a record given as raw data, that has been copied from getData() and getSize().
+		static void format(std::ostream& oStream, const void* data, std::size_t size);
+
+	private:
+		enum Tag : unsigned char {
+			tagBool,
+			tagChar,
+			tagSigned,
+			tagUnsigned,
+			tagDouble,
+			tagPointer,
+			tagString,
+			tagTruncated
+		};
+
+		/* streambuf to format arguments of other types directly into the buffer of the record */
+		class TextBuffer : public std::streambuf {
+		public:
+			TextBuffer(char* begin, char* end) {
+				setp(begin, end);
+			}
+
+			std::size_t getSize() const {
+				return pptr() - pbase();
+			}
+
+			bool isTruncated() const {
+				return truncated;
+			}
+
+		private:
+			bool truncated = false;
+
+			int_type overflow(int_type) override {
+				truncated = true;
+				return traits_type::eof();
+			}
+		};
+
+		inline void put(bool value) {
+			putValue(tagBool, value);
+		}
+
+		inline void put(char value) {
+			putValue(tagChar, value);
+		}
+
+		inline void put(signed char value) {
+			putValue(tagChar, static_cast<char>(value));
+		}
+
+		inline void put(unsigned char value) {
+			putValue(tagChar, static_cast<char>(value));
+		}
+
+		template<typename T>
+		inline typename std::enable_if<std::is_integral<T>::value && std::is_signed<T>::value, void>::type put(const T& value) {
+			putValue(tagSigned, static_cast<std::int64_t>(value));
+		}
+
+		template<typename T>
+		inline typename std::enable_if<std::is_integral<T>::value && std::is_unsigned<T>::value, void>::type put(const T& value) {
+			putValue(tagUnsigned, static_cast<std::uint64_t>(value));
+		}
+
+		inline void put(float value) {
+			putValue(tagDouble, static_cast<double>(value));
+		}
+
+		inline void put(double value) {
+			putValue(tagDouble, value);
+		}
+
+		inline void put(long double value) {
+			putValue(tagDouble, static_cast<double>(value));
+		}
+
+		template<typename T>
+		inline void put(const T* value) {
+			putValue(tagPointer, static_cast<const void*>(value));
+		}
+
+		inline void put(const char* value) {
+			putString(value ? value : "(null)", value ? std::strlen(value) : 6);
+		}
+
+		inline void put(const std::string& value) {
+			putString(value.data(), value.size());
+		}
+
+#if __cplusplus >= 201703L
+		inline void put(std::string_view value) {
+			putString(value.data(), value.size());
+		}
+#endif
+
+		template<typename T>
+		inline typename std::enable_if<!std::is_arithmetic<T>::value && !std::is_pointer<T>::value && !std::is_array<T>::value, void>::type put(const T& value) {
+			if(!reserve(1 + sizeof(std::uint16_t))) {
+				return;
+			}
+
+			char* text = data + size + 1 + sizeof(std::uint16_t);
+			TextBuffer textBuffer(text, data + capacity - 1);
+			std::ostream oStream(&textBuffer);
+			oStream << value;
+			commitString(textBuffer.getSize());
+			if(textBuffer.isTruncated()) {
+				truncate();
+			}
+		}
+
+		template<typename T>
+		inline void putValue(Tag tag, const T& value) {
+			if(!reserve(1 + sizeof(T))) {
+				return;
+			}
+			data[size] = static_cast<char>(tag);
+			std::memcpy(data + size + 1, &value, sizeof(T));
+			size += 1 + sizeof(T);
+		}
+
+		void putString(const char* str, std::size_t length);
+		void commitString(std::size_t length);
+		bool reserve(std::size_t length);
+		void truncate();
+
+		std::size_t size = 0;
+		bool truncated = false;
+		char data[capacity];
 	};
 
+	class Binary;
+
 	class Empty {
 	public:
 		Empty() = default;
@@ -166,6 +351,9 @@ public:
     	streamReal(object, function, file, lineNo).write(args...);
     }
 
+    template<typename... Args>
+	static inline void write(Binary& streamBinary, const void* object, const char* function, const char* file, unsigned int lineNo, const Args&... args);
+
     template<typename... Args>
 	static inline void write(Empty& streamEmpty, const void* object, const char* function, const char* file, unsigned int lineNo, Args... args) {
     }
@@ -226,6 +414,29 @@ public:
     	}
     };
 
+	/* Binary is a Real stream, but write(...) used by ESL__LOGGER_* macros captures its arguments in a Record on the stack
+	 * instead of formatting them. The record is passed to Logging::write(...) that might format it later by another thread.
+	 * Nothing is captured if the bit of the level is not set in the enabled mask of the logging implementation.
+	 * The mask includes the levels of appenders with RecordLevel::ALL, see Logging::getEnabledMask(...). */
+	class Binary : public Real {
+	public:
+		using Real::Real;
+
+	    template<typename... Args>
+		inline void write(const void* object, const char* function, const char* file, unsigned int lineNo, const Args&... args) {
+	    	if(!*this || !getLogging()) {
+	    		return;
+	    	}
+
+	    	Record record;
+	    	record.add(args...);
+	    	write(Location(getLevel(), object, getTypeName(), function, file, lineNo, std::this_thread::get_id()), record);
+	    }
+
+	private:
+		void write(const Location& location, const Record& record);
+	};
+
 protected:
 	Streams(const char* aTypeName)
 	: typeName(aTypeName)
@@ -235,6 +446,11 @@ private:
 	const char* typeName;
 };
 
+template<typename... Args>
+inline void Streams::write(Binary& streamBinary, const void* object, const char* function, const char* file, unsigned int lineNo, const Args&... args) {
+	streamBinary.write(object, function, file, lineNo, args...);
+}
+
 } /* namespace monitoring */
 } /* inline namespace v1_6 */
 } /* namespace esl */
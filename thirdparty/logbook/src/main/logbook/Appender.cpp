@@ -19,6 +19,8 @@ void addAppender(Appender& appender);
  * Functions is thread safe, quaranteed by loggerMutex */
 void removeAppender(Appender& appender);
 
+void updateRecordingAll();
+
 Appender::Appender() {
 	addAppender(*this);
 }
@@ -41,6 +43,7 @@ Appender::RecordLevel Appender::getRecordLevel() const {
 
 void Appender::setRecordLevel(RecordLevel aRecordLevel) {
 	recordLevel = aRecordLevel;
+	updateRecordingAll();
 }
 
 } /* inline namespace v0_4 */
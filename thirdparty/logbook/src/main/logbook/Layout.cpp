@@ -0,0 +1,24 @@
+/*
+Copyright (c) 2019-2023 Sven Lukas
+
+Logbook is distributed under BSD-style license as described in the file
+LICENSE, which you should have received as part of this distribution.
+*/
+
+#include <logbook/Layout.h>
+
+#include <cstring>
+
+namespace logbook {
+inline namespace v0_4 {
+
+std::size_t Layout::format(const Location& location, char* buffer, std::size_t size) const {
+	std::string str = toString(location);
+
+	std::memcpy(buffer, str.data(), str.size() < size ? str.size() : size);
+
+	return str.size();
+}
+
+} /* inline namespace v0_4 */
+} /* namespace logbook */
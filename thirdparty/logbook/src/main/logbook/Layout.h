@@ -9,6 +9,7 @@ LICENSE, which you should have received as part of this distribution.
 #define LOGBOOK_LAYOUT_H_
 
 #include <logbook/Location.h>
+#include <cstddef>
 #include <string>
 
 namespace logbook {
@@ -20,6 +21,26 @@ public:
 	virtual ~Layout() = default;
 
 	virtual std::string toString(const Location& location) const = 0;
+
+	/* Writes the layout of location to buffer and returns the length of the complete layout, like snprintf.
+	 * If the returned length is larger than size, the output has been truncated to size characters.
+	 * Default implementation copies the result of toString(...). */
+	virtual std::size_t format(const Location& location, char* buffer, std::size_t size) const;
+
+	/* Writes the layout of location to sink(const char* data, std::size_t size).
+	 * Uses a buffer on the stack and falls back to toString(...) if the layout does not fit into it. */
+	template<typename Sink>
+	void formatTo(const Location& location, Sink&& sink) const {
+		char buffer[256];
+		std::size_t length = format(location, buffer, sizeof(buffer));
+		if(length <= sizeof(buffer)) {
+			sink(buffer, length);
+		}
+		else {
+			std::string str = toString(location);
+			sink(str.data(), str.size());
+		}
+	}
 };
 
 } /* inline namespace v0_4 */
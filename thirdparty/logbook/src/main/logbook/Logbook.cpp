@@ -8,12 +8,17 @@ LICENSE, which you should have received as part of this distribution.
 #include <logbook/Logbook.h>
 #include <logbook/Appender.h>
 #include <logbook/Location.h>
+#include <logbook/RingBuffer.h>
 #include <logbook/StreamBuffer.h>
 
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <functional> //template< class T > struct hash<T*>; std::reference_wrapper
 #include <map>
 #include <mutex>
 #include <sstream>
+#include <tuple>
 #include <unordered_set>
 #include <unordered_map>
 #include <utility> // std::pair
@@ -25,59 +30,29 @@ inline namespace v0_4 {
 namespace {  /* anonymous namespace */
 
 struct EnabledLevel {
-	bool trace;
-	bool debug;
-	bool info;
-	bool warn;
-	bool error;
-
-	void setLogLevel(Level logLevel) {
-		switch(logLevel) {
-		case Level::trace:
-			trace = true;
-			debug = true;
-			info = true;
-			warn = true;
-			error = true;
-			break;
-		case Level::debug:
-			trace = false;
-			debug = true;
-			info = true;
-			warn = true;
-			error = true;
-			break;
-		case Level::info:
-			trace = false;
-			debug = false;
-			info = true;
-			warn = true;
-			error = true;
-			break;
-		case Level::warn:
-			trace = false;
-			debug = false;
-			info = false;
-			warn = true;
-			error = true;
-			break;
-		case Level::error:
-			trace = false;
-			debug = false;
-			info = false;
-			warn = false;
-			error = true;
-			break;
-		case Level::silent:
-			trace = false;
-			debug = false;
-			info = false;
-			warn = false;
-			error = false;
-			break;
-		default:
-			break;
+	// bit "1 << level" is set, if level is enabled.
+	std::atomic<unsigned int> levelMask { 0 };
+
+	// bit "1 << level" is set, if level is enabled or if an appender records all levels (RecordLevel::ALL).
+	// It is updated in place, so readers can keep a pointer to it.
+	std::atomic<unsigned int> mask { 0 };
+
+	void setLogLevel(Level logLevel, bool isRecordingAll) {
+		if(logLevel > Level::silent) {
+			return;
+		}
+
+		unsigned int newMask = 0;
+		for(int level = static_cast<int>(logLevel); level < static_cast<int>(Level::silent); ++level) {
+			newMask |= 1u << level;
 		}
+		levelMask.store(newMask, std::memory_order_relaxed);
+		setRecordingAll(isRecordingAll);
+	}
+
+	void setRecordingAll(bool isRecordingAll) {
+		unsigned int allMask = (1u << static_cast<int>(Level::silent)) - 1u;
+		mask.store(isRecordingAll ? allMask : levelMask.load(std::memory_order_relaxed), std::memory_order_relaxed);
 	}
 };
 
@@ -114,6 +89,89 @@ std::string removeEndingCharactersIfMatch(std::string str, F f) {
 	return str;
 }
 
+/* Defined below, after Logbook.
+ * Called by a producer if its ring is full (or becomes full). Returns false, if there is no drain thread running. */
+bool requestDrain();
+
+/* Defined below, after Logbook.
+ * Called by a producer if its ring is full and there is no drain thread running. */
+void drainRings();
+
+/* ThreadRing is the per-thread output of asynchronous logging.
+ * It is a streambuf that formats directly into a fixed buffer and pushes its content as record to the ring,
+ * if the buffer is full or the writer is released. Nothing here is allocated after construction. */
+class ThreadRing : public std::streambuf {
+public:
+	ThreadRing(std::size_t ringCapacity)
+	: ring(ringCapacity),
+	  oStream(this)
+	{
+		setp(buffer, buffer + RingBuffer::recordDataSize);
+	}
+
+	RingBuffer ring;
+	Location location;
+	std::ostream oStream;
+
+	// set by the owning thread if the thread has been finished. Then the drain thread removes this ring if it is empty.
+	std::atomic<bool> isOrphaned { false };
+
+	/* pushes a record with current location to the ring and waits if the ring is full */
+	void push(const char* ptr, std::size_t size, RecordFormatter formatter) {
+		while(!ring.push(location, ptr, size, formatter)) {
+			if(requestDrain()) {
+				std::this_thread::yield();
+			}
+			else {
+				drainRings();
+			}
+		}
+
+		/* wake up drain thread early if ring became half full */
+		if(ring.size() == ring.getCapacity() / 2) {
+			requestDrain();
+		}
+	}
+
+private:
+	char buffer[RingBuffer::recordDataSize];
+
+	int_type overflow(int_type c) override {
+		if(sync() == -1 || c == traits_type::eof()) {
+			return traits_type::eof();
+		}
+
+		*pptr() = traits_type::to_char_type(c);
+		pbump(1);
+		return c;
+	}
+
+	int sync() override {
+		std::size_t size = pptr() - pbase();
+		if(size == 0) {
+			return 0;
+		}
+
+		push(pbase(), size, nullptr);
+		setp(buffer, buffer + RingBuffer::recordDataSize);
+		return 0;
+	}
+};
+
+struct ThreadRingHolder {
+	~ThreadRingHolder() {
+		if(threadRing) {
+			threadRing->oStream.flush();
+			threadRing->isOrphaned = true;
+			requestDrain();
+		}
+	}
+
+	std::shared_ptr<ThreadRing> threadRing;
+};
+
+thread_local ThreadRingHolder threadRingHolder;
+
 } /* anonymous namespace */
 
 /* must be out of anonymous namespace because class (or at least member createWriter(...) ) must be friend of Writer */
@@ -127,6 +185,7 @@ public:
 	{ }
 
 	~Logbook() {
+		stopDrainThread();
 		flush();
 	}
 
@@ -140,6 +199,24 @@ public:
 		isUnblocked = aIsUnblocked;
 	}
 
+	// NOT thread save - call it at the beginning if needed. Default is "false"
+	void setAsynchronous(bool aIsAsynchronous, std::size_t aRingCapacity) {
+		ringCapacity = aRingCapacity;
+
+		if(aIsAsynchronous) {
+			if(!drainThread.joinable()) {
+				isDrainStopped = false;
+				drainThread = std::thread(&Logbook::drainLoop, this);
+				isDrainRunning = true;
+			}
+		}
+		else {
+			stopDrainThread();
+		}
+
+		isAsynchronous = aIsAsynchronous;
+	}
+
 	// thread safe, quaranteed by configMutex
 	/*
 	setLogLevel:
@@ -160,7 +237,7 @@ public:
 
 	    for(auto& typeNameEnabledLevel : typeNameToEnabledLevel) {
 	    	Level level = findMostSpecificLevelEntryByTypeName(typeNameEnabledLevel.first);
-	    	typeNameEnabledLevel.second.setLogLevel(level);
+	    	typeNameEnabledLevel.second.setLogLevel(level, isRecordingAll);
 	    }
 
 	    /* reset currentLocation */
@@ -172,6 +249,7 @@ public:
 	    std::lock_guard<std::recursive_mutex> loggerLock(loggerMutex);
 
 		appenders.insert(&appender);
+		updateRecordingAll();
 	}
 
 	// thread safe, quaranteed by loggerMutex
@@ -179,6 +257,31 @@ public:
 	    std::lock_guard<std::recursive_mutex> loggerLock(loggerMutex);
 
 		appenders.erase(&appender);
+		updateRecordingAll();
+	}
+
+	// thread safe, quaranteed by loggerMutex and configMutex
+	/* updateRecordingAll sets all levels in the enabled masks if an appender records all levels (RecordLevel::ALL),
+	 * so callers checking the mask before they create a record do not drop records that this appender needs. */
+	void updateRecordingAll() {
+	    std::lock_guard<std::recursive_mutex> loggerLock(loggerMutex);
+
+	    bool hasAppenderRecordingAll = false;
+		for(auto& appender : appenders) {
+			if(appender->getRecordLevel() == Appender::RecordLevel::ALL) {
+				hasAppenderRecordingAll = true;
+			}
+		}
+
+	    std::lock_guard<std::mutex> configLock(configMutex);
+	    if(isRecordingAll == hasAppenderRecordingAll) {
+	    	return;
+	    }
+	    isRecordingAll = hasAppenderRecordingAll;
+
+	    for(auto& typeNameEnabledLevel : typeNameToEnabledLevel) {
+	    	typeNameEnabledLevel.second.setRecordingAll(isRecordingAll);
+	    }
 	}
 
 	unsigned int getThreadNo(std::thread::id threadId) {
@@ -197,6 +300,10 @@ public:
 	}
 
 	std::unique_ptr<Writer> createWriter(const Location& location) {
+		if(isAsynchronous) {
+			return createAsynchronousWriter(location);
+		}
+
 		// check if pointer has been set already. So we call this expensive function only once.
 		bool isOwner = true;
 		if(isUnblocked) {
@@ -226,8 +333,25 @@ public:
 		return std::unique_ptr<Writer>(new Writer(nullptr, &oStream));
 	}
 
+	void writeRecord(const Location& location, const void* data, std::size_t size, RecordFormatter formatter) {
+		if(isAsynchronous && size <= RingBuffer::recordDataSize) {
+			prepareThreadRing(location).push(static_cast<const char*>(data), size, formatter);
+			return;
+		}
+
+		std::unique_ptr<Writer> writer = createWriter(location);
+		if(writer && writer->getOStream()) {
+			formatter(*writer->getOStream(), data, size);
+		}
+	}
+
 	/* This function is called by Writer::~Writer() */
 	void releaseWriter(Writer& writer) {
+		/* Writer::~Writer() has flushed already the content to the ring of this thread, there is nothing more to do */
+		if(threadRingHolder.threadRing && writer.location == &threadRingHolder.threadRing->location) {
+			return;
+		}
+
 		bool isOwner = (writer.location == nullptr);
 
 		if(isOwner == false) {
@@ -251,37 +375,57 @@ public:
 		}
 	}
 
-	// thread safe, quaranteed by configMutex
+	// thread safe
 	/* isLoggingEnabled tells if the given log level is enabled for the given type name.
+	 * It costs a relaxed atomic load only, if this thread asked for the same type name before.
+	 */
+	bool isLoggingEnabled(const char* typeName, Level level) {
+		return (getEnabledLevel(typeName).levelMask.load(std::memory_order_relaxed) >> static_cast<int>(level)) & 1u;
+	}
+
+	// thread safe
+	/* getEnabledMask returns the mask of levels that are enabled or recorded by an appender with RecordLevel::ALL. */
+	const std::atomic<unsigned int>& getEnabledMask(const char* typeName) {
+		return getEnabledLevel(typeName).mask;
+	}
+
+	// thread safe, quaranteed by configMutex
+	/* getEnabledLevel returns the masks of enabled levels for the given type name.
 	 * Internally it looks the configMutex to access typeNameToEnabledLevel and
 	 * adds an entry if not exists already for the given type name.
-	 * This function always updates the entry
+	 * Entries are never removed and setLevel updates them in place, so the returned reference stays valid.
+	 * Most callers ask again and again with the same (static) type name, so each thread caches the
+	 * entry by address of the type name to avoid locking the configMutex.
 	 */
-	bool isLoggingEnabled(const char* typeName, Level level) {
-		// corrected typeName and store corrected version to myTypeName
-	    std::string myTypeName = removeStartingCharactersIfMatch(typeName, [](char c) { return c == ':'; });
+	const EnabledLevel& getEnabledLevel(const char* typeName) {
+		if(typeName == nullptr) {
+			typeName = "";
+		}
+
+		// corrected typeName without starting "::"
+		const char* myTypeName = typeName;
+		while(*myTypeName == ':') {
+			++myTypeName;
+		}
+
+		thread_local std::unordered_map<const char*, const std::pair<const std::string, EnabledLevel>*> typeNameToEnabledLevelCache;
+
+		// Address of typeName might be reused for a different type name, so we have to compare the content as well.
+		auto cacheIter = typeNameToEnabledLevelCache.find(typeName);
+		if(cacheIter != std::end(typeNameToEnabledLevelCache) && cacheIter->second->first == myTypeName) {
+			return cacheIter->second->second;
+		}
 
 	    std::lock_guard<std::mutex> configLock(configMutex);
 		// Find or CREATE(!) entry for given typeName (or for corrected version myTypeName)
-	    EnabledLevel& enabledLevel = typeNameToEnabledLevel[myTypeName];
-
-	    // Update this entry !
-	    enabledLevel.setLogLevel(findMostSpecificLevelEntryByTypeName(myTypeName));
-
-	    switch(level) {
-	    case Level::trace:
-	    	return enabledLevel.trace;
-	    case Level::debug:
-	    	return enabledLevel.debug;
-	    case Level::info:
-	    	return enabledLevel.info;
-	    case Level::warn:
-	    	return enabledLevel.warn;
-	    //case Level::error:
-	    default:
-	    	break;
+	    auto iter = typeNameToEnabledLevel.find(myTypeName);
+	    if(iter == std::end(typeNameToEnabledLevel)) {
+	    	iter = typeNameToEnabledLevel.emplace(std::piecewise_construct, std::forward_as_tuple(myTypeName), std::forward_as_tuple()).first;
+		    iter->second.setLogLevel(findMostSpecificLevelEntryByTypeName(myTypeName), isRecordingAll);
 	    }
-		return enabledLevel.error;
+
+	    typeNameToEnabledLevelCache[typeName] = &*iter;
+	    return iter->second;
 	}
 
 	void write(const char* ptr, std::size_t size) {
@@ -296,6 +440,76 @@ public:
 		}
 	}
 
+	/* Called by a producer if its ring is full (or becomes full) and by a thread that finished.
+	 * It does not lock anything. If the notification gets lost the drain thread wakes up by timeout. */
+	bool requestDrain() {
+		if(!isDrainRunning) {
+			return false;
+		}
+
+		isDrainRequested = true;
+		drainCondition.notify_one();
+		return true;
+	}
+
+	/* Writes all records of all rings to the appenders.
+	 * Rings are drained round robin in portions of a few records, so a very busy thread cannot starve the others.
+	 * Returns true if at least one record has been written. */
+	bool drainRings() {
+		std::vector<std::shared_ptr<ThreadRing>> currentRings;
+		{
+			std::lock_guard<std::mutex> ringsLock(ringsMutex);
+			currentRings = rings;
+		}
+
+		constexpr std::size_t recordsPerTurn = 64;
+		bool hasWritten = false;
+		bool hasWrittenThisTurn = true;
+
+		std::lock_guard<std::recursive_mutex> loggerLock(loggerMutex);
+		while(hasWrittenThisTurn) {
+			hasWrittenThisTurn = false;
+
+			for(auto& threadRing : currentRings) {
+				for(std::size_t i = 0; i < recordsPerTurn; ++i) {
+					const RingBuffer::Record* record = threadRing->ring.front();
+					if(record == nullptr) {
+						break;
+					}
+
+					// to create a number, if not done before - important for later translation of same threadId again, e.g. for appender MemBuffer
+					getThreadNo(record->location.threadId);
+
+					currentLocation = record->location;
+					if(record->formatter) {
+						/* oStream writes to the appenders, because this thread is owner of loggerMutex now */
+						record->formatter(oStream, record->data, record->size);
+						oStream.flush();
+					}
+					else {
+						write(record->data, record->size);
+					}
+					threadRing->ring.pop();
+					hasWrittenThisTurn = true;
+				}
+			}
+			hasWritten |= hasWrittenThisTurn;
+		}
+
+		/* remove rings of finished threads */
+		std::lock_guard<std::mutex> ringsLock(ringsMutex);
+		for(auto iter = rings.begin(); iter != rings.end();) {
+			if((*iter)->isOrphaned && (*iter)->ring.empty()) {
+				iter = rings.erase(iter);
+			}
+			else {
+				++iter;
+			}
+		}
+
+		return hasWritten;
+	}
+
 private:
 	StreamBuffer streamBuffer;
 	std::ostream oStream;
@@ -314,13 +528,85 @@ private:
 	std::map<std::string, Level> typeNameToLogLevel;
 
 	// type name without wildcard -> EnabledLevel
-	// must be locked by configMutex
+	// must be locked by configMutex, but EnabledLevel::levelMask and mask can be read without lock
 	std::map<std::string, EnabledLevel> typeNameToEnabledLevel;
 
+	// true if an appender records all levels, must be locked by configMutex
+	bool isRecordingAll = false;
+
 	// must be locked by configMutex
 	std::vector<std::pair<Location*, std::string>> unblockedBuffer;
 
 	bool isUnblocked = true;
+	bool isAsynchronous = false;
+	std::size_t ringCapacity = 256;
+
+	// Lock for rings. Producers lock it only once, when they register their ring.
+	std::mutex ringsMutex;
+	std::vector<std::shared_ptr<ThreadRing>> rings;
+
+	std::thread drainThread;
+	std::mutex drainMutex;
+	std::condition_variable drainCondition;
+	std::atomic<bool> isDrainRequested { false };
+	std::atomic<bool> isDrainRunning { false };
+	bool isDrainStopped = false; // must be locked by drainMutex
+
+	std::unique_ptr<Writer> createAsynchronousWriter(const Location& location) {
+		ThreadRing& threadRing = prepareThreadRing(location);
+		return std::unique_ptr<Writer>(new Writer(&threadRing.location, &threadRing.oStream));
+	}
+
+	/* returns the ring of this thread with given location, creates the ring at first call */
+	ThreadRing& prepareThreadRing(const Location& location) {
+		if(!threadRingHolder.threadRing) {
+			threadRingHolder.threadRing = std::make_shared<ThreadRing>(ringCapacity);
+
+			std::lock_guard<std::mutex> ringsLock(ringsMutex);
+			rings.push_back(threadRingHolder.threadRing);
+		}
+		ThreadRing& threadRing = *threadRingHolder.threadRing;
+
+		/* flush content of an outer writer of this thread, if there is one, because it has a different location */
+		threadRing.oStream.flush();
+
+		threadRing.location = location;
+		threadRing.location.enabled = isLoggingEnabled(location.typeName, location.level);
+
+		return threadRing;
+	}
+
+	void drainLoop() {
+		std::unique_lock<std::mutex> drainLock(drainMutex);
+
+		while(!isDrainStopped) {
+			drainLock.unlock();
+			bool hasWritten = drainRings();
+			drainLock.lock();
+
+			if(!hasWritten && !isDrainStopped && !isDrainRequested) {
+				drainCondition.wait_for(drainLock, std::chrono::milliseconds(10));
+			}
+			isDrainRequested = false;
+		}
+
+		drainLock.unlock();
+		drainRings();
+	}
+
+	void stopDrainThread() {
+		if(!drainThread.joinable()) {
+			return;
+		}
+
+		{
+			std::lock_guard<std::mutex> drainLock(drainMutex);
+			isDrainStopped = true;
+		}
+		drainCondition.notify_one();
+		drainThread.join();
+		isDrainRunning = false;
+	}
 
 	/*
 	1. find typeName in "typeNameToLogLevel"
@@ -430,6 +716,19 @@ Logbook* getLogbook() {
 	return logbookPtr;
 }
 
+bool requestDrain() {
+	if(getLogbook()) {
+		return getLogbook()->requestDrain();
+	}
+	return false;
+}
+
+void drainRings() {
+	if(getLogbook()) {
+		getLogbook()->drainRings();
+	}
+}
+
 }  /* anonymous namespace */
 
 void setUnblocked(bool isUnblocked) {
@@ -438,6 +737,12 @@ void setUnblocked(bool isUnblocked) {
 	}
 }
 
+void setAsynchronous(bool isAsynchronous, std::size_t ringCapacity) {
+	if(getLogbook()) {
+		getLogbook()->setAsynchronous(isAsynchronous, ringCapacity);
+	}
+}
+
 void setLevel(Level logLevel, const std::string& typeName) {
 	if(getLogbook()) {
 		getLogbook()->setLevel(logLevel, typeName);
@@ -460,6 +765,14 @@ void removeAppender(Appender& appender) {
 	}
 }
 
+/* Only used in Appender.cpp, if the record level of an appender has been changed.
+ * Function is thread safe, quaranteed by loggerMutex and configMutex. */
+void updateRecordingAll() {
+	if(getLogbook()) {
+		getLogbook()->updateRecordingAll();
+	}
+}
+
 unsigned int getThreadNo(std::thread::id threadId) {
 	if(getLogbook()) {
 		return getLogbook()->getThreadNo(threadId);
@@ -487,6 +800,19 @@ bool isLoggingEnabled(const char* typeName, Level level) {
 	return false;
 }
 
+const std::atomic<unsigned int>* getEnabledMask(const char* typeName) {
+	if(getLogbook()) {
+		return &getLogbook()->getEnabledMask(typeName);
+	}
+	return nullptr;
+}
+
+void writeRecord(const Location& location, const void* data, std::size_t size, RecordFormatter formatter) {
+	if(getLogbook()) {
+		getLogbook()->writeRecord(location, data, size, formatter);
+	}
+}
+
 void write(const char* ptr, std::size_t size) {
 	if(getLogbook()) {
 		getLogbook()->write(ptr, size);
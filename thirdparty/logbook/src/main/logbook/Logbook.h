@@ -10,6 +10,8 @@ LICENSE, which you should have received as part of this distribution.
 
 #include <logbook/Level.h>
 #include <logbook/Writer.h>
+#include <atomic>
+#include <cstddef>
 #include <ostream>
 #include <string>
 #include <memory>
@@ -26,6 +28,15 @@ inline namespace v0_4 {
 // - If current thread is done using the logger, it flushes queued buffers.
 void setUnblocked(bool isUnblocked);
 
+// NOT thread save - call it at the beginning if needed. Default is "false"
+// asynchronous behavior makes each thread write its log records into its own preallocated ring buffer of
+// "ringCapacity" records without taking any lock. A separate drain thread merges the rings into the appenders.
+// - Order of records is kept per thread, but not between different threads.
+// - If the ring of a thread is full, this thread waits until the drain thread made space again.
+// - Disabling asynchronous behavior stops the drain thread after all pending records have been written.
+// If asynchronous behavior is enabled, setting of "unblocked" has no effect.
+void setAsynchronous(bool isAsynchronous, std::size_t ringCapacity = 256);
+
 // thread safe, quaranteed by configMutex
 void setLevel(Level logLevel, const std::string& typeName);
 
@@ -33,12 +44,29 @@ unsigned int getThreadNo(std::thread::id threadId);
 
 bool isLoggingEnabled(const char* typeName, Level level);
 
+// Returns the mask of enabled levels for given type name. Bit "1 << level" is set, if level is enabled
+// or if an appender records all levels (RecordLevel::ALL), so a record of this level is written anyway.
+// setLevel(...) updates the mask in place and the pointer stays valid as long as logbook exists,
+// so a caller can keep it and check a level by a single relaxed atomic load.
+// Returns nullptr if logbook has been destroyed already.
+const std::atomic<unsigned int>* getEnabledMask(const char* typeName);
+
+// Formats a record that has been captured in binary form, e.g. by esl::monitoring::Streams::Binary.
+using RecordFormatter = void (*)(std::ostream& oStream, const void* data, std::size_t size);
+
+class Location;
+
+// thread safe
+// Writes a record that is formatted by "formatter" as late as possible.
+// In asynchronous mode a record of up to RingBuffer::recordDataSize bytes is copied into the ring of the current
+// thread and it is formatted later by the drain thread. Otherwise the record is formatted immediately.
+void writeRecord(const Location& location, const void* data, std::size_t size, RecordFormatter formatter);
+
 
 /* ********************************************* *
  * following functions are for internal use only *
  * ********************************************* */
 
-class Location;
 std::unique_ptr<Writer> createWriter(const Location& location);
 
 } /* inline namespace v0_4 */
@@ -0,0 +1,80 @@
+/*
+Copyright (c) 2019-2023 Sven Lukas
+
+Logbook is distributed under BSD-style license as described in the file
+LICENSE, which you should have received as part of this distribution.
+*/
+
+#include <logbook/RingBuffer.h>
+
+#include <algorithm>
+#include <cstring>
+
+namespace logbook {
+inline namespace v0_4 {
+
+namespace {
+std::size_t roundUpToPowerOfTwo(std::size_t value) {
+	std::size_t rv = 2;
+	while(rv < value) {
+		rv <<= 1;
+	}
+	return rv;
+}
+} /* anonymous namespace */
+
+constexpr std::size_t RingBuffer::recordDataSize;
+
+RingBuffer::RingBuffer(std::size_t capacity)
+: records(roundUpToPowerOfTwo(capacity)),
+  mask(records.size() - 1),
+  head(0),
+  tail(0)
+{ }
+
+bool RingBuffer::push(const Location& location, const char* ptr, std::size_t size, RecordFormatter formatter) {
+	const std::size_t currentTail = tail.load(std::memory_order_relaxed);
+
+	if(currentTail - head.load(std::memory_order_acquire) > mask) {
+		return false;
+	}
+
+	Record& record = records[currentTail & mask];
+	record.location = location;
+	record.size = std::min(size, recordDataSize);
+	std::memcpy(record.data, ptr, record.size);
+	record.formatter = formatter;
+
+	tail.store(currentTail + 1, std::memory_order_release);
+	return true;
+}
+
+const RingBuffer::Record* RingBuffer::front() const {
+	const std::size_t currentHead = head.load(std::memory_order_relaxed);
+
+	if(currentHead == tail.load(std::memory_order_acquire)) {
+		return nullptr;
+	}
+
+	return &records[currentHead & mask];
+}
+
+void RingBuffer::pop() {
+	head.store(head.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+}
+
+bool RingBuffer::empty() const {
+	return head.load(std::memory_order_acquire) == tail.load(std::memory_order_acquire);
+}
+
+std::size_t RingBuffer::size() const {
+	const std::size_t currentHead = head.load(std::memory_order_acquire);
+	return tail.load(std::memory_order_acquire) - currentHead;
+}
+
+std::size_t RingBuffer::getCapacity() const {
+	return records.size();
+}
+
+} /* inline namespace v0_4 */
+} /* namespace logbook */
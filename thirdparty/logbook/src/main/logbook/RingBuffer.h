@@ -0,0 +1,75 @@
+/*
+Copyright (c) 2019-2023 Sven Lukas
+
+Logbook is distributed under BSD-style license as described in the file
+LICENSE, which you should have received as part of this distribution.
+*/
+
+#ifndef LOGBOOK_RINGBUFFER_H_
+#define LOGBOOK_RINGBUFFER_H_
+
+#include <logbook/Location.h>
+#include <logbook/Logbook.h>
+
+#include <atomic>
+#include <cstddef>
+#include <vector>
+
+namespace logbook {
+inline namespace v0_4 {
+
+/* Single producer / single consumer ring of log records.
+ * Exactly one thread may call push(...) and exactly one (other) thread may call front() and pop().
+ * All records are allocated once at construction time, push(...) and pop() never allocate memory.
+ */
+class RingBuffer {
+public:
+	static constexpr std::size_t recordDataSize = 224;
+
+	struct Record {
+		Location location;
+		std::size_t size = 0;
+		char data[recordDataSize];
+
+		// nullptr if data contains formatted text, otherwise data is a binary record formatted by this function
+		RecordFormatter formatter = nullptr;
+	};
+
+	// capacity is rounded up to the next power of two
+	RingBuffer(std::size_t capacity);
+
+	RingBuffer(const RingBuffer&) = delete;
+	RingBuffer& operator=(const RingBuffer&) = delete;
+
+	/* producer side.
+	 * Returns false if ring is full. Then nothing has been written. */
+	bool push(const Location& location, const char* ptr, std::size_t size, RecordFormatter formatter = nullptr);
+
+	/* consumer side.
+	 * Returns nullptr if ring is empty. */
+	const Record* front() const;
+	void pop();
+
+	bool empty() const;
+
+	// number of records in the ring. Exact if called by producer or consumer, approximate otherwise.
+	std::size_t size() const;
+	std::size_t getCapacity() const;
+
+private:
+	std::vector<Record> records;
+	const std::size_t mask;
+
+	/* head is written by consumer and tail is written by producer only.
+	 * Both are kept on separate cache lines to avoid false sharing. */
+	char paddingBegin[64];
+	std::atomic<std::size_t> head;
+	char paddingHead[64];
+	std::atomic<std::size_t> tail;
+	char paddingTail[64];
+};
+
+} /* inline namespace v0_4 */
+} /* namespace logbook */
+
+#endif /* LOGBOOK_RINGBUFFER_H_ */
@@ -14,9 +14,30 @@ inline namespace v0_4 {
 
 Stream::Stream(const char* typeName, Level ll)
 : typeName(typeName),
-  level(ll)
+  level(ll),
+  enabledMask(nullptr)
 { }
 
+Stream::Stream(const Stream& stream)
+: typeName(stream.typeName),
+  level(stream.level),
+  enabledMask(stream.enabledMask.load(std::memory_order_relaxed))
+{ }
+
+Stream::operator bool() const {
+	const std::atomic<unsigned int>* mask = enabledMask.load(std::memory_order_acquire);
+
+	if(mask == nullptr) {
+		mask = getEnabledMask(typeName);
+		if(mask == nullptr) {
+			return false;
+		}
+		enabledMask.store(mask, std::memory_order_release);
+	}
+
+	return (mask->load(std::memory_order_relaxed) >> static_cast<int>(level)) & 1u;
+}
+
 Writer Stream::operator()(void* object) {
 	std::unique_ptr<Writer> writerPtr(createWriter(Location(level, object, typeName, nullptr, nullptr, 0, std::this_thread::get_id())));
 	if(writerPtr) {
@@ -12,12 +12,15 @@ LICENSE, which you should have received as part of this distribution.
 #include <logbook/Writer.h>
 #include <logbook/Logbook.h>
 
+#include <atomic>
+
 namespace logbook {
 inline namespace v0_4 {
 
 class Stream {
 public:
 	Stream(const char* typeName, Level ll);
+	Stream(const Stream& stream);
 	~Stream() = default;
 
     Writer operator()(void* object);
@@ -37,9 +40,17 @@ public:
 
     Writer operator<<(std::ostream& (*pf)(std::ostream&));
 
+	// thread safe
+	// tells if level of this stream is enabled for its type name or if an appender records all levels.
+	// After the first call it costs just a relaxed atomic load, because the enabled mask is cached.
+	explicit operator bool() const;
+
 private:
     const char* typeName;
 	Level level;
+
+	// resolved at first use, because streams are typically static objects
+	mutable std::atomic<const std::atomic<unsigned int>*> enabledMask;
 };
 
 } /* inline namespace v0_4 */
@@ -6,6 +6,8 @@ LICENSE, which you should have received as part of this distribution.
 */
 
 #include <logbook/appender/MemBuffer.h>
+#include <algorithm>
+#include <cstring>
 
 namespace logbook {
 inline namespace v0_4 {
@@ -80,8 +82,10 @@ void MemBuffer::write(const char* ptr, std::size_t size) {
         columnsProducer += size;
     }
     else {
-        std::strncat(&entries[rowProducer].lineStaticSize[columnsProducer], ptr, std::min(size, maxColumns - columnsProducer));
-        columnsProducer += std::min(size, maxColumns - columnsProducer);
+        std::size_t count = std::min(size, maxColumns - columnsProducer);
+        std::memcpy(&entries[rowProducer].lineStaticSize[columnsProducer], ptr, count);
+        columnsProducer += count;
+        entries[rowProducer].lineStaticSize[columnsProducer] = 0;
     }
 }
 
@@ -79,18 +79,20 @@ void OStream::write(const Location& aLocation, const char* ptr, std::size_t size
 	for(auto iter = ptr; iter != &ptr[size]; ++iter) {
 		if(isFirstCharacterInLine) {
 			if(getLayout()) {
-				oStream << getLayout()->toString(aLocation);
+				getLayout()->formatTo(aLocation, [&oStream](const char* data, std::size_t length) {
+					oStream.write(data, length);
+				});
 			}
 			isFirstCharacterInLine = false;
 		}
 
 		if(*iter == '\n') {
-			oStream << std::string(begin, iter) << "\n";
+			oStream.write(begin, iter - begin) << "\n";
 			isFirstCharacterInLine = true;
 			begin = iter+1;
 		}
 	}
-	oStream << std::string(begin, &ptr[size]);
+	oStream.write(begin, &ptr[size] - begin);
 }
 
 std::ostream& OStream::getOStream(Level level) {
@@ -8,39 +8,78 @@ LICENSE, which you should have received as part of this distribution.
 #include <logbook/layout/Default.h>
 #include <logbook/Level.h>
 #include <logbook/Logbook.h>
-#include <time.h>
+#include <cstdint>
+#include <cstring>
 #include <ctime>
+#include <time.h>
 
 namespace logbook {
 inline namespace v0_4 {
 namespace layout {
 
 namespace {
-std::string formatStrToSize(std::string str, bool spacesAtLeftSide = false, const std::size_t strSize = 50) {
-	if(str.size() > strSize) {
-		str = "..." + str.substr(str.size()+3-strSize);
+constexpr std::size_t timestampSize = 22;
+constexpr std::size_t levelSize = 8;
+constexpr std::size_t typeNameSize = 20;
+constexpr std::size_t threadNoSize = 3;
+constexpr std::size_t addressSize = 18;
+constexpr std::size_t functionSize = 20;
+constexpr std::size_t fileSize = 20;
+constexpr std::size_t lineNoSize = 6;
+
+/* formatted timestamp of the last second, cached per thread because localtime_r is expensive */
+struct TimestampCache {
+	std::time_t timestamp = -1;
+	char str[timestampSize + 1];
+};
+thread_local TimestampCache timestampCache;
+
+/* Writes str to a field of fieldSize characters that is filled with spaces already.
+ * If str is too long, it is shortened at the left side and "..." is written in front of it. */
+void writeStrToSize(char* dst, const char* str, std::size_t strSize, bool spacesAtLeftSide, const std::size_t fieldSize) {
+	if(strSize > fieldSize) {
+		std::memcpy(dst, "...", 3);
+		std::memcpy(dst + 3, str + strSize + 3 - fieldSize, fieldSize - 3);
 	}
-
-	if(spacesAtLeftSide) {
-		while(str.size() < strSize) {
-			str = " " + str;
-		}
+	else if(spacesAtLeftSide) {
+		std::memcpy(dst + fieldSize - strSize, str, strSize);
 	}
 	else {
-		while(str.size() < strSize) {
-			str += " ";
-		}
+		std::memcpy(dst, str, strSize);
 	}
+}
 
-	return str;
+void writeStrToSize(char* dst, const char* str, bool spacesAtLeftSide, const std::size_t fieldSize) {
+	if(str) {
+		writeStrToSize(dst, str, std::strlen(str), spacesAtLeftSide, fieldSize);
+	}
 }
 
-std::string makeString(const char* typeName) {
-	return typeName == nullptr ? "" : typeName;
+/* writes value right aligned to the end of buffer "end" and returns the first character */
+char* formatNumber(char* end, std::size_t value, unsigned int base = 10) {
+	do {
+		*--end = "0123456789abcdef"[value % base];
+		value /= base;
+	} while(value > 0);
+	return end;
 }
 
-std::string formatTimestamp(const std::time_t& timestamp) {
-    char timeStr[23];
+void writeNumberToSize(char* dst, std::size_t value, const std::size_t fieldSize) {
+	char buffer[20];
+	char* begin = formatNumber(buffer + sizeof(buffer), value);
+	writeStrToSize(dst, begin, buffer + sizeof(buffer) - begin, true, fieldSize);
+}
+
+void put2(char* dst, int value) {
+	dst[0] = static_cast<char>('0' + value / 10);
+	dst[1] = static_cast<char>('0' + value % 10);
+}
+
+const char* formatTimestamp(const std::time_t& timestamp) {
+	if(timestampCache.timestamp == timestamp) {
+		return timestampCache.str;
+	}
+
     struct tm timeBuf;
     struct tm* timePtr;
 
@@ -51,17 +90,24 @@ std::string formatTimestamp(const std::time_t& timestamp) {
     timePtr = localtime_r(&timestamp, &timeBuf);
 #endif
 
-    sprintf(timeStr, "$ %04d-%02d-%02d %02d:%02d:%02d ",
-            timePtr->tm_year + 1900,
-            timePtr->tm_mon  + 1,
-            timePtr->tm_mday,
-            timePtr->tm_hour,
-            timePtr->tm_min,
-            timePtr->tm_sec);
-    return timeStr;
+    /* "$ YYYY-MM-DD HH:MM:SS " */
+    char* str = timestampCache.str;
+    int year = timePtr->tm_year + 1900;
+    std::memcpy(str, "$ 0000-00-00 00:00:00 ", timestampSize);
+    put2(str + 2, (year / 100) % 100);
+    put2(str + 4, year % 100);
+    put2(str + 7, timePtr->tm_mon + 1);
+    put2(str + 10, timePtr->tm_mday);
+    put2(str + 13, timePtr->tm_hour);
+    put2(str + 16, timePtr->tm_min);
+    put2(str + 19, timePtr->tm_sec);
+    str[timestampSize] = 0;
+
+    timestampCache.timestamp = timestamp;
+    return str;
 }
 
-std::string formatLevel(Level level) {
+const char* formatLevel(Level level) {
     switch(level) {
     case Level::trace:
     	return "[TRACE] ";
@@ -79,59 +125,112 @@ std::string formatLevel(Level level) {
 	return "[ n/a ] ";
 }
 
-std::string formatTypeName(const char* typeName) {
-	return formatStrToSize(makeString(typeName), false, 20);
+/* same output as "%p" of glibc */
+void writeObject(char* dst, const void* object) {
+	if(object == nullptr) {
+		writeStrToSize(dst, "(nil)", 5, false, addressSize);
+		return;
+	}
+
+	char buffer[2 + 2 * sizeof(void*)];
+	char* begin = formatNumber(buffer + sizeof(buffer), reinterpret_cast<std::uintptr_t>(object), 16);
+	*--begin = 'x';
+	*--begin = '0';
+	writeStrToSize(dst, begin, buffer + sizeof(buffer) - begin, false, addressSize);
 }
 
-std::string formatThreadNo(unsigned int threadNo) {
-	return formatStrToSize(std::to_string(threadNo),true, 3);
+} /* anonymous namespace */
+
+Default::Default() {
+	compile();
 }
 
-std::string formatObject(const void* object) {
-	char buffer[20];
-	std::snprintf(buffer, 20, "%p", object);
-	return formatStrToSize(buffer, false, 18);
+std::string Default::toString(const Location& location) const {
+	char buffer[maxSize];
+	return std::string(buffer, format(location, buffer, maxSize));
 }
 
-std::string formatLineNo(unsigned int lineNo) {
-	return formatStrToSize(std::to_string(lineNo),true, 6);
+std::size_t Default::format(const Location& location, char* buffer, std::size_t size) const {
+	if(size < pattern.size()) {
+		char tmpBuffer[maxSize];
+		format(location, tmpBuffer, maxSize);
+		std::memcpy(buffer, tmpBuffer, size);
+		return pattern.size();
+	}
+
+	std::memcpy(buffer, pattern.data(), pattern.size());
+
+	for(const auto& field : fields) {
+		char* dst = buffer + field.offset;
+
+		switch(field.type) {
+		case FieldType::timestamp:
+			std::memcpy(dst, formatTimestamp(location.timestamp), timestampSize);
+			break;
+		case FieldType::level:
+			std::memcpy(dst, formatLevel(location.level), levelSize);
+			break;
+		case FieldType::typeName:
+			writeStrToSize(dst, location.typeName, false, typeNameSize);
+			break;
+		case FieldType::threadNo:
+			writeNumberToSize(dst, getThreadNo(location.threadId), threadNoSize);
+			break;
+		case FieldType::address:
+			writeObject(dst, location.object);
+			break;
+		case FieldType::function:
+			writeStrToSize(dst, location.function, false, functionSize);
+			break;
+		case FieldType::file:
+			writeStrToSize(dst, location.file, false, fileSize);
+			break;
+		case FieldType::lineNo:
+			writeNumberToSize(dst, static_cast<unsigned int>(location.line), lineNoSize);
+			break;
+		}
+	}
+
+	return pattern.size();
 }
 
-} /* anonymous namespace */
+void Default::compile() {
+	pattern.clear();
+	fields.clear();
 
-std::string Default::toString(const Location& location) const {
-	std::string rv;
+	auto addField = [this](FieldType type, const char* prefix, std::size_t size) {
+		pattern += prefix;
+		fields.push_back(Field{type, pattern.size()});
+		pattern.append(size, ' ');
+	};
 
 	if(showTimestamp) {
-		rv += formatTimestamp(location.timestamp);
+		addField(FieldType::timestamp, "", timestampSize);
 	}
-
 	if(showLevel) {
-		rv += formatLevel(location.level);
+		addField(FieldType::level, "", levelSize);
 	}
 
-    rv += "(";
+	pattern += "(";
 	if(showTypeName) {
-	    rv += formatTypeName(location.typeName);
+		addField(FieldType::typeName, "", typeNameSize);
 	}
 	if(showThreadNo) {
-		rv += "-" + formatThreadNo(getThreadNo(location.threadId));
+		addField(FieldType::threadNo, "-", threadNoSize);
 	}
 	if(showAddress) {
-		rv += " @ " + formatObject(location.object);
+		addField(FieldType::address, " @ ", addressSize);
 	}
 	if(showFunction) {
-		rv += "|" + formatStrToSize(makeString(location.function), false, 20);
+		addField(FieldType::function, "|", functionSize);
 	}
 	if(showFile) {
-		rv += "|" + formatStrToSize(makeString(location.file), false, 20);
+		addField(FieldType::file, "|", fileSize);
 	}
 	if(showLineNo) {
-		rv += "|" + formatLineNo(location.line);
+		addField(FieldType::lineNo, "|", lineNoSize);
 	}
-	rv += "): ";
-
-	return rv;
+	pattern += "): ";
 }
 
 bool Default::getShowTimestamp() const {
@@ -140,6 +239,7 @@ bool Default::getShowTimestamp() const {
 
 void Default::setShowTimestamp(bool aShowTimestamp) {
 	showTimestamp = aShowTimestamp;
+	compile();
 }
 
 bool Default::getShowLevel() const {
@@ -148,6 +248,7 @@ bool Default::getShowLevel() const {
 
 void Default::setShowLevel(bool aShowLevel) {
 	showLevel = aShowLevel;
+	compile();
 }
 
 bool Default::getShowTypeName() const {
@@ -156,6 +257,7 @@ bool Default::getShowTypeName() const {
 
 void Default::setShowTypeName(bool aShowTypeName) {
 	showTypeName = aShowTypeName;
+	compile();
 }
 
 bool Default::getShowAddress() const {
@@ -164,6 +266,7 @@ bool Default::getShowAddress() const {
 
 void Default::setShowAddress(bool aShowAddress) {
 	showAddress = aShowAddress;
+	compile();
 }
 
 bool Default::getShowFile() const {
@@ -172,6 +275,7 @@ bool Default::getShowFile() const {
 
 void Default::setShowFile(bool aShowFile) {
 	showFile = aShowFile;
+	compile();
 }
 
 bool Default::getShowFunction() const {
@@ -180,6 +284,7 @@ bool Default::getShowFunction() const {
 
 void Default::setShowFunction(bool aShowFunction) {
 	showFunction = aShowFunction;
+	compile();
 }
 
 bool Default::getShowLineNo() const {
@@ -188,6 +293,7 @@ bool Default::getShowLineNo() const {
 
 void Default::setShowLineNo(bool aShowLineNo) {
 	showLineNo = aShowLineNo;
+	compile();
 }
 
 bool Default::getShowThreadNo() const {
@@ -196,6 +302,7 @@ bool Default::getShowThreadNo() const {
 
 void Default::setShowThreadNo(bool aShowThreadNo) {
 	showThreadNo = aShowThreadNo;
+	compile();
 }
 
 } /* namespace layout */
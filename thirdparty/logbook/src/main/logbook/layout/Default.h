@@ -10,15 +10,26 @@ LICENSE, which you should have received as part of this distribution.
 
 #include <logbook/Layout.h>
 #include <logbook/Location.h>
+
+#include <cstddef>
 #include <string>
+#include <vector>
 
 namespace logbook {
 inline namespace v0_4 {
 namespace layout {
 
+/* Default compiles the selected fields into a fixed width pattern once, when a field is selected or deselected.
+ * format(...) copies the pattern into the caller's buffer and fills in the fields. It does not allocate anything. */
 class Default : public Layout {
 public:
+	// maximum length of the output if all fields are selected
+	static constexpr std::size_t maxSize = 128;
+
+	Default();
+
 	std::string toString(const Location& location) const override;
+	std::size_t format(const Location& location, char* buffer, std::size_t size) const override;
 
 	bool getShowTimestamp() const;
 	void setShowTimestamp(bool showTimestamp = true);
@@ -45,6 +56,27 @@ public:
 	void setShowThreadNo(bool showThreadNo = true);
 
 private:
+	enum class FieldType {
+		timestamp,
+		level,
+		typeName,
+		threadNo,
+		address,
+		function,
+		file,
+		lineNo
+	};
+
+	struct Field {
+		FieldType type;
+		std::size_t offset;
+	};
+
+	void compile();
+
+	std::string pattern;
+	std::vector<Field> fields;
+
 	bool showTimestamp = true;
 	bool showLevel = true;
 	bool showTypeName = true;
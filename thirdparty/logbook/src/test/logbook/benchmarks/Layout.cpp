@@ -0,0 +1,155 @@
+#include <logbook/benchmarks/Layout.h>
+#include <logbook/layout/Default.h>
+#include <logbook/Layout.h>
+#include <logbook/Level.h>
+#include <logbook/Location.h>
+#include <logbook/Logbook.h>
+
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <ctime>
+#include <functional>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <time.h>
+
+namespace logbook {
+inline namespace v0_4 {
+namespace benchmarks {
+
+namespace {
+
+constexpr std::size_t numberOfRecords = 2000000;
+
+/* Layout as it has been implemented before fields have been compiled into a pattern. It is the reference to compare with. */
+class StringLayout : public Layout {
+public:
+	std::string toString(const Location& location) const override {
+		std::string rv;
+
+		rv += formatTimestamp(location.timestamp);
+		rv += formatLevel(location.level);
+	    rv += "(";
+	    rv += formatStrToSize(makeString(location.typeName), false, 20);
+		rv += "-" + formatStrToSize(std::to_string(getThreadNo(location.threadId)), true, 3);
+
+		char buffer[20];
+		std::snprintf(buffer, 20, "%p", location.object);
+		rv += " @ " + formatStrToSize(buffer, false, 18);
+		rv += "|" + formatStrToSize(makeString(location.function), false, 20);
+		rv += "|" + formatStrToSize(makeString(location.file), false, 20);
+		rv += "|" + formatStrToSize(std::to_string(location.line), true, 6);
+		rv += "): ";
+
+		return rv;
+	}
+
+private:
+	static std::string formatStrToSize(std::string str, bool spacesAtLeftSide, const std::size_t strSize) {
+		if(str.size() > strSize) {
+			str = "..." + str.substr(str.size()+3-strSize);
+		}
+
+		if(spacesAtLeftSide) {
+			while(str.size() < strSize) {
+				str = " " + str;
+			}
+		}
+		else {
+			while(str.size() < strSize) {
+				str += " ";
+			}
+		}
+
+		return str;
+	}
+
+	static std::string makeString(const char* str) {
+		return str == nullptr ? "" : str;
+	}
+
+	static std::string formatTimestamp(const std::time_t& timestamp) {
+	    char timeStr[64];
+	    struct tm timeBuf;
+	    struct tm* timePtr = localtime_r(&timestamp, &timeBuf);
+
+	    std::snprintf(timeStr, sizeof(timeStr), "$ %04d-%02d-%02d %02d:%02d:%02d ",
+	            timePtr->tm_year + 1900,
+	            timePtr->tm_mon  + 1,
+	            timePtr->tm_mday,
+	            timePtr->tm_hour,
+	            timePtr->tm_min,
+	            timePtr->tm_sec);
+	    return timeStr;
+	}
+
+	static std::string formatLevel(Level level) {
+	    switch(level) {
+	    case Level::trace:
+	    	return "[TRACE] ";
+	    case Level::debug:
+	    	return "[DEBUG] ";
+	    case Level::info:
+	    	return "[INFO ] ";
+	    case Level::warn:
+	    	return"[WARN ] ";
+	    case Level::error:
+	    	return "[ERROR] ";
+	    default:
+	        break;
+	    }
+		return "[ n/a ] ";
+	}
+};
+
+void run(const std::string& mode, const std::function<std::size_t(const Location&)>& formatRecord) {
+	Location location(Level::info, &numberOfRecords, "logbook::benchmarks::Layout", "run", __FILE__, __LINE__, std::this_thread::get_id());
+	std::size_t characters = 0;
+
+	auto begin = std::chrono::steady_clock::now();
+
+	for(std::size_t i = 0; i < numberOfRecords; ++i) {
+		location.line = i;
+		characters += formatRecord(location);
+	}
+
+	auto duration = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - begin);
+	double seconds = duration.count() / 1000000.0;
+
+	std::cout << mode << ": " << numberOfRecords << " records (" << characters << " characters) in " << seconds << " s = "
+			<< static_cast<std::size_t>(numberOfRecords / seconds) << " records/s\n";
+}
+
+} /* anonymous namespace */
+
+void layout() {
+	StringLayout stringLayout;
+	layout::Default defaultLayout;
+
+	defaultLayout.setShowFunction(true);
+	defaultLayout.setShowFile(true);
+	defaultLayout.setShowLineNo(true);
+
+	Location location(Level::info, &numberOfRecords, "logbook::benchmarks::Layout", "run", __FILE__, __LINE__, std::this_thread::get_id());
+	std::cout << "before: \"" << stringLayout.toString(location) << "\"\n";
+	std::cout << "after:  \"" << defaultLayout.toString(location) << "\"\n";
+
+	run("string layout    ", [&stringLayout](const Location& location) {
+		return stringLayout.toString(location).size();
+	});
+
+	run("Default::toString", [&defaultLayout](const Location& location) {
+		return defaultLayout.toString(location).size();
+	});
+
+	run("Default::format  ", [&defaultLayout](const Location& location) {
+		char buffer[layout::Default::maxSize];
+		return defaultLayout.format(location, buffer, sizeof(buffer));
+	});
+}
+
+} /* namespace benchmarks */
+} /* inline namespace v0_4 */
+} /* namespace logbook */
@@ -0,0 +1,15 @@
+#ifndef LOGBOOK_BENCHMARKS_LAYOUT_H_
+#define LOGBOOK_BENCHMARKS_LAYOUT_H_
+
+namespace logbook {
+inline namespace v0_4 {
+namespace benchmarks {
+
+/* Compares records per second of the former string based layout with layout::Default::toString and layout::Default::format. */
+void layout();
+
+} /* namespace benchmarks */
+} /* inline namespace v0_4 */
+} /* namespace logbook */
+
+#endif /* LOGBOOK_BENCHMARKS_LAYOUT_H_ */
@@ -0,0 +1,105 @@
+#include <logbook/benchmarks/Throughput.h>
+#include <logbook/Appender.h>
+#include <logbook/Logbook.h>
+#include <logbook/Logger.h>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace logbook {
+inline namespace v0_4 {
+namespace benchmarks {
+
+namespace {
+
+constexpr unsigned int numberOfThreads = 32;
+constexpr std::size_t recordsPerThread = 50000;
+
+/* Appender that just counts the lines, so we measure the logging framework and not the output device. */
+class CountingAppender : public Appender {
+public:
+	std::size_t getLines() const {
+		return lines;
+	}
+
+	void reset() {
+		lines = 0;
+	}
+
+protected:
+	void flush() override {
+	}
+
+	void write(const Location&, const char* ptr, std::size_t size) override {
+		for(std::size_t i = 0; i < size; ++i) {
+			if(ptr[i] == '\n') {
+				++lines;
+			}
+		}
+	}
+
+private:
+	std::size_t lines = 0;
+};
+
+logbook::Logger logger("logbook::benchmarks::Throughput");
+
+void produce(unsigned int threadNo) {
+	for(std::size_t i = 0; i < recordsPerThread; ++i) {
+		logger.info(__func__, __FILE__, __LINE__) << "thread " << threadNo << " writes record " << i << " of " << recordsPerThread << "\n";
+	}
+}
+
+void run(const std::string& mode, CountingAppender& appender) {
+	appender.reset();
+
+	auto begin = std::chrono::steady_clock::now();
+
+	std::vector<std::thread> threads;
+	for(unsigned int threadNo = 0; threadNo < numberOfThreads; ++threadNo) {
+		threads.emplace_back(produce, threadNo);
+	}
+	for(auto& thread : threads) {
+		thread.join();
+	}
+
+	/* drain pending records if asynchronous logging is used. Time to drain is part of the measurement. */
+	logbook::setAsynchronous(false);
+
+	auto duration = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - begin);
+	double seconds = duration.count() / 1000000.0;
+
+	std::cout << mode << ": " << appender.getLines() << " records in " << seconds << " s = "
+			<< static_cast<std::size_t>(appender.getLines() / seconds) << " records/s\n";
+}
+
+} /* anonymous namespace */
+
+void throughput() {
+	CountingAppender appender;
+
+	/* Records are disabled, so other appenders of the examples (RecordLevel::SELECTED) are quiet.
+	 * CountingAppender records all of them and logbook formats them anyway. */
+	appender.setRecordLevel(Appender::RecordLevel::ALL);
+	logbook::setLevel(logbook::Level::silent, "*");
+
+	std::cout << numberOfThreads << " threads, " << recordsPerThread << " records per thread\n";
+
+	logbook::setUnblocked(false);
+	run("blocked     ", appender);
+
+	logbook::setUnblocked(true);
+	run("unblocked   ", appender);
+
+	logbook::setAsynchronous(true);
+	run("asynchronous", appender);
+}
+
+} /* namespace benchmarks */
+} /* inline namespace v0_4 */
+} /* namespace logbook */
@@ -0,0 +1,15 @@
+#ifndef LOGBOOK_BENCHMARKS_THROUGHPUT_H_
+#define LOGBOOK_BENCHMARKS_THROUGHPUT_H_
+
+namespace logbook {
+inline namespace v0_4 {
+namespace benchmarks {
+
+/* Compares records per second of blocked, unblocked and asynchronous logging with many threads. */
+void throughput();
+
+} /* namespace benchmarks */
+} /* inline namespace v0_4 */
+} /* namespace logbook */
+
+#endif /* LOGBOOK_BENCHMARKS_THROUGHPUT_H_ */
@@ -2,6 +2,8 @@
 #include <logbook/examples/Example02.h>
 #include <logbook/examples/Example03.h>
 #include <logbook/examples/Example04.h>
+#include <logbook/benchmarks/Layout.h>
+#include <logbook/benchmarks/Throughput.h>
 #include <iostream>
 #include <string>
 
@@ -12,6 +14,8 @@ void printUsage() {
 	std::cout << "  example02\n";
 	std::cout << "  example03\n";
 	std::cout << "  example04\n";
+	std::cout << "  throughput\n";
+	std::cout << "  layout\n";
 }
 
 int main(int argc, const char *argv[]) {
@@ -42,6 +46,12 @@ int main(int argc, const char *argv[]) {
 		logbook::examples::loggerInitialize();
 		logbook::examples::example04();
 	}
+	else if(argument == "throughput") {
+		logbook::benchmarks::throughput();
+	}
+	else if(argument == "layout") {
+		logbook::benchmarks::layout();
+	}
 	else {
 		std::cout << "unknown argument \"" << argument << "\".\n\n";
 		printUsage();
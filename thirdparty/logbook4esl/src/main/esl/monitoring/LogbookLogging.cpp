@@ -40,10 +40,18 @@ bool LogbookLogging::isEnabled(const char* typeName, Streams::Level level) {
 	return logging->isEnabled(typeName, level);
 }
 
+const std::atomic<unsigned int>* LogbookLogging::getEnabledMask(const char* typeName) {
+	return logging->getEnabledMask(typeName);
+}
+
 std::unique_ptr<OStream> LogbookLogging::createOStream(const Streams::Location& location) {
 	return logging->createOStream(location);
 }
 
+void LogbookLogging::write(const Streams::Location& location, const Streams::Record& record) {
+	logging->write(location, record);
+}
+
 unsigned int LogbookLogging::getThreadNo(std::thread::id threadId) {
 	return logging->getThreadNo(threadId);
 }
@@ -7,6 +7,7 @@
 #include <esl/monitoring/OStream.h>
 #include <esl/monitoring/Streams.h>
 
+#include <atomic>
 #include <memory>
 #include <string>
 #include <thread>
@@ -34,7 +35,9 @@ public:
 	void setLevel(Streams::Level logLevel, const std::string& typeName) override;
 
 	bool isEnabled(const char* typeName, Streams::Level level) override;
+	const std::atomic<unsigned int>* getEnabledMask(const char* typeName) override;
 	std::unique_ptr<OStream> createOStream(const Streams::Location& location) override;
+	void write(const Streams::Location& location, const Streams::Record& record) override;
 	unsigned int getThreadNo(std::thread::id threadId) override;
 
 	void flush(std::ostream* oStream) override;
@@ -60,7 +60,13 @@ esl::monitoring::Streams::Location logbookLocation2eslLoggingLocation(const logb
 Appender::Appender(std::unique_ptr<esl::monitoring::Appender> aEslAppender)
 : logbook::Appender(),
   eslAppender(std::move(aEslAppender))
-{ }
+{
+	/* The esl appender filters records by its record level by itself. Logbook gets to know it only
+	 * to keep all levels in its enabled masks, if the esl appender records all of them. */
+	if(eslAppender && eslAppender->getRecordLevel() == esl::monitoring::Appender::RecordLevel::ALL) {
+		setRecordLevel(RecordLevel::ALL);
+	}
+}
 
 void Appender::flush(std::ostream* oStream) {
 	if(eslAppender) {
@@ -108,6 +108,12 @@ bool Logging::isEnabled(const char* typeName, esl::monitoring::Streams::Level aL
 	return logbook::isLoggingEnabled(typeName, level);
 }
 
+const std::atomic<unsigned int>* Logging::getEnabledMask(const char* typeName) {
+	/* Bits of logbook's mask can be used as they are, because
+	 * esl::monitoring::Streams::Level and logbook::Level have the same order. */
+	return logbook::getEnabledMask(typeName);
+}
+
 std::unique_ptr<esl::monitoring::OStream> Logging::createOStream(const esl::monitoring::Streams::Location& aLocation) {
 	logbook::Level level = eslLoggingLevel2logbookLevel(aLocation.level);
 	logbook::Location location(level, aLocation.object, aLocation.typeName, aLocation.function, aLocation.file, aLocation.line, aLocation.threadId);
@@ -117,6 +123,14 @@ std::unique_ptr<esl::monitoring::OStream> Logging::createOStream(const esl::moni
 	return std::unique_ptr<esl::monitoring::OStream>(new OStream(*this, std::move(writer)));
 }
 
+void Logging::write(const esl::monitoring::Streams::Location& aLocation, const esl::monitoring::Streams::Record& record) {
+	logbook::Level level = eslLoggingLevel2logbookLevel(aLocation.level);
+	logbook::Location location(level, aLocation.object, aLocation.typeName, aLocation.function, aLocation.file, aLocation.line, aLocation.threadId);
+
+	/* record is copied by logbook in asynchronous mode and formatted later by the drain thread */
+	logbook::writeRecord(location, record.getData(), record.getSize(), &esl::monitoring::Streams::Record::format);
+}
+
 unsigned int Logging::getThreadNo(std::thread::id threadId) {
 	return logbook::getThreadNo(threadId);
 }
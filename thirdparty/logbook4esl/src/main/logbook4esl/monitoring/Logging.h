@@ -33,6 +33,7 @@ SOFTWARE.
 #include <esl/monitoring/OStream.h>
 #include <esl/monitoring/Streams.h>
 
+#include <atomic>
 #include <map>
 #include <memory>
 #include <ostream>
@@ -61,7 +62,9 @@ public:
 	void setLevel(esl::monitoring::Streams::Level logLevel, const std::string& typeName) override;
 
 	bool isEnabled(const char* typeName, esl::monitoring::Streams::Level level) override;
+	const std::atomic<unsigned int>* getEnabledMask(const char* typeName) override;
 	std::unique_ptr<esl::monitoring::OStream> createOStream(const esl::monitoring::Streams::Location& location) override;
+	void write(const esl::monitoring::Streams::Location& location, const esl::monitoring::Streams::Record& record) override;
 	unsigned int getThreadNo(std::thread::id threadId) override;
 
 	void flush(std::ostream* oStream) override;
@@ -18,6 +18,7 @@ MHDSocket::Settings::Settings(const std::vector<std::pair<std::string, std::stri
 	bool hasConnectionTimeout = false;
 	bool hasConnectionLimit = false;
 	bool hasPerIpConnectionLimit = false;
+	bool hasEventLoop = false;
 
 	for(const auto& setting : settings) {
 		if(setting.first == "https") {
@@ -110,6 +111,25 @@ MHDSocket::Settings::Settings(const std::vector<std::pair<std::string, std::stri
 		    	throw system::Stacktrace::add(std::runtime_error("Invalid value for \"" + setting.first + "\"=\"" + setting.second + "\""));
 		    }
 		}
+		else if(setting.first == "event-loop") {
+			if(hasEventLoop) {
+	            throw system::Stacktrace::add(std::runtime_error("multiple definition of attribute 'event-loop'."));
+			}
+			hasEventLoop = true;
+
+			if(setting.second == "select") {
+				eventLoop = EventLoop::select;
+			}
+			else if(setting.second == "poll") {
+				eventLoop = EventLoop::poll;
+			}
+			else if(setting.second == "epoll") {
+				eventLoop = EventLoop::epoll;
+			}
+			else {
+		    	throw system::Stacktrace::add(std::runtime_error("Invalid value for \"" + setting.first + "\"=\"" + setting.second + "\". Allowed values are \"select\", \"poll\" and \"epoll\"."));
+			}
+		}
 		else {
 			throw system::Stacktrace::add(std::runtime_error("Key \"" + setting.first + "\" is unknown"));
 		}
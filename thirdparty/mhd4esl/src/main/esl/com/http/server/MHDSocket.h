@@ -20,6 +20,15 @@ namespace server {
 class MHDSocket : public Socket {
 public:
 	struct Settings {
+		/* select: select() based event loop, limited to FD_SETSIZE connections.
+		 * poll:   poll() based event loop.
+		 * epoll:  epoll based event loop, recommended for thousands of keep-alive connections. Requires a thread pool ("threads" > 0). */
+		enum class EventLoop {
+			select,
+			poll,
+			epoll
+		};
+
 		Settings(const std::vector<std::pair<std::string, std::string>>& settings);
 
 		bool https = false;
@@ -28,6 +37,7 @@ public:
 		unsigned int connectionTimeout = 120;
 		unsigned int connectionLimit = 15;
 		unsigned int perIpConnectionLimit = 0;
+		EventLoop eventLoop = EventLoop::select;
 	};
 
 	MHDSocket(const Settings& settings);
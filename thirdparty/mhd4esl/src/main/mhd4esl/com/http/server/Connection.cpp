@@ -18,7 +18,12 @@
 
 #include <mhd4esl/com/http/server/Connection.h>
 
+#include <esl/io/output/File.h>
+#include <esl/io/output/Memory.h>
+#include <esl/io/output/String.h>
+#include <esl/io/Producer.h>
 #include <esl/io/Reader.h>
+#include <esl/io/Writer.h>
 #include <esl/Logger.h>
 #include <esl/system/Stacktrace.h>
 
@@ -27,6 +32,9 @@
 #include <sys/types.h>
 #include <sys/stat.h>
 #include <fcntl.h>
+#include <unistd.h>
+
+#include <stdexcept>
 
 namespace mhd4esl {
 inline namespace v1_6 {
@@ -38,8 +46,9 @@ namespace {
 esl::Logger logger("mhd4esl::com::http::Connection");
 }
 
-Connection::Connection(MHD_Connection& mhdConnection)
-: mhdConnection(mhdConnection)
+Connection::Connection(MHD_Connection& mhdConnection, bool aIsSuspendable)
+: mhdConnection(mhdConnection),
+  isSuspendable(aIsSuspendable)
 { }
 
 Connection::~Connection() {
@@ -49,6 +58,7 @@ Connection::~Connection() {
 }
 
 bool Connection::sendQueue() noexcept {
+	std::lock_guard<std::mutex> lock(mutex);
 	bool rv = true;
 
 	for(auto& response : responseQueue) {
@@ -62,10 +72,12 @@ bool Connection::sendQueue() noexcept {
 }
 
 bool Connection::isResponseQueueEmpty() noexcept {
+	std::lock_guard<std::mutex> lock(mutex);
 	return responseQueue.empty();
 }
 
 bool Connection::hasResponseSent() noexcept {
+	std::lock_guard<std::mutex> lock(mutex);
 	return responseSent;
 }
 
@@ -76,23 +88,89 @@ bool Connection::send(const esl::com::http::server::Response& response, const vo
 }
 
 bool Connection::send(const esl::com::http::server::Response& response, esl::io::Output output) {
+	MHD_Response* mhdResponse = createDirectResponse(output);
+	if(mhdResponse) {
+		return sendResponse(response, mhdResponse);
+	}
+
 	esl::io::Output* outputPtr = new esl::io::Output(std::move(output));
-	MHD_Response* mhdResponse = MHD_create_response_from_callback(-1, 8192, contentReaderCallback, outputPtr, contentReaderFreeCallback);
+	mhdResponse = MHD_create_response_from_callback(-1, 8192, contentReaderCallback, outputPtr, contentReaderFreeCallback);
 
 	return sendResponse(response, mhdResponse);
 }
 
 bool Connection::sendFile(const esl::com::http::server::Response& response, const std::string& path) {
+    MHD_Response* mhdResponse = createFileResponse(path, 0);
+    if(mhdResponse == nullptr) {
+        return false;
+    }
+
+    return sendResponse(response, mhdResponse);
+}
+
+MHD_Response* Connection::createDirectResponse(esl::io::Output& output) {
+	/* An empty output has neither a producer nor a reader, both getters would throw. It is sent as empty body. */
+	if(!output) {
+		return MHD_create_response_from_buffer(0, nullptr, MHD_RESPMEM_PERSISTENT);
+	}
+
+	/* Output has been created by a Producer or a Reader. The other one is generated by Output,
+	 * so at most one of both dynamic casts below can succeed for each type. */
+	esl::io::Producer* producer = &output.getProducer();
+	esl::io::Reader* reader = &output.getReader();
+
+	/* Memory does not own its data and the caller has to keep it alive as long as the output is used.
+	 * So MHD can send the data directly out of the buffer. */
+	if(esl::io::output::Memory* memory = dynamic_cast<esl::io::output::Memory*>(producer)) {
+		if(memory->getSize() == esl::io::Writer::npos) {
+			return nullptr;
+		}
+		return MHD_create_response_from_buffer(memory->getSize(), const_cast<void*>(memory->getData()), MHD_RESPMEM_PERSISTENT);
+	}
+
+	/* String owns its data, so the output is kept alive until MHD has sent the response. */
+	if(esl::io::output::String* string = dynamic_cast<esl::io::output::String*>(producer)) {
+#if MHD_VERSION >= 0x00097300
+		esl::io::Output* outputPtr = new esl::io::Output(std::move(output));
+		MHD_Response* mhdResponse = MHD_create_response_from_buffer_with_free_callback_cls(string->getSize(), string->getData(), contentReaderFreeCallback, outputPtr);
+		if(mhdResponse == nullptr) {
+			delete outputPtr;
+		}
+		return mhdResponse;
+#else
+		return MHD_create_response_from_buffer(string->getSize(), const_cast<void*>(string->getData()), MHD_RESPMEM_MUST_COPY);
+#endif
+	}
+
+	/* File is sent by sendfile() from the kernel */
+	if(esl::io::output::File* file = dynamic_cast<esl::io::output::File*>(reader)) {
+		if(!file->hasSize()) {
+			return nullptr;
+		}
+		return createFileResponse(file->getFilename(), file->getPosition());
+	}
+
+	return nullptr;
+}
+
+MHD_Response* Connection::createFileResponse(const std::string& path, std::size_t offset) {
     int fd = open(path.c_str(), O_RDONLY);
     if(fd < 0) {
-        return false;
+        return nullptr;
+    }
+    off_t size = lseek(fd, 0, SEEK_END);
+    if(size < 0 || static_cast<std::size_t>(size) < offset) {
+        close(fd);
+        return nullptr;
     }
-    size_t size = static_cast<size_t>(lseek(fd, 0, SEEK_END));
-    lseek(fd, 0, SEEK_SET);
 
-    MHD_Response* mhdResponse = MHD_create_response_from_fd(size, fd);
+    // MHD closes fd if the response gets destroyed
+    MHD_Response* mhdResponse = MHD_create_response_from_fd_at_offset64(static_cast<std::size_t>(size) - offset, fd, offset);
+    if(mhdResponse == nullptr) {
+        close(fd);
+    }
 
-    return sendResponse(response, mhdResponse);
+    return mhdResponse;
 }
 
 bool Connection::sendResponse(const esl::com::http::server::Response& response, MHD_Response* mhdResponse) noexcept {
@@ -112,11 +190,67 @@ bool Connection::sendResponse(const esl::com::http::server::Response& response,
 	    return MHD_queue_response(&mhdConnection, httpStatusCode, mhdResponse) == MHD_YES;
 	};
 
+	std::lock_guard<std::mutex> lock(mutex);
 	responseQueue.push_back(std::make_tuple(sendFunc, mhdResponse));
 
 	return true;
 }
 
+void Connection::suspend() {
+	std::lock_guard<std::mutex> lock(mutex);
+
+	if(state != State::running) {
+		throw esl::system::Stacktrace::add(std::runtime_error("Connection is suspended already."));
+	}
+	state = State::suspendRequested;
+}
+
+void Connection::resume() {
+	std::lock_guard<std::mutex> lock(mutex);
+
+	switch(state) {
+	case State::suspendRequested:
+		// request has been completed before the MHD thread has suspended the connection, so there is nothing to resume.
+		state = State::running;
+		break;
+	case State::suspended:
+		state = State::running;
+		if(isSuspendable) {
+			MHD_resume_connection(&mhdConnection);
+		}
+		else {
+			resumed.notify_one();
+		}
+		break;
+	default:
+		throw esl::system::Stacktrace::add(std::runtime_error("Cannot resume connection that has not been suspended."));
+	}
+}
+
+bool Connection::suspendIfRequested() noexcept {
+	std::unique_lock<std::mutex> lock(mutex);
+
+	if(state != State::suspendRequested) {
+		return false;
+	}
+
+	state = State::suspended;
+
+	if(!isSuspendable) {
+		// this thread serves just this connection, so it can wait until the response has been queued
+		logger.debug << "Wait for resuming connection\n";
+		resumed.wait(lock, [this] {
+			return state == State::running;
+		});
+		return false;
+	}
+
+	logger.debug << "Suspend connection\n";
+	MHD_suspend_connection(&mhdConnection);
+
+	return true;
+}
+
 ssize_t Connection::contentReaderCallback(void* cls, uint64_t bytesTransmitted, char* buffer, size_t bufferSize) {
     esl::io::Output* outputPtr = static_cast<esl::io::Output*>(cls);
     if(outputPtr == nullptr) {
@@ -23,8 +23,10 @@
 #include <esl/com/http/server/Response.h>
 #include <esl/io/Output.h>
 
+#include <condition_variable>
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <string>
 #include <tuple>
 #include <vector>
@@ -41,7 +43,9 @@ namespace server {
 class Connection : public esl::com::http::server::Connection {
 friend class Socket;
 public:
-	Connection(MHD_Connection& mhdConnection);
+	/* isSuspendable is false if the daemon uses a thread per connection, because MHD cannot suspend such connections.
+	 * Then suspendIfRequested() blocks the connection's thread until resume() is called. */
+	Connection(MHD_Connection& mhdConnection, bool isSuspendable);
 	~Connection();
 
 	bool sendQueue() noexcept;
@@ -53,13 +57,39 @@ public:
 	bool send(const esl::com::http::server::Response& response, esl::io::Output output) override;
 	bool sendFile(const esl::com::http::server::Response& response, const std::string& path) override;
 
+	void suspend() override;
+	void resume() override;
+
+	/* Suspends the MHD connection if "suspend" has been called and the request has not been completed already.
+	 * Returns true if the connection has been suspended.
+	 * If the connection is not suspendable, it waits for "resume" instead and returns false.
+	 * This method must be called by the MHD thread that is processing this connection. */
+	bool suspendIfRequested() noexcept;
+
 private:
+	enum class State {
+		running,
+		suspendRequested,
+		suspended
+	};
+
 	bool sendResponse(const esl::com::http::server::Response& response, MHD_Response* mhdResponse) noexcept;
 
+	/* returns a response that sends the data of output without copying it through contentReaderCallback.
+	 * nullptr is returned if the kind of output is not supported, so the output has to be sent by contentReaderCallback. */
+	static MHD_Response* createDirectResponse(esl::io::Output& output);
+	static MHD_Response* createFileResponse(const std::string& path, std::size_t offset);
+
     static ssize_t contentReaderCallback(void* cls, uint64_t bytesTransmitted, char* buffer, size_t bufferSize);
     static void contentReaderFreeCallback(void* cls);
 
 	MHD_Connection& mhdConnection;
+	const bool isSuspendable;
+
+	/* protects responseQueue and state, because the response can be queued by another thread if the connection is suspended */
+	std::mutex mutex;
+	std::condition_variable resumed;
+	State state = State::running;
 	std::vector<std::tuple<std::function<bool()>, MHD_Response*>> responseQueue;
 	bool responseSent = false;
 };
@@ -25,9 +25,9 @@ namespace com {
 namespace http {
 namespace server {
 
-RequestContext::RequestContext(MHD_Connection& mhdConnection, const char* version, const char* method, const char* url, bool isHTTPS, uint16_t port)
+RequestContext::RequestContext(MHD_Connection& mhdConnection, const char* version, const char* method, const char* url, bool isHTTPS, uint16_t port, bool isSuspendable)
 : esl::com::http::server::RequestContext(),
-  connection(mhdConnection),
+  connection(mhdConnection, isSuspendable),
   request(mhdConnection, version, method, url, isHTTPS, port)
 { }
 
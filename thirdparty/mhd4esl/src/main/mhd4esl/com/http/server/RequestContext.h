@@ -46,7 +46,7 @@ namespace server {
 class RequestContext : public esl::com::http::server::RequestContext {
 	friend class Socket;
 public:
-	RequestContext(MHD_Connection& mhdConnection, const char* version, const char* method, const char* url, bool isHTTPS, uint16_t port);
+	RequestContext(MHD_Connection& mhdConnection, const char* version, const char* method, const char* url, bool isHTTPS, uint16_t port, bool isSuspendable);
 
 	esl::com::http::server::Connection& getConnection() const override;
 	const esl::com::http::server::Request& getRequest() const override;
@@ -58,6 +58,7 @@ private:
 	mutable Connection connection;
 	Request request;
 	esl::io::Input input;
+	bool inputCompleted = false;
 	common4esl::object::Context context;
 };
 
@@ -207,13 +207,28 @@ void Socket::listen(const esl::com::http::server::RequestHandler& aRequestHandle
 	unsigned int flags = 0;
 
 	if(settings.numThreads == 0) {
+		if(settings.eventLoop == esl::com::http::server::MHDSocket::Settings::EventLoop::epoll) {
+			throw esl::system::Stacktrace::add(std::runtime_error("HTTP socket (port=" + std::to_string(settings.port) + ") cannot use epoll event loop without thread pool."));
+		}
+		// MHD does not allow suspend/resume with a thread per connection, so Connection blocks the connection's thread instead
 		flags |= MHD_USE_THREAD_PER_CONNECTION;
 	}
+	else {
+		// suspend/resume is required for RequestHandlers that complete the request asynchronously
+		flags |= MHD_USE_SUSPEND_RESUME;
+	}
 
-	flags |= MHD_USE_SELECT_INTERNALLY;
-	// flags |= MHD_USE_POLL_INTERNALLY;
-
-	// flags |= MHD_USE_SUSPEND_RESUME;
+	switch(settings.eventLoop) {
+	case esl::com::http::server::MHDSocket::Settings::EventLoop::poll:
+		flags |= MHD_USE_POLL_INTERNALLY;
+		break;
+	case esl::com::http::server::MHDSocket::Settings::EventLoop::epoll:
+		flags |= MHD_USE_EPOLL_INTERNALLY;
+		break;
+	default:
+		flags |= MHD_USE_SELECT_INTERNALLY;
+		break;
+	}
 
 #ifdef MHD4ESL_LOGGING_LEVEL_DEBUG
     flags |= MHD_USE_DEBUG;
@@ -314,7 +329,7 @@ MHD_Result Socket::mhdAcceptHandler(void* cls,
 	RequestContext** requestContext = reinterpret_cast<RequestContext**>(connectionSpecificDataPtr);
 	if(*requestContext == nullptr) {
 		try {
-			*requestContext = new RequestContext(*mhdConnection, version, method, url, socket->usingTLS, socket->settings.port);
+			*requestContext = new RequestContext(*mhdConnection, version, method, url, socket->usingTLS, socket->settings.port, socket->settings.numThreads > 0);
 			(*requestContext)->input = socket->requestHandler->accept(**requestContext);
 
 			if((*requestContext)->input && *uploadDataSize == 0) {
@@ -354,6 +369,11 @@ bool Socket::accept(RequestContext& requestContext, const char* uploadData, std:
 			logger.debug << "No input\n";
 			*uploadDataSize = 0;
 
+			// response will be sent later, so release this thread until the connection gets resumed
+			if(requestContext.connection.suspendIfRequested()) {
+				return true;
+			}
+
 			if(requestContext.connection.isResponseQueueEmpty()) {
 				logger.debug << "Nothing in response queue -> push 404 page into respone queue\n";
 				esl::com::http::server::Response response(404, esl::utility::MIME::Type::textHtml);
@@ -368,15 +388,22 @@ bool Socket::accept(RequestContext& requestContext, const char* uploadData, std:
 			return true;
 		}
 
-		bool lastCall = (*uploadDataSize == 0);
-		std::size_t size = requestContext.input.getWriter().write(uploadData, *uploadDataSize);
+		// input has been written completely before the connection has been suspended, so it must not be written again after resuming
+		bool lastCall = requestContext.inputCompleted || (*uploadDataSize == 0);
+		std::size_t size = requestContext.inputCompleted ? 0 : requestContext.input.getWriter().write(uploadData, *uploadDataSize);
 
 		if(lastCall || size == esl::io::Writer::npos) {
 			*uploadDataSize = 0;
+			requestContext.inputCompleted = true;
 
 			//logger.debug << "Reset input object\n";
 			//requestContext.input = esl::utility::io::Input();
 
+			// response will be sent later, so release this thread until the connection gets resumed
+			if(requestContext.connection.suspendIfRequested()) {
+				return true;
+			}
+
 			// drop connection
 			if(requestContext.connection.isResponseQueueEmpty()) {
 				logger.debug << "There was no response sent -> drop connection\n";
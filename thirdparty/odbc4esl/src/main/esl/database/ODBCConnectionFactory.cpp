@@ -11,6 +11,9 @@ namespace database {
 ODBCConnectionFactory::Settings::Settings(const std::vector<std::pair<std::string, std::string>>& settings) {
 	bool hasDefaultBufferSize = false;
 	bool hasMaximumBufferSize = false;
+	bool hasStatementCacheSize = false;
+	bool hasBulkBatchSize = false;
+	bool hasRowArraySize = false;
 
 	for(const auto& setting : settings) {
 		if(setting.first == "connection-string" || setting.first == "connectionString") {
@@ -36,6 +39,33 @@ ODBCConnectionFactory::Settings::Settings(const std::vector<std::pair<std::strin
 			hasMaximumBufferSize = true;
 			maximumBufferSize = std::stoi(setting.second);
 		}
+		else if(setting.first == "statement-cache-size") {
+			if(hasStatementCacheSize) {
+				throw std::runtime_error("Multiple definition of parameter key \"" + setting.first + "\" at ODBCConnectionFactory");
+			}
+			hasStatementCacheSize = true;
+			statementCacheSize = static_cast<std::size_t>(std::stoul(setting.second));
+		}
+		else if(setting.first == "bulk-batch-size") {
+			if(hasBulkBatchSize) {
+				throw std::runtime_error("Multiple definition of parameter key \"" + setting.first + "\" at ODBCConnectionFactory");
+			}
+			hasBulkBatchSize = true;
+			bulkBatchSize = static_cast<std::size_t>(std::stoul(setting.second));
+			if(bulkBatchSize == 0) {
+				throw std::runtime_error("Invalid value \"" + setting.second + "\" for parameter key \"" + setting.first + "\" at ODBCConnectionFactory");
+			}
+		}
+		else if(setting.first == "row-array-size") {
+			if(hasRowArraySize) {
+				throw std::runtime_error("Multiple definition of parameter key \"" + setting.first + "\" at ODBCConnectionFactory");
+			}
+			hasRowArraySize = true;
+			rowArraySize = static_cast<std::size_t>(std::stoul(setting.second));
+			if(rowArraySize == 0) {
+				throw std::runtime_error("Invalid value \"" + setting.second + "\" for parameter key \"" + setting.first + "\" at ODBCConnectionFactory");
+			}
+		}
 		else {
 			throw std::runtime_error("Key \"" + setting.first + "\" is unknown");
 		}
@@ -58,6 +88,10 @@ std::unique_ptr<Connection> ODBCConnectionFactory::createConnection() {
 	return connectionFactory->createConnection();
 }
 
+ODBCConnectionFactory::Statistics ODBCConnectionFactory::getStatistics() const {
+	return static_cast<const odbc4esl::database::ConnectionFactory&>(*connectionFactory).getStatistics();
+}
+
 } /* namespace database */
 } /* inline namespace v1_6 */
 } /* namespace esl */
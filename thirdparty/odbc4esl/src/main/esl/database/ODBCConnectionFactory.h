@@ -21,6 +21,22 @@ public:
 		std::string connectionString;
 		std::size_t defaultBufferSize = 65536;
 		std::size_t maximumBufferSize = 65536;
+
+		/* number of prepared statements cached per connection. 0 disables the cache. */
+		std::size_t statementCacheSize = 16;
+
+		/* number of rows a PreparedBulkStatement sends with one SQLExecute as column-wise bound parameter arrays */
+		std::size_t bulkBatchSize = 1000;
+
+		/* number of rows a ResultSet fetches with one SQLFetchScroll into column-wise bound arrays.
+		 * If the driver does not report SQL_GD_BLOCK and SQL_GD_BOUND for SQL_GETDATA_EXTENSIONS, 1 is used
+		 * for result sets with a column whose values might not fit into the bound buffer. */
+		std::size_t rowArraySize = 100;
+	};
+
+	struct Statistics {
+		std::size_t statementCacheHits = 0;
+		std::size_t statementCacheMisses = 0;
 	};
 
 	ODBCConnectionFactory(const Settings& settings);
@@ -29,6 +45,9 @@ public:
 
     std::unique_ptr<Connection> createConnection() override;
 
+    /* accumulated over all connections created by this factory */
+    Statistics getStatistics() const;
+
 private:
 	std::unique_ptr<ConnectionFactory> connectionFactory;
 };
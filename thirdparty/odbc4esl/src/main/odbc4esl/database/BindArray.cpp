@@ -0,0 +1,133 @@
+/*
+ * This file is part of odbc4esl.
+ * Copyright (C) 2020-2023 Sven Lukas
+ *
+ * Odbc4esl is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Odbc4esl is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser Public License
+ * along with mhd4esl.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <odbc4esl/database/BindArray.h>
+#include <odbc4esl/database/Driver.h>
+
+#include <cstring>
+
+namespace odbc4esl {
+inline namespace v1_6 {
+namespace database {
+
+BindArray::BindArray(const esl::database::Column& aColumn, std::size_t capacity)
+: column(aColumn)
+{
+	switch(column.getType()) {
+	case esl::database::Column::Type::sqlInteger:
+	case esl::database::Column::Type::sqlSmallInt:
+		storage = Storage::integer;
+		integers.reserve(capacity);
+		break;
+
+	case esl::database::Column::Type::sqlDouble:
+	case esl::database::Column::Type::sqlNumeric:
+	case esl::database::Column::Type::sqlDecimal:
+	case esl::database::Column::Type::sqlFloat:
+	case esl::database::Column::Type::sqlReal:
+		storage = Storage::real;
+		doubles.reserve(capacity);
+		break;
+
+	default:
+		storage = Storage::string;
+		strings.reserve(capacity);
+		break;
+	}
+
+	indicators.reserve(capacity);
+}
+
+void BindArray::add(const esl::database::Field& field) {
+	switch(storage) {
+	case Storage::integer:
+		integers.push_back(field.isNull() ? 0 : field.asInteger());
+		indicators.push_back(field.isNull() ? SQL_NULL_DATA : 0);
+		break;
+
+	case Storage::real:
+		doubles.push_back(field.isNull() ? 0.0 : field.asDouble());
+		indicators.push_back(field.isNull() ? SQL_NULL_DATA : 0);
+		break;
+
+	case Storage::string:
+		if(field.isNull()) {
+			strings.emplace_back();
+			indicators.push_back(SQL_NULL_DATA);
+		}
+		else {
+			strings.push_back(field.asString());
+			indicators.push_back(static_cast<SQLLEN>(strings.back().size()));
+		}
+		break;
+	}
+}
+
+void BindArray::clear() {
+	integers.clear();
+	doubles.clear();
+	strings.clear();
+	indicators.clear();
+}
+
+void BindArray::bind(const StatementHandle& statementHandle, std::size_t index) {
+	switch(storage) {
+	case Storage::integer:
+		Driver::getDriver().bindParameter(statementHandle, static_cast<SQLUSMALLINT>(index+1), SQL_PARAM_INPUT,
+				SQL_C_SBIGINT, Driver::columnType2SqlType(column.getType()),
+				column,
+				static_cast<SQLPOINTER>(integers.data()),
+				0,
+				indicators.data());
+		break;
+
+	case Storage::real:
+		Driver::getDriver().bindParameter(statementHandle, static_cast<SQLUSMALLINT>(index+1), SQL_PARAM_INPUT,
+				SQL_C_DOUBLE, Driver::columnType2SqlType(column.getType()),
+				column,
+				static_cast<SQLPOINTER>(doubles.data()),
+				0,
+				indicators.data());
+		break;
+
+	case Storage::string: {
+		std::size_t elementSize = 1;
+		for(const auto& str : strings) {
+			if(elementSize < str.size() + 1) {
+				elementSize = str.size() + 1;
+			}
+		}
+
+		stringBuffer.assign(strings.size() * elementSize, 0);
+		for(std::size_t i = 0; i < strings.size(); ++i) {
+			std::memcpy(&stringBuffer[i * elementSize], strings[i].data(), strings[i].size());
+		}
+
+		Driver::getDriver().bindParameter(statementHandle, static_cast<SQLUSMALLINT>(index+1), SQL_PARAM_INPUT, SQL_C_CHAR, SQL_CHAR,
+				column,
+				static_cast<SQLPOINTER>(stringBuffer.data()),
+				static_cast<SQLLEN>(elementSize),
+				indicators.data());
+		break;
+	}
+	}
+}
+
+} /* namespace database */
+} /* inline namespace v1_6 */
+} /* namespace odbc4esl */
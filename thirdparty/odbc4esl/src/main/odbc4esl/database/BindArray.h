@@ -0,0 +1,73 @@
+/*
+ * This file is part of odbc4esl.
+ * Copyright (C) 2020-2023 Sven Lukas
+ *
+ * Odbc4esl is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Odbc4esl is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser Public License
+ * along with mhd4esl.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef ODBC4ESL_DATABASE_BINDARRAY_H_
+#define ODBC4ESL_DATABASE_BINDARRAY_H_
+
+#include <odbc4esl/database/StatementHandle.h>
+
+#include <esl/database/Column.h>
+#include <esl/database/Field.h>
+
+#include <sqlext.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+namespace odbc4esl {
+inline namespace v1_6 {
+namespace database {
+
+/* Column-wise bound parameter array. It collects the values of one parameter for several rows,
+ * so a prepared statement can be executed once for all rows with SQL_ATTR_PARAMSET_SIZE. */
+class BindArray {
+public:
+	BindArray(const esl::database::Column& column, std::size_t capacity);
+
+	void add(const esl::database::Field& field);
+	void clear();
+
+	/* Binds the collected values to parameter "index" (0-based).
+	 * Values must not be added or cleared before the statement has been executed. */
+	void bind(const StatementHandle& statementHandle, std::size_t index);
+
+private:
+	enum class Storage {
+		integer, real, string
+	};
+
+	const esl::database::Column& column;
+	Storage storage;
+
+	std::vector<std::int64_t> integers;
+	std::vector<double> doubles;
+
+	/* strings are collected first, because the element size of the bound buffer is the longest string of all rows */
+	std::vector<std::string> strings;
+	std::vector<char> stringBuffer;
+
+	std::vector<SQLLEN> indicators;
+};
+
+} /* namespace database */
+} /* inline namespace v1_6 */
+} /* namespace odbc4esl */
+
+#endif /* ODBC4ESL_DATABASE_BINDARRAY_H_ */
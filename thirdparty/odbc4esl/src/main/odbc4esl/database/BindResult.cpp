@@ -21,8 +21,12 @@
 
 #include <esl/Logger.h>
 
+#include <esl/io/Reader.h>
 #include <esl/system/Stacktrace.h>
 
+#include <cstring>
+#include <memory>
+
 namespace odbc4esl {
 inline namespace v1_6 {
 namespace database {
@@ -33,15 +37,105 @@ esl::Logger logger("odbc4esl::database::BindResult");
 
 constexpr std::size_t BindResult::resultDataSize;
 
-BindResult::BindResult(const StatementHandle& aStatementHandle, const esl::database::Column& aColumn, std::size_t aIndex)
+namespace {
+/* LongDataReader reads the value of a column of the current row in parts by SQLGetData */
+class LongDataReader : public esl::io::Reader {
+public:
+	LongDataReader(const StatementHandle& statementHandle, std::size_t index);
+
+	std::size_t read(void* data, std::size_t size) override;
+	std::size_t getSizeReadable() const override;
+	bool hasSize() const override;
+	std::size_t getSize() const override;
+
+private:
+	static constexpr std::size_t partSize = 65536;
+
+	bool readPart();
+
+	const StatementHandle& statementHandle;
+	const std::size_t index;
+
+	std::vector<char> buffer;
+	std::size_t bufferPos = 0;
+	std::size_t bufferSize = 0;
+	bool isEOF = false;
+};
+
+LongDataReader::LongDataReader(const StatementHandle& aStatementHandle, std::size_t aIndex)
+: statementHandle(aStatementHandle),
+  index(aIndex),
+  buffer(partSize + 1)
+{ }
+
+std::size_t LongDataReader::read(void* data, std::size_t size) {
+	if(size == 0) {
+		return 0;
+	}
+
+	while(bufferPos >= bufferSize) {
+		if(isEOF || readPart() == false) {
+			return npos;
+		}
+	}
+
+	if(size > bufferSize - bufferPos) {
+		size = bufferSize - bufferPos;
+	}
+	std::memcpy(data, &buffer[bufferPos], size);
+	bufferPos += size;
+
+	return size;
+}
+
+std::size_t LongDataReader::getSizeReadable() const {
+	if(bufferPos < bufferSize) {
+		return bufferSize - bufferPos;
+	}
+	return isEOF ? 0 : npos;
+}
+
+bool LongDataReader::hasSize() const {
+	return false;
+}
+
+std::size_t LongDataReader::getSize() const {
+	return npos;
+}
+
+bool LongDataReader::readPart() {
+	SQLLEN indicator = 0;
+	if(Driver::getDriver().getDataPart(statementHandle, static_cast<SQLUSMALLINT>(index+1), SQL_C_CHAR, &buffer[0], buffer.size(), &indicator) == false
+	|| indicator == SQL_NULL_DATA) {
+		isEOF = true;
+		return false;
+	}
+
+	/* each part but the last fills the buffer up to the terminating null character */
+	if(indicator == SQL_NO_TOTAL || static_cast<std::size_t>(indicator) >= buffer.size()) {
+		bufferSize = buffer.size() - 1;
+	}
+	else {
+		bufferSize = static_cast<std::size_t>(indicator);
+	}
+	bufferPos = 0;
+
+	return true;
+}
+} /* anonymous namespace */
+
+BindResult::BindResult(const StatementHandle& aStatementHandle, const esl::database::Column& aColumn, std::size_t aIndex, std::size_t aRowArraySize)
 : statementHandle(aStatementHandle),
   column(aColumn),
-  index(aIndex)
+  index(aIndex),
+  rowArraySize(aRowArraySize),
+  resultIndicators(aRowArraySize, 0)
 {
 	switch(column.getType()) {
 	case esl::database::Column::Type::sqlInteger:
 	case esl::database::Column::Type::sqlSmallInt:
-		Driver::getDriver().bindCol(statementHandle, index, resultInteger, resultIndicator);
+		resultIntegers.resize(rowArraySize);
+		Driver::getDriver().bindCol(statementHandle, index, resultIntegers[0], resultIndicators[0]);
 		break;
 
 	case esl::database::Column::Type::sqlDouble:
@@ -49,7 +143,8 @@ BindResult::BindResult(const StatementHandle& aStatementHandle, const esl::datab
 	case esl::database::Column::Type::sqlDecimal:
 	case esl::database::Column::Type::sqlFloat:
 	case esl::database::Column::Type::sqlReal:
-		Driver::getDriver().bindCol(statementHandle, index, resultDouble, resultIndicator);
+		resultDoubles.resize(rowArraySize);
+		Driver::getDriver().bindCol(statementHandle, index, resultDoubles[0], resultIndicators[0]);
 		break;
 
 	default:
@@ -64,11 +159,18 @@ BindResult::BindResult(const StatementHandle& aStatementHandle, const esl::datab
 
 		SQLLEN valueInputLength = column.getBufferSize();
 		*/
+		/* A block of rows uses the described column size instead of the full buffer per element.
+		 * Longer values are fetched by setField with SQLGetData. */
+		if(rowArraySize > 1 && !hasLongValues(column)) {
+			resultDataElementSize = column.getBufferSize() + 1;
+		}
+		resultData.resize(resultDataElementSize * rowArraySize);
+
 		logger.trace << "BindResult:\n";
-		logger.trace << "- resultIndicator: " << resultIndicator << "\n";
 		//logger.trace << "- valueInputLength: " << valueInputLength << "\n";
-		logger.trace << "- valueInputLength: " << resultDataSize << "\n";
-		Driver::getDriver().bindCol(statementHandle, index, resultData, resultDataSize, resultIndicator);
+		logger.trace << "- valueInputLength: " << resultDataElementSize << "\n";
+		logger.trace << "- rowArraySize: " << rowArraySize << "\n";
+		Driver::getDriver().bindCol(statementHandle, index, &resultData[0], resultDataElementSize, resultIndicators[0]);
 		break;
 	}
 
@@ -151,18 +253,20 @@ BindResult::~BindResult() {
 	}
 }
 */
-void BindResult::setField(esl::database::Field& field) {
-	if(isSqlNullData()) {
+bool BindResult::setField(esl::database::Field& field, std::size_t row) {
+	isStreamed = false;
+
+	if(isSqlNullData(row)) {
 		logger.trace << "    Field: NULL\n";
 		field = nullptr;
-		return;
+		return true;
 	}
 
 	switch(column.getType()) {
 	case esl::database::Column::Type::sqlInteger:
 	case esl::database::Column::Type::sqlSmallInt:
-		logger.trace << "    Field: Integer(" << resultInteger << ")\n";
-		field = resultInteger;
+		logger.trace << "    Field: Integer(" << resultIntegers[row] << ")\n";
+		field = resultIntegers[row];
 		break;
 
 	case esl::database::Column::Type::sqlDouble:
@@ -170,21 +274,23 @@ void BindResult::setField(esl::database::Field& field) {
 	case esl::database::Column::Type::sqlDecimal:
 	case esl::database::Column::Type::sqlFloat:
 	case esl::database::Column::Type::sqlReal:
-		logger.trace << "    Field: Double(" << resultDouble << ")\n";
-		field = resultDouble;
+		logger.trace << "    Field: Double(" << resultDoubles[row] << ")\n";
+		field = resultDoubles[row];
 		break;
 
 	case esl::database::Column::Type::sqlVarChar:
 	case esl::database::Column::Type::sqlChar:
 	default:
 		logger.trace << "    Field: String preamble\n";
-		logger.trace << "    - getResultLength() [0] = " << getResultDataLength() << "\n";
+		logger.trace << "    - getResultLength() [0] = " << getResultDataLength(row) << "\n";
 		//logger.trace << "    - bufferSize            = " << column.getBufferSize() << "\n";
-		logger.trace << "    - bufferSize            = " << resultDataSize << "\n";
+		logger.trace << "    - bufferSize            = " << resultDataElementSize << "\n";
 
 		// if(getResultLength() > column.getBufferSize()) {
-		if(isSqlNoTotal()) {
-			throw esl::system::Stacktrace::add(std::runtime_error("(1) getResultLength() == SQL_NO_TOTAL"));
+		if(isSqlNoTotal(row)) {
+			/* length is unknown, so the value is read by loadField or getOutput */
+			logger.trace << "    Field: deferred String(...) [SQL_NO_TOTAL]\n";
+			return false;
 #if 0
 			std::string str;
 			while(true) {
@@ -246,45 +352,132 @@ void BindResult::setField(esl::database::Field& field) {
 			field = str;
 #endif
 		}
-		else if(getResultDataLength() > resultDataSize) {
-			std::size_t tmpBufferSize = getResultDataLength();
-			logger.trace << "    Field: String(...) [" << tmpBufferSize << "]\n";
-			//char* tmpBuffer = new char[tmpBufferSize+1];
-			std::vector<char> tmpBuffer(tmpBufferSize+1);
-
-			Driver::getDriver().getData(statementHandle, static_cast<SQLUSMALLINT>(index+1),
-					SQL_C_CHAR, &tmpBuffer[0], tmpBufferSize+1, &resultIndicator);
-
-			if(isSqlNullData()) {
-				//delete[] tmpBuffer;
-				throw esl::system::Stacktrace::add(std::runtime_error("Fetching of column \"" + std::to_string(index) + "\" was SQL_NO_TOTAL but getData() got SQL_NULL_DATA result."));
-			}
-
-			std::string str(&tmpBuffer[0], tmpBufferSize);
-			tmpBuffer.clear();
-			//logger.trace << "    Field: Str(\"" << str << "\")\n";
-			field = str;
+		else if(getResultDataLength(row) >= resultDataElementSize) {
+			logger.trace << "    Field: deferred String(...) [" << getResultDataLength(row) << "]\n";
+			return false;
+		}
+		else if(field.getSimpleType() == esl::database::Field::Type::storageString) {
+			/* Field refers to our buffer that is valid until the next block gets fetched */
+			field.setView(std::string_view(&resultData[row * resultDataElementSize], getResultDataLength(row)));
 		}
 		else {
-			std::string str(resultData, getResultDataLength());
-			//logger.trace << "    Field: String(\"" << str << "\")\n";
-			field = str;
+			field = std::string_view(&resultData[row * resultDataElementSize], getResultDataLength(row));
 		}
 		break;
 	}
 
+	return true;
+}
+
+void BindResult::loadField(esl::database::Field& field, std::size_t row) {
+	if(isStreamed) {
+		throw esl::system::Stacktrace::add(std::runtime_error("Value of column \"" + column.getName() + "\" has already been read by getOutput."));
+	}
+
+	field = getLongString(row);
+}
+
+bool BindResult::hasLongValues(const esl::database::Column& column) noexcept {
+	switch(column.getType()) {
+	case esl::database::Column::Type::sqlInteger:
+	case esl::database::Column::Type::sqlSmallInt:
+	case esl::database::Column::Type::sqlDouble:
+	case esl::database::Column::Type::sqlNumeric:
+	case esl::database::Column::Type::sqlDecimal:
+	case esl::database::Column::Type::sqlFloat:
+	case esl::database::Column::Type::sqlReal:
+		return false;
+	default:
+		break;
+	}
+	return column.getBufferSize() == 0 || column.getBufferSize() >= resultDataSize;
+}
+
+esl::io::Output BindResult::getOutput(std::size_t row) {
+	if(isStreamed) {
+		throw esl::system::Stacktrace::add(std::runtime_error("Value of column \"" + column.getName() + "\" has already been read by getOutput."));
+	}
+	isStreamed = true;
+
+	/* SQLGetData works on the current row of the rowset, so position the cursor first */
+	if(rowArraySize > 1) {
+		Driver::getDriver().setPos(statementHandle, static_cast<SQLSETPOSIROW>(row+1), SQL_POSITION, SQL_LOCK_NO_CHANGE);
+	}
+
+	return esl::io::Output(std::unique_ptr<esl::io::Reader>(new LongDataReader(statementHandle, index)));
+}
+
+esl::database::ResultBatch::Storage BindResult::getBatchStorage() const noexcept {
+	if(!resultIntegers.empty()) {
+		return esl::database::ResultBatch::Storage::integer;
+	}
+	if(!resultDoubles.empty()) {
+		return esl::database::ResultBatch::Storage::real;
+	}
+	return esl::database::ResultBatch::Storage::string;
+}
+
+void BindResult::addValue(esl::database::ResultBatch::Array& array, std::size_t row) {
+	if(isSqlNullData(row)) {
+		array.addNull();
+	}
+	else if(!resultIntegers.empty()) {
+		array.addInteger(resultIntegers[row]);
+	}
+	else if(!resultDoubles.empty()) {
+		array.addDouble(resultDoubles[row]);
+	}
+	else if(isSqlNoTotal(row) || getResultDataLength(row) >= resultDataElementSize) {
+		std::string str = getLongString(row);
+		array.addString(str.data(), str.size());
+	}
+	else {
+		array.addString(&resultData[row * resultDataElementSize], getResultDataLength(row));
+	}
+}
+
+std::string BindResult::getLongString(std::size_t row) {
+	/* SQLGetData works on the current row of the rowset, so position the cursor first */
+	if(rowArraySize > 1) {
+		Driver::getDriver().setPos(statementHandle, static_cast<SQLSETPOSIROW>(row+1), SQL_POSITION, SQL_LOCK_NO_CHANGE);
+	}
+
+	if(isSqlNoTotal(row)) {
+		/* read the value in parts until SQLGetData returns SQL_NO_DATA */
+		LongDataReader reader(statementHandle, index);
+		std::string str;
+		char buffer[4096];
+		for(std::size_t size = reader.read(buffer, sizeof(buffer)); size != esl::io::Reader::npos; size = reader.read(buffer, sizeof(buffer))) {
+			str.append(buffer, size);
+		}
+		return str;
+	}
+
+	std::size_t tmpBufferSize = getResultDataLength(row);
+	//char* tmpBuffer = new char[tmpBufferSize+1];
+	std::vector<char> tmpBuffer(tmpBufferSize+1);
+
+	Driver::getDriver().getData(statementHandle, static_cast<SQLUSMALLINT>(index+1),
+			SQL_C_CHAR, &tmpBuffer[0], tmpBufferSize+1, &resultIndicators[row]);
+
+	if(isSqlNullData(row)) {
+		//delete[] tmpBuffer;
+		throw esl::system::Stacktrace::add(std::runtime_error("Fetching of column \"" + std::to_string(index) + "\" was SQL_NO_TOTAL but getData() got SQL_NULL_DATA result."));
+	}
+
+	return std::string(&tmpBuffer[0], tmpBufferSize);
 }
 
-std::size_t BindResult::getResultDataLength() const noexcept {
-	return static_cast<std::size_t>(resultIndicator);
+std::size_t BindResult::getResultDataLength(std::size_t row) const noexcept {
+	return static_cast<std::size_t>(resultIndicators[row]);
 }
 
-bool BindResult::isSqlNullData() const noexcept {
-	return static_cast<SQLINTEGER>(resultIndicator) == SQL_NULL_DATA;
+bool BindResult::isSqlNullData(std::size_t row) const noexcept {
+	return static_cast<SQLINTEGER>(resultIndicators[row]) == SQL_NULL_DATA;
 }
 
-bool BindResult::isSqlNoTotal() const noexcept {
-	return static_cast<SQLINTEGER>(resultIndicator) == SQL_NO_TOTAL;
+bool BindResult::isSqlNoTotal(std::size_t row) const noexcept {
+	return static_cast<SQLINTEGER>(resultIndicators[row]) == SQL_NO_TOTAL;
 }
 
 } /* namespace database */
@@ -23,20 +23,24 @@
 
 #include <esl/database/Column.h>
 #include <esl/database/Field.h>
+#include <esl/database/ResultBatch.h>
+#include <esl/io/Output.h>
 
 #include <sqlext.h>
 
 #include <string>
 #include <cstdint>
 #include <cstddef>
+#include <vector>
 
 namespace odbc4esl {
 inline namespace v1_6 {
 namespace database {
 
+/* BindResult binds a column-wise array of rowArraySize elements, so a single SQLFetchScroll fills a block of rows. */
 class BindResult {
 public:
-	BindResult(const StatementHandle& statementHandle, const esl::database::Column& column, std::size_t index);
+	BindResult(const StatementHandle& statementHandle, const esl::database::Column& column, std::size_t index, std::size_t rowArraySize);
 	//virtual ~BindResult();
 
 	BindResult(const BindResult& other) = delete;
@@ -45,27 +49,47 @@ public:
 	BindResult& operator=(const BindResult&) = delete;
 	BindResult& operator=(BindResult&& other) = delete;
 
-	void setField(esl::database::Field& field);
+	/* returns true if a value of the column might not fit into the bound element of a row array,
+	 * so it has to be read by SQLGetData */
+	static bool hasLongValues(const esl::database::Column& column) noexcept;
+
+	/* Sets field to the value of row "row" of the current rowset. Returns false if the value does not fit
+	 * into the bound buffer. Such a value is read by SQLGetData when loadField(...) or getOutput(...) gets called. */
+	bool setField(esl::database::Field& field, std::size_t row);
+	void loadField(esl::database::Field& field, std::size_t row);
+
+	/* returns a reader for the value of row "row" that reads it in parts by SQLGetData */
+	esl::io::Output getOutput(std::size_t row);
+
+	/* storage type of the bound buffer */
+	esl::database::ResultBatch::Storage getBatchStorage() const noexcept;
+
+	/* adds the value of row "row" of the current rowset to array */
+	void addValue(esl::database::ResultBatch::Array& array, std::size_t row);
 
 private:
-	std::size_t getResultDataLength() const noexcept;
-	bool isSqlNullData() const noexcept;
-	bool isSqlNoTotal() const noexcept;
+	std::size_t getResultDataLength(std::size_t row) const noexcept;
+	bool isSqlNullData(std::size_t row) const noexcept;
+	bool isSqlNoTotal(std::size_t row) const noexcept;
+	std::string getLongString(std::size_t row);
 
 	const StatementHandle& statementHandle;
 	const esl::database::Column& column;
 	const std::size_t index;
+	const std::size_t rowArraySize;
 
 	static constexpr std::size_t resultDataSize = 4096;
 
-	union {
-		//char* valueData;
-		char resultData[resultDataSize];
-		std::int64_t resultInteger;
-		double resultDouble;
-	};
+	/* size of a single string element in resultData */
+	std::size_t resultDataElementSize = resultDataSize;
+
+	std::vector<char> resultData;
+	std::vector<std::int64_t> resultIntegers;
+	std::vector<double> resultDoubles;
+	std::vector<SQLLEN> resultIndicators;
 
-	SQLLEN resultIndicator = 0;
+	/* true if the value of the current row has been read by getOutput */
+	bool isStreamed = false;
 };
 
 } /* namespace database */
@@ -22,6 +22,7 @@
 #include <esl/Logger.h>
 
 #include <string.h> // memcpy
+#include <vector>
 
 namespace odbc4esl {
 inline namespace v1_6 {
@@ -31,6 +32,8 @@ namespace {
 esl::Logger logger("odbc4esl::database::BindVariable");
 }
 
+constexpr std::size_t BindVariable::putDataSize;
+
 BindVariable::BindVariable(const StatementHandle& aStatementHandle, const esl::database::Column& aColumn, std::size_t aIndex)
 : statementHandle(aStatementHandle),
   column(aColumn),
@@ -260,6 +263,42 @@ void BindVariable::getField(const esl::database::Field& field) {
 	}
 }
 
+void BindVariable::getOutput(esl::io::Output& aOutput) {
+	output = &aOutput;
+	resultLength = SQL_LEN_DATA_AT_EXEC(0);
+
+	/* the value pointer is the token that SQLParamData returns for this parameter */
+	Driver::getDriver().bindParameter(statementHandle, static_cast<SQLUSMALLINT>(index+1), SQL_PARAM_INPUT, SQL_C_CHAR, SQL_LONGVARCHAR,
+			column,
+			static_cast<SQLPOINTER>(this),
+			0,
+			&resultLength);
+
+	logger.trace << "Parameter " << index << ": SQL_DATA_AT_EXEC\n";
+}
+
+void BindVariable::putData() {
+	if(output == nullptr) {
+		return;
+	}
+
+	esl::io::Reader& reader = output->getReader();
+	std::vector<char> buffer(putDataSize);
+	bool hasData = false;
+
+	for(std::size_t size = reader.read(&buffer[0], buffer.size()); size != esl::io::Reader::npos; size = reader.read(&buffer[0], buffer.size())) {
+		if(size > 0) {
+			Driver::getDriver().putData(statementHandle, &buffer[0], size);
+			hasData = true;
+		}
+	}
+
+	/* an empty value needs a single call with length 0, otherwise it would be NULL */
+	if(hasData == false) {
+		Driver::getDriver().putData(statementHandle, &buffer[0], 0);
+	}
+}
+
 } /* namespace database */
 } /* inline namespace v1_6 */
 } /* namespace odbc4esl */
@@ -23,6 +23,7 @@
 
 #include <esl/database/Field.h>
 #include <esl/database/Column.h>
+#include <esl/io/Output.h>
 
 #include <sqlext.h>
 
@@ -44,11 +45,18 @@ struct BindVariable {
 
 	void getField(const esl::database::Field& field);
 
+	/* binds the parameter with SQL_DATA_AT_EXEC. Its data is read from "output" by putData() while the statement is executed */
+	void getOutput(esl::io::Output& output);
+	void putData();
+
 private:
 	const StatementHandle& statementHandle;
 	const esl::database::Column& column;
 	const std::size_t index;
 
+	static constexpr std::size_t putDataSize = 65536;
+	esl::io::Output* output = nullptr;
+
 	union {
 		char* valueString;
 		std::int64_t valueInteger;
@@ -45,7 +45,9 @@ std::set<std::string> implementations{{"unixODBC"}};
 Connection::Connection(const ConnectionFactory& connectionFactory)
 : handle(Driver::getDriver().allocHandleConnection(connectionFactory)),
   defaultBufferSize(connectionFactory.getSettings().defaultBufferSize),
-  maximumBufferSize(connectionFactory.getSettings().maximumBufferSize)
+  maximumBufferSize(connectionFactory.getSettings().maximumBufferSize),
+  bulkBatchSize(connectionFactory.getSettings().bulkBatchSize),
+  rowArraySize(connectionFactory.getSettings().rowArraySize)
 {
 	ESL__LOGGER_TRACE_THIS("create connection\n");
 
@@ -53,6 +55,19 @@ Connection::Connection(const ConnectionFactory& connectionFactory)
     Driver::getDriver().setConnectAttr(*this, SQL_ATTR_AUTOCOMMIT, (SQLPOINTER)SQL_AUTOCOMMIT_OFF, SQL_NTS);
 
 	Driver::getDriver().driverConnect(*this, connectionFactory.getSettings().connectionString);
+
+	/* Long values are read by SQLGetData after SQLSetPos on the current row of a row array.
+	 * Drivers support this only if they report SQL_GD_BLOCK and SQL_GD_BOUND. */
+	if(rowArraySize > 1) {
+		SQLUINTEGER getDataExtensions = Driver::getDriver().getInfoUInteger(*this, SQL_GETDATA_EXTENSIONS);
+		hasGetDataOnRowArrays = (getDataExtensions & (SQL_GD_BLOCK | SQL_GD_BOUND)) == (SQL_GD_BLOCK | SQL_GD_BOUND);
+	}
+
+	if(connectionFactory.getSettings().statementCacheSize > 0) {
+		deletesStatementsOnCommit = Driver::getDriver().getInfoUSmallInt(*this, SQL_CURSOR_COMMIT_BEHAVIOR) == SQL_CB_DELETE;
+		deletesStatementsOnRollback = Driver::getDriver().getInfoUSmallInt(*this, SQL_CURSOR_ROLLBACK_BEHAVIOR) == SQL_CB_DELETE;
+		statementCache.reset(new StatementCache(*this, connectionFactory.getSettings().statementCacheSize, connectionFactory.getStatementCacheCounters()));
+	}
 }
 
 Connection::~Connection() {
@@ -61,6 +76,9 @@ Connection::~Connection() {
 	location.file = __FILE__;
 
 	try {
+		// free cached statement handles before disconnecting
+		statementCache.reset();
+
 		if(!isClosed()) {
 		    rollback();
 			Driver::getDriver().disconnect(*this);
@@ -106,17 +124,39 @@ SQLHANDLE Connection::getHandle() const {
 }
 
 esl::database::PreparedStatement Connection::prepare(const std::string& sql) const {
-	return esl::database::PreparedStatement(std::unique_ptr<esl::database::PreparedStatement::Binding>(new PreparedStatementBinding(*this, sql, defaultBufferSize, maximumBufferSize)));
+	return esl::database::PreparedStatement(std::unique_ptr<esl::database::PreparedStatement::Binding>(new PreparedStatementBinding(*this, sql, defaultBufferSize, maximumBufferSize, rowArraySize)));
 }
 
 esl::database::PreparedBulkStatement Connection::prepareBulk(const std::string& sql) const {
-	return esl::database::PreparedBulkStatement(std::unique_ptr<esl::database::PreparedBulkStatement::Binding>(new PreparedBulkStatementBinding(*this, sql, defaultBufferSize, maximumBufferSize)));
+	return esl::database::PreparedBulkStatement(std::unique_ptr<esl::database::PreparedBulkStatement::Binding>(new PreparedBulkStatementBinding(*this, sql, defaultBufferSize, maximumBufferSize, bulkBatchSize)));
+}
+
+StatementHandle Connection::prepareODBC(const std::string& sql) const {
+	if(statementCache) {
+		return statementCache->prepare(sql);
+	}
+	return Driver::getDriver().prepare(*this, sql);
+}
+
+bool Connection::isGetDataOnRowArraysSupported() const {
+	return hasGetDataOnRowArrays;
+}
+
+StatementCache* Connection::getStatementCache() const {
+	return statementCache.get();
 }
 
 void Connection::commit() const {
 	if(!isClosed()) {
+		for(auto bulkStatement : bulkStatements) {
+			bulkStatement->flush();
+		}
+
 		ESL__LOGGER_TRACE_THIS("Do commit\n");
 		Driver::getDriver().endTran(*this, SQL_COMMIT);
+		if(statementCache && deletesStatementsOnCommit) {
+			statementCache->clear();
+		}
 	}
 	else {
 		ESL__LOGGER_TRACE_THIS("NO commit, connection already closed\n");
@@ -125,10 +165,25 @@ void Connection::commit() const {
 
 void Connection::rollback() const {
 	if(!isClosed()) {
+		for(auto bulkStatement : bulkStatements) {
+			bulkStatement->discard();
+		}
+
 		Driver::getDriver().endTran(*this, SQL_ROLLBACK);
+		if(statementCache && deletesStatementsOnRollback) {
+			statementCache->clear();
+		}
 	}
 }
 
+void Connection::addBulkStatement(PreparedBulkStatementBinding& bulkStatement) const {
+	bulkStatements.insert(&bulkStatement);
+}
+
+void Connection::removeBulkStatement(PreparedBulkStatementBinding& bulkStatement) const {
+	bulkStatements.erase(&bulkStatement);
+}
+
 bool Connection::isClosed() const {
 	return handle == SQL_NULL_HDBC;
 }
@@ -20,6 +20,8 @@
 #define ODBC4ESL_DATABASE_CONNECTION_H_
 
 #include <odbc4esl/database/ConnectionFactory.h>
+#include <odbc4esl/database/StatementCache.h>
+#include <odbc4esl/database/StatementHandle.h>
 
 #include <esl/database/Connection.h>
 #include <esl/database/PreparedStatement.h>
@@ -29,6 +31,7 @@
 
 #include <sqlext.h>
 
+#include <memory>
 #include <set>
 #include <string>
 #include <vector>
@@ -37,6 +40,8 @@ namespace odbc4esl {
 inline namespace v1_6 {
 namespace database {
 
+class PreparedBulkStatementBinding;
+
 class Connection : public esl::database::Connection {
 public:
 	Connection(const ConnectionFactory& connectionFactory);
@@ -46,12 +51,24 @@ public:
 
 	esl::database::PreparedStatement prepare(const std::string& sql) const override;
 	esl::database::PreparedBulkStatement prepareBulk(const std::string& sql) const override;
+	StatementHandle prepareODBC(const std::string& sql) const;
+
+	/* returns true if the driver supports SQLGetData on a row of a row array (SQL_GD_BLOCK and SQL_GD_BOUND) */
+	bool isGetDataOnRowArraysSupported() const;
+
+	/* returns nullptr if statement cache is disabled */
+	StatementCache* getStatementCache() const;
 	//esl::database::ResultSet getTable(const std::string& tableName);
 
+	/* commit() executes rows that are still collected by bulk statements of this connection, rollback() discards them */
 	void commit() const override;
 	void rollback() const override;
 	bool isClosed() const override;
 
+	/* called by PreparedBulkStatementBinding for its own lifetime */
+	void addBulkStatement(PreparedBulkStatementBinding& bulkStatement) const;
+	void removeBulkStatement(PreparedBulkStatementBinding& bulkStatement) const;
+
 	void* getNativeHandle() const override;
 
 	const std::set<std::string>& getImplementations() const override;
@@ -60,6 +77,17 @@ private:
 	SQLHANDLE handle;
 	std::size_t defaultBufferSize;
 	std::size_t maximumBufferSize;
+	std::size_t bulkBatchSize;
+	std::size_t rowArraySize;
+	bool hasGetDataOnRowArrays = false;
+
+	/* true if the driver closes prepared statements on commit or rollback (SQL_CB_DELETE) */
+	bool deletesStatementsOnCommit = false;
+	bool deletesStatementsOnRollback = false;
+
+	std::unique_ptr<StatementCache> statementCache;
+
+	mutable std::set<PreparedBulkStatementBinding*> bulkStatements;
 };
 
 } /* namespace database */
@@ -99,6 +99,19 @@ std::unique_ptr<esl::database::Connection> ConnectionFactory::createConnection()
 	return std::unique_ptr<esl::database::Connection>(new Connection(*this));
 }
 
+const std::shared_ptr<StatementCache::Counters>& ConnectionFactory::getStatementCacheCounters() const noexcept {
+	return statementCacheCounters;
+}
+
+esl::database::ODBCConnectionFactory::Statistics ConnectionFactory::getStatistics() const {
+	esl::database::ODBCConnectionFactory::Statistics statistics;
+
+	statistics.statementCacheHits = statementCacheCounters->hits;
+	statistics.statementCacheMisses = statementCacheCounters->misses;
+
+	return statistics;
+}
+
 } /* namespace database */
 } /* inline namespace v1_6 */
 } /* namespace odbc4esl */
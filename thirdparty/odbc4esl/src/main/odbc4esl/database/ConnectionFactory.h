@@ -23,6 +23,8 @@
 #include <esl/database/ConnectionFactory.h>
 #include <esl/database/ODBCConnectionFactory.h>
 
+#include <odbc4esl/database/StatementCache.h>
+
 #include <sqlext.h>
 
 #include <memory>
@@ -41,9 +43,15 @@ public:
 
 	std::unique_ptr<esl::database::Connection> createConnection() override;
 
+	const std::shared_ptr<StatementCache::Counters>& getStatementCacheCounters() const noexcept;
+	esl::database::ODBCConnectionFactory::Statistics getStatistics() const;
+
 private:
 	esl::database::ODBCConnectionFactory::Settings settings;
 	SQLHANDLE handle;
+
+	/* shared with the statement caches, because connections might live longer than their factory */
+	std::shared_ptr<StatementCache::Counters> statementCacheCounters = std::make_shared<StatementCache::Counters>();
 };
 
 } /* namespace database */
@@ -322,6 +322,24 @@ void Driver::disconnect(const Connection& connection) const {
 	ESL__LOGGER_TRACE_THIS("disconnected\n");
 }
 
+SQLUSMALLINT Driver::getInfoUSmallInt(const Connection& connection, SQLUSMALLINT infoType) const {
+	SQLUSMALLINT value = 0;
+
+	SQLRETURN rc = SQLGetInfo(connection.getHandle(), infoType, &value, sizeof(value), nullptr);
+	checkAndThrow(rc, SQL_HANDLE_DBC, connection.getHandle(), "SQLGetInfo");
+
+	return value;
+}
+
+SQLUINTEGER Driver::getInfoUInteger(const Connection& connection, SQLUSMALLINT infoType) const {
+	SQLUINTEGER value = 0;
+
+	SQLRETURN rc = SQLGetInfo(connection.getHandle(), infoType, &value, sizeof(value), nullptr);
+	checkAndThrow(rc, SQL_HANDLE_DBC, connection.getHandle(), "SQLGetInfo");
+
+	return value;
+}
+
 bool Driver::getDiagRec(esl::database::Diagnostic& diagnostic, SQLSMALLINT type, SQLHANDLE handle, SQLSMALLINT index) const {
 	SQLRETURN rc;
 	SQLINTEGER sqlcode;
@@ -437,6 +455,11 @@ void Driver::describeParam(const StatementHandle& statementHandle, SQLSMALLINT i
 	resultNullable = (sqlParameterValueNullable != 0);
 }
 
+void Driver::setStmtAttr(const StatementHandle& statementHandle, SQLINTEGER attribute, SQLPOINTER value, SQLINTEGER stringLength) const {
+	SQLRETURN rc = SQLSetStmtAttr(statementHandle.getHandle(), attribute, value, stringLength);
+	checkAndThrow(rc, SQL_HANDLE_STMT, statementHandle.getHandle(), "SQLSetStmtAttr");
+}
+
 void Driver::bindParameter(const StatementHandle& statementHandle, SQLSMALLINT index, SQLSMALLINT ioType, SQLSMALLINT cType, SQLSMALLINT sqlType,
 	const esl::database::Column& column, SQLPOINTER valuePtr, SQLLEN bufferLength, SQLLEN* indicatorPtrOrStrLen) const {
 	SQLRETURN rc = SQLBindParameter(statementHandle.getHandle(), index, ioType, cType, sqlType,
@@ -524,9 +547,54 @@ void Driver::getData(const StatementHandle& statementHandle, SQLSMALLINT index,
 	}
 }
 
-void Driver::execute(const StatementHandle& statementHandle) const {
+bool Driver::getDataPart(const StatementHandle& statementHandle, SQLSMALLINT index,
+		SQLSMALLINT dataType,
+		void* dataValue,
+		std::size_t dataBufferLength,
+		SQLLEN* dataButterLengthOrIndicator) const {
+	SQLRETURN rc = SQLGetData(statementHandle.getHandle(), index, dataType, static_cast<SQLPOINTER>(dataValue), static_cast<SQLLEN>(dataBufferLength), dataButterLengthOrIndicator);
+	if(rc == SQL_NO_DATA) {
+		return false;
+	}
+
+	/* SQL_SUCCESS_WITH_INFO is returned with 01004 (string data, right truncated) for each part but the last */
+	if(rc != SQL_SUCCESS_WITH_INFO) {
+		checkAndThrow(rc, SQL_HANDLE_STMT, statementHandle.getHandle(), "SQLGetData()");
+	}
+	return true;
+}
+
+bool Driver::execute(const StatementHandle& statementHandle) const {
 	SQLRETURN rc = SQLExecute(statementHandle.getHandle());
+	if(rc == SQL_NEED_DATA) {
+		return true;
+	}
 	checkAndThrow(rc, SQL_HANDLE_STMT, statementHandle.getHandle(), "SQLExecute()");
+	return false;
+}
+
+SQLPOINTER Driver::paramData(const StatementHandle& statementHandle) const {
+	SQLPOINTER token = nullptr;
+	SQLRETURN rc = SQLParamData(statementHandle.getHandle(), &token);
+	if(rc == SQL_NEED_DATA) {
+		return token;
+	}
+
+	/* SQL_NO_DATA is returned by searched UPDATE or DELETE statements that did not affect any row */
+	if(rc != SQL_NO_DATA) {
+		checkAndThrow(rc, SQL_HANDLE_STMT, statementHandle.getHandle(), "SQLParamData()");
+	}
+	return nullptr;
+}
+
+void Driver::putData(const StatementHandle& statementHandle, const void* data, std::size_t size) const {
+	SQLRETURN rc = SQLPutData(statementHandle.getHandle(), const_cast<SQLPOINTER>(data), static_cast<SQLLEN>(size));
+	checkAndThrow(rc, SQL_HANDLE_STMT, statementHandle.getHandle(), "SQLPutData()");
+}
+
+void Driver::cancel(const StatementHandle& statementHandle) const {
+	SQLRETURN rc = SQLCancel(statementHandle.getHandle());
+	checkAndThrow(rc, SQL_HANDLE_STMT, statementHandle.getHandle(), "SQLCancel()");
 }
 
 bool Driver::fetch(const StatementHandle& statementHandle) const {
@@ -538,6 +606,20 @@ bool Driver::fetch(const StatementHandle& statementHandle) const {
 	return true;
 }
 
+bool Driver::fetchScroll(const StatementHandle& statementHandle, SQLSMALLINT orientation, SQLLEN offset) const {
+	SQLRETURN rc = SQLFetchScroll(statementHandle.getHandle(), orientation, offset);
+	if(rc == SQL_NO_DATA) {
+		return false;
+	}
+	checkAndThrow(rc, SQL_HANDLE_STMT, statementHandle.getHandle(), "SQLFetchScroll()");
+	return true;
+}
+
+void Driver::setPos(const StatementHandle& statementHandle, SQLSETPOSIROW rowNumber, SQLUSMALLINT operation, SQLUSMALLINT lockType) const {
+	SQLRETURN rc = SQLSetPos(statementHandle.getHandle(), rowNumber, operation, lockType);
+	checkAndThrow(rc, SQL_HANDLE_STMT, statementHandle.getHandle(), "SQLSetPos()");
+}
+
 } /* namespace database */
 } /* inline namespace v1_6 */
 } /* namespace odbc4esl */
@@ -54,6 +54,8 @@ public:
 	void driverConnect(const Connection& connection, const std::string connectionString) const;
 	void endTran(const Connection& connection, SQLSMALLINT type) const;
 	void disconnect(const Connection& connection) const;
+	SQLUSMALLINT getInfoUSmallInt(const Connection& connection, SQLUSMALLINT infoType) const;
+	SQLUINTEGER getInfoUInteger(const Connection& connection, SQLUSMALLINT infoType) const;
 	bool getDiagRec(esl::database::Diagnostic& diagnostic, SQLSMALLINT type, SQLHANDLE handle, SQLSMALLINT index) const;
 	StatementHandle prepare(const Connection& connection, const std::string& sql) const;
 	SQLSMALLINT numResultCols(const StatementHandle& statementHandle) const;
@@ -61,6 +63,7 @@ public:
 	void describeCol(const StatementHandle& statementHandle, SQLSMALLINT index, std::string& resultColumnName, esl::database::Column::Type& resultColumnType, std::size_t& resultCharacterLength, std::size_t& resultDecimalDigits, bool& resultNullable) const;
 	void colAttributeDisplaySize(const StatementHandle& statementHandle, SQLSMALLINT index, std::size_t& resultDisplayLength) const;
 	void describeParam(const StatementHandle& statementHandle, SQLSMALLINT index, esl::database::Column::Type& resultColumnType, std::size_t& resultCharacterLength, std::size_t& resultDecimalDigits, bool& resultNullable) const;
+	void setStmtAttr(const StatementHandle& statementHandle, SQLINTEGER attribute, SQLPOINTER value, SQLINTEGER stringLength) const;
 	void bindParameter(const StatementHandle& statementHandle, SQLSMALLINT index, SQLSMALLINT ioType, SQLSMALLINT cType, SQLSMALLINT sqlType,
 			const esl::database::Column& column, SQLPOINTER valuePtr, SQLLEN bufferLength, SQLLEN* indicatorPtrOrStrLen) const;
 	/*
@@ -81,8 +84,27 @@ public:
 			std::size_t       dataBufferLength,
 			SQLLEN*           dataButterLengthOrIndicator) const;
 
-	void execute(const StatementHandle& statementHandle) const;
+	/* returns false if all data of the column has already been read (SQL_NO_DATA).
+	 * Truncation of the data is expected, because it is read in parts. */
+	bool getDataPart(const StatementHandle& statementHandle, SQLSMALLINT index,
+			SQLSMALLINT       dataType,
+			void*             dataValue,
+			std::size_t       dataBufferLength,
+			SQLLEN*           dataButterLengthOrIndicator) const;
+
+	/* returns true if parameters bound with SQL_DATA_AT_EXEC need data (SQL_NEED_DATA) */
+	bool execute(const StatementHandle& statementHandle) const;
+
+	/* returns the token of the next parameter that needs data or nullptr if the statement has been executed */
+	SQLPOINTER paramData(const StatementHandle& statementHandle) const;
+	void putData(const StatementHandle& statementHandle, const void* data, std::size_t size) const;
+
+	/* cancels the processing of the statement, e.g. if it still needs data (SQL_NEED_DATA) */
+	void cancel(const StatementHandle& statementHandle) const;
+
 	bool fetch(const StatementHandle& statementHandle) const;
+	bool fetchScroll(const StatementHandle& statementHandle, SQLSMALLINT orientation, SQLLEN offset) const;
+	void setPos(const StatementHandle& statementHandle, SQLSETPOSIROW rowNumber, SQLUSMALLINT operation, SQLUSMALLINT lockType) const;
 };
 
 } /* namespace database */
@@ -17,7 +17,6 @@
  */
 
 #include <odbc4esl/database/PreparedBulkStatementBinding.h>
-#include <odbc4esl/database/BindVariable.h>
 #include <odbc4esl/database/Driver.h>
 
 #include <esl/Logger.h>
@@ -37,10 +36,11 @@ namespace {
 esl::Logger logger("odbc4esl::database::PreparedBulkStatementBinding");
 }
 
-PreparedBulkStatementBinding::PreparedBulkStatementBinding(const Connection& aConnection, const std::string& aSql, std::size_t defaultBufferSize, std::size_t maximumBufferSize)
+PreparedBulkStatementBinding::PreparedBulkStatementBinding(const Connection& aConnection, const std::string& aSql, std::size_t defaultBufferSize, std::size_t maximumBufferSize, std::size_t aBatchSize)
 : connection(aConnection),
   sql(aSql),
-  statementHandle(Driver::getDriver().prepare(connection, sql))
+  statementHandle(connection.prepareODBC(sql)),
+  batchSize(aBatchSize > 0 ? aBatchSize : 1)
 {
 	// Get number of result columns from prepared statement
 	SQLSMALLINT resultColumnCount = Driver::getDriver().numResultCols(statementHandle);
@@ -137,6 +137,18 @@ PreparedBulkStatementBinding::PreparedBulkStatementBinding(const Connection& aCo
 		parameterColumns.emplace_back("", parameterColumnType, parameterValueNullable, defaultBufferSize, maximumBufferSize, parameterValueDecimalDigits, parameterValueCharacterLength, parameterValueCharacterLength);
     }
 	logger.trace << "-----------------------------------------------\n\n";
+
+	// parameterColumns must not change anymore, because the arrays refer to its elements
+	parameterArrays.reserve(parameterColumns.size());
+	for(const auto& parameterColumn : parameterColumns) {
+		parameterArrays.emplace_back(parameterColumn, batchSize);
+	}
+
+	connection.addBulkStatement(*this);
+}
+
+PreparedBulkStatementBinding::~PreparedBulkStatementBinding() {
+	connection.removeBulkStatement(*this);
 }
 
 const std::vector<esl::database::Column>& PreparedBulkStatementBinding::getParameterColumns() const {
@@ -144,26 +156,87 @@ const std::vector<esl::database::Column>& PreparedBulkStatementBinding::getParam
 }
 
 void PreparedBulkStatementBinding::execute(const std::vector<esl::database::Field>& parameterValues) {
+	if(parameterColumns.size() != parameterValues.size()) {
+	    throw esl::system::Stacktrace::add(std::runtime_error("Wrong number of arguments. Given " + std::to_string(parameterValues.size()) + " parameters but required " + std::to_string(parameterColumns.size()) + " parameters."));
+	}
+
+	for(std::size_t i=0; i<parameterValues.size(); ++i) {
+		parameterArrays[i].add(parameterValues[i]);
+	}
+	++rowCount;
+
+	if(rowCount >= batchSize) {
+		executeBatch();
+	}
+}
+
+void PreparedBulkStatementBinding::flush() {
+	if(rowCount > 0) {
+		executeBatch();
+	}
+}
+
+void PreparedBulkStatementBinding::discard() {
+	if(rowCount > 0) {
+		logger.trace << "Discard " << rowCount << " rows\n";
+		resetParameterSet();
+	}
+}
+
+void PreparedBulkStatementBinding::executeBatch() {
 	if(!statementHandle) {
 		logger.trace << "RE-Create statement handle\n";
-		statementHandle = StatementHandle(Driver::getDriver().prepare(connection, sql));
+		statementHandle = connection.prepareODBC(sql);
 	}
 
-	if(parameterColumns.size() != parameterValues.size()) {
-	    throw esl::system::Stacktrace::add(std::runtime_error("Wrong number of arguments. Given " + std::to_string(parameterValues.size()) + " parameters but required " + std::to_string(parameterColumns.size()) + " parameters."));
+	std::size_t rows = rowCount;
+	logger.trace << "Execute batch of " << rows << " rows\n";
+
+	try {
+		parameterStatus.assign(rows, SQL_PARAM_UNUSED);
+		parametersProcessed = 0;
+
+		Driver::getDriver().setStmtAttr(statementHandle, SQL_ATTR_PARAM_BIND_TYPE, reinterpret_cast<SQLPOINTER>(SQL_PARAM_BIND_BY_COLUMN), 0);
+		Driver::getDriver().setStmtAttr(statementHandle, SQL_ATTR_PARAMSET_SIZE, reinterpret_cast<SQLPOINTER>(static_cast<SQLULEN>(rows)), 0);
+		Driver::getDriver().setStmtAttr(statementHandle, SQL_ATTR_PARAM_STATUS_PTR, static_cast<SQLPOINTER>(parameterStatus.data()), 0);
+		Driver::getDriver().setStmtAttr(statementHandle, SQL_ATTR_PARAMS_PROCESSED_PTR, static_cast<SQLPOINTER>(&parametersProcessed), 0);
+
+		for(std::size_t i=0; i<parameterArrays.size(); ++i) {
+			parameterArrays[i].bind(statementHandle, i);
+		}
+
+		Driver::getDriver().execute(statementHandle);
+
+		for(std::size_t i=0; i<parametersProcessed && i<rows; ++i) {
+			if(parameterStatus[i] == SQL_PARAM_ERROR) {
+			    throw esl::system::Stacktrace::add(std::runtime_error("Execution of bulk statement failed for row " + std::to_string(i) + " of batch with " + std::to_string(rows) + " rows."));
+			}
+		}
+	}
+	catch(...) {
+		/* rows of a failed batch are dropped, so they are not executed again by flush() */
+		resetParameterSet();
+		throw;
 	}
 
-	std::vector<std::unique_ptr<BindVariable>> parameterVariables(parameterValues.size());
+	resetParameterSet();
+}
 
-	for(std::size_t i=0; i<parameterValues.size(); ++i) {
-		parameterVariables[i].reset(new BindVariable(statementHandle, parameterColumns[i], i));
-		parameterVariables[i]->getField(parameterValues[i]);
+void PreparedBulkStatementBinding::resetParameterSet() {
+	rowCount = 0;
+	for(auto& parameterArray : parameterArrays) {
+		parameterArray.clear();
 	}
 
-	/* ResultSetBinding makes the "execute" */
-	Driver::getDriver().execute(statementHandle);
+	if(!statementHandle) {
+		return;
+	}
 
-	esl::database::ResultSet resultSet;
+	/* statement handle might be reused by the statement cache, so it must not keep pointers to our buffers */
+	SQLFreeStmt(statementHandle.getHandle(), SQL_RESET_PARAMS);
+	SQLSetStmtAttr(statementHandle.getHandle(), SQL_ATTR_PARAMSET_SIZE, reinterpret_cast<SQLPOINTER>(static_cast<SQLULEN>(1)), 0);
+	SQLSetStmtAttr(statementHandle.getHandle(), SQL_ATTR_PARAM_STATUS_PTR, nullptr, 0);
+	SQLSetStmtAttr(statementHandle.getHandle(), SQL_ATTR_PARAMS_PROCESSED_PTR, nullptr, 0);
 }
 
 void* PreparedBulkStatementBinding::getNativeHandle() const {
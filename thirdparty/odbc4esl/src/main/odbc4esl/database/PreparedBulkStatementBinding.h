@@ -19,6 +19,7 @@
 #ifndef ODBC4ESL_DATABASE_PREPAREDBULKSTATEMENTBINDING_H_
 #define ODBC4ESL_DATABASE_PREPAREDBULKSTATEMENTBINDING_H_
 
+#include <odbc4esl/database/BindArray.h>
 #include <odbc4esl/database/Connection.h>
 #include <odbc4esl/database/StatementHandle.h>
 
@@ -26,6 +27,9 @@
 #include <esl/database/Column.h>
 #include <esl/database/Field.h>
 
+#include <sqlext.h>
+
+#include <cstddef>
 #include <string>
 #include <vector>
 
@@ -35,10 +39,18 @@ namespace database {
 
 class PreparedBulkStatementBinding : public esl::database::PreparedBulkStatement::Binding {
 public:
-	PreparedBulkStatementBinding(const Connection& connection, const std::string& sql, std::size_t defaultBufferSize, std::size_t maximumBufferSize);
+	PreparedBulkStatementBinding(const Connection& connection, const std::string& sql, std::size_t defaultBufferSize, std::size_t maximumBufferSize, std::size_t batchSize);
+	~PreparedBulkStatementBinding();
 
 	const std::vector<esl::database::Column>& getParameterColumns() const override;
+
+	/* rows are collected in column-wise bound arrays and executed with one SQLExecute if batchSize rows are available or flush() is called */
 	void execute(const std::vector<esl::database::Field>& fields) override;
+	void flush() override;
+
+	/* drops collected rows without executing them, e.g. on rollback */
+	void discard();
+
 	void* getNativeHandle() const override;
 
 private:
@@ -46,6 +58,15 @@ private:
 	std::string sql;
 	StatementHandle statementHandle;
 	std::vector<esl::database::Column> parameterColumns;
+
+	const std::size_t batchSize;
+	std::size_t rowCount = 0;
+	std::vector<BindArray> parameterArrays;
+	std::vector<SQLUSMALLINT> parameterStatus;
+	SQLULEN parametersProcessed = 0;
+
+	void executeBatch();
+	void resetParameterSet();
 };
 
 } /* namespace database */
@@ -20,6 +20,7 @@
 #include <odbc4esl/database/BindVariable.h>
 #include <odbc4esl/database/Driver.h>
 #include <odbc4esl/database/ResultSetBinding.h>
+#include <odbc4esl/database/StatementCache.h>
 
 #include <esl/Logger.h>
 
@@ -38,11 +39,20 @@ namespace {
 esl::Logger logger("odbc4esl::database::PreparedStatementBinding");
 }
 
-PreparedStatementBinding::PreparedStatementBinding(const Connection& aConnection, const std::string& aSql, std::size_t defaultBufferSize, std::size_t maximumBufferSize)
+PreparedStatementBinding::PreparedStatementBinding(const Connection& aConnection, const std::string& aSql, std::size_t defaultBufferSize, std::size_t maximumBufferSize, std::size_t aRowArraySize)
 : connection(aConnection),
   sql(aSql),
-  statementHandle(Driver::getDriver().prepare(connection, sql))
+  rowArraySize(aRowArraySize)
 {
+	StatementCache* statementCache = connection.getStatementCache();
+	if(statementCache == nullptr) {
+		statementHandle = Driver::getDriver().prepare(connection, sql);
+	}
+	else if(statementCache->prepare(sql, statementHandle, parameterColumns, resultColumns)) {
+		logger.trace << "Use cached description of SQL \"" << sql << "\"\n";
+		return;
+	}
+
 	// Get number of result columns from prepared statement
 	SQLSMALLINT resultColumnCount = Driver::getDriver().numResultCols(statementHandle);
 
@@ -226,6 +236,10 @@ PreparedStatementBinding::PreparedStatementBinding(const Connection& aConnection
 		parameterColumns.emplace_back("", parameterColumnType, parameterValueNullable, defaultBufferSize, maximumBufferSize, parameterValueDecimalDigits, parameterValueCharacterLength, parameterValueCharacterLength);
     }
 	logger.trace << "-----------------------------------------------\n\n";
+
+	if(statementCache) {
+		statementCache->setDescription(sql, parameterColumns, resultColumns);
+	}
 }
 
 const std::vector<esl::database::Column>& PreparedStatementBinding::getParameterColumns() const {
@@ -237,30 +251,61 @@ const std::vector<esl::database::Column>& PreparedStatementBinding::getResultCol
 }
 
 esl::database::ResultSet PreparedStatementBinding::execute(const std::vector<esl::database::Field>& parameterValues) {
+	std::vector<esl::io::Output> outputs;
+	return execute(parameterValues, outputs);
+}
+
+esl::database::ResultSet PreparedStatementBinding::execute(const std::vector<esl::database::Field>& parameterValues, std::vector<esl::io::Output>& outputs) {
 	if(!statementHandle) {
 		logger.trace << "RE-Create statement handle\n";
-		statementHandle = StatementHandle(Driver::getDriver().prepare(connection, sql));
+		statementHandle = connection.prepareODBC(sql);
 	}
 
 	if(parameterColumns.size() != parameterValues.size()) {
 	    throw esl::system::Stacktrace::add(std::runtime_error("Wrong number of arguments. Given " + std::to_string(parameterValues.size()) + " parameters but required " + std::to_string(parameterColumns.size()) + " parameters."));
 	}
 
+	if(!outputs.empty() && outputs.size() != parameterValues.size()) {
+	    throw esl::system::Stacktrace::add(std::runtime_error("Wrong number of outputs. Given " + std::to_string(outputs.size()) + " outputs but required " + std::to_string(parameterValues.size()) + " outputs."));
+	}
+
 	std::vector<std::unique_ptr<BindVariable>> parameterVariables(parameterValues.size());
 
 	for(std::size_t i=0; i<parameterValues.size(); ++i) {
 		parameterVariables[i].reset(new BindVariable(statementHandle, parameterColumns[i], i));
-		parameterVariables[i]->getField(parameterValues[i]);
+		if(!outputs.empty() && outputs[i]) {
+			parameterVariables[i]->getOutput(outputs[i]);
+		}
+		else {
+			parameterVariables[i]->getField(parameterValues[i]);
+		}
 	}
 
 	/* ResultSetBinding makes the "execute" */
-	Driver::getDriver().execute(statementHandle);
+	if(Driver::getDriver().execute(statementHandle)) {
+		/* send the data of parameters bound by getOutput in parts */
+		try {
+			for(SQLPOINTER token = Driver::getDriver().paramData(statementHandle); token != nullptr; token = Driver::getDriver().paramData(statementHandle)) {
+				static_cast<BindVariable*>(token)->putData();
+			}
+		}
+		catch(...) {
+			/* the statement still needs data, so cancel it before the handle goes back to the statement cache */
+			try {
+				Driver::getDriver().cancel(statementHandle);
+			}
+			catch(const std::exception& e) {
+				logger.warn << "Cancel of statement failed: " << e.what() << "\n";
+			}
+			throw;
+		}
+	}
 
 	esl::database::ResultSet resultSet;
 
 	/* make a fetch, if SQL statement has result set (e.g. no INSERT, UPDATE, DELETE) */
 	if(!resultColumns.empty()) {
-		std::unique_ptr<esl::database::ResultSet::Binding> resultSetBinding(new ResultSetBinding(std::move(statementHandle), resultColumns));
+		std::unique_ptr<esl::database::ResultSet::Binding> resultSetBinding(new ResultSetBinding(std::move(statementHandle), resultColumns, rowArraySize, connection.isGetDataOnRowArraysSupported()));
 
 		/* this makes a fetch */
 		resultSet = esl::database::ResultSet(std::unique_ptr<esl::database::ResultSet::Binding>(std::move(resultSetBinding)));
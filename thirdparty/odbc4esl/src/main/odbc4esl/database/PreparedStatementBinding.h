@@ -25,6 +25,7 @@
 #include <esl/database/PreparedStatement.h>
 #include <esl/database/Column.h>
 #include <esl/database/Field.h>
+#include <esl/io/Output.h>
 
 #include <string>
 #include <vector>
@@ -35,11 +36,12 @@ namespace database {
 
 class PreparedStatementBinding : public esl::database::PreparedStatement::Binding {
 public:
-	PreparedStatementBinding(const Connection& connection, const std::string& sql, std::size_t defaultBufferSize, std::size_t maximumBufferSize);
+	PreparedStatementBinding(const Connection& connection, const std::string& sql, std::size_t defaultBufferSize, std::size_t maximumBufferSize, std::size_t rowArraySize);
 
 	const std::vector<esl::database::Column>& getParameterColumns() const override;
 	const std::vector<esl::database::Column>& getResultColumns() const override;
 	esl::database::ResultSet execute(const std::vector<esl::database::Field>& fields) override;
+	esl::database::ResultSet execute(const std::vector<esl::database::Field>& fields, std::vector<esl::io::Output>& outputs) override;
 	void* getNativeHandle() const override;
 
 private:
@@ -48,6 +50,7 @@ private:
 	StatementHandle statementHandle;
 	std::vector<esl::database::Column> parameterColumns;
 	std::vector<esl::database::Column> resultColumns;
+	std::size_t rowArraySize;
 };
 
 } /* namespace database */
@@ -32,27 +32,64 @@ namespace database {
 
 namespace {
 esl::Logger logger("odbc4esl::database::ResultSetBinding");
+
+std::size_t getRowArraySize(const std::vector<esl::database::Column>& columns, std::size_t rowArraySize, bool hasGetDataOnRowArrays) {
+	if(rowArraySize <= 1) {
+		return 1;
+	}
+	if(!hasGetDataOnRowArrays) {
+		for(const auto& column : columns) {
+			if(BindResult::hasLongValues(column)) {
+				logger.debug << "Driver does not support SQLGetData on row arrays and column \"" << column.getName() << "\" might contain long values, use row array size 1 instead of " << rowArraySize << "\n";
+				return 1;
+			}
+		}
+	}
+	return rowArraySize;
+}
 }
 
-ResultSetBinding::ResultSetBinding(StatementHandle&& aStatementHandle, const std::vector<esl::database::Column>& resultColumns/*, const std::vector<esl::database::Column>& parameterColumns, const std::vector<esl::database::Field>& parameterFields*/)
+ResultSetBinding::ResultSetBinding(StatementHandle&& aStatementHandle, const std::vector<esl::database::Column>& resultColumns/*, const std::vector<esl::database::Column>& parameterColumns, const std::vector<esl::database::Field>& parameterFields*/, std::size_t aRowArraySize, bool hasGetDataOnRowArrays)
 : esl::database::ResultSet::Binding(resultColumns),
   statementHandle(std::move(aStatementHandle)),
-  bindResult(resultColumns.size())
+  bindResult(resultColumns.size()),
+  rowArraySize(getRowArraySize(resultColumns, aRowArraySize, hasGetDataOnRowArrays)),
+  rowStatus(rowArraySize, SQL_ROW_NOROW)
 {
+	Driver::getDriver().setStmtAttr(statementHandle, SQL_ATTR_ROW_BIND_TYPE, reinterpret_cast<SQLPOINTER>(SQL_BIND_BY_COLUMN), 0);
+	Driver::getDriver().setStmtAttr(statementHandle, SQL_ATTR_ROW_ARRAY_SIZE, reinterpret_cast<SQLPOINTER>(static_cast<SQLULEN>(rowArraySize)), 0);
+	Driver::getDriver().setStmtAttr(statementHandle, SQL_ATTR_ROW_STATUS_PTR, &rowStatus[0], 0);
+	Driver::getDriver().setStmtAttr(statementHandle, SQL_ATTR_ROWS_FETCHED_PTR, &rowsFetched, 0);
+
 	logger.trace << "Bind result variables\":\n";
 	logger.trace << "-----------------------------------------------\n";
 	for(std::size_t i=0; i<getColumns().size(); ++i) {
-		bindResult[i].reset(new BindResult(statementHandle, getColumns()[i], i));
+		bindResult[i].reset(new BindResult(statementHandle, getColumns()[i], i, rowArraySize));
 	}
 	logger.trace << "-----------------------------------------------\n\n";
 }
 
+ResultSetBinding::~ResultSetBinding() {
+	/* statement handle might be reused by the statement cache, so it must not point to our arrays anymore */
+	try {
+		Driver::getDriver().setStmtAttr(statementHandle, SQL_ATTR_ROW_STATUS_PTR, nullptr, 0);
+		Driver::getDriver().setStmtAttr(statementHandle, SQL_ATTR_ROWS_FETCHED_PTR, nullptr, 0);
+		Driver::getDriver().setStmtAttr(statementHandle, SQL_ATTR_ROW_ARRAY_SIZE, reinterpret_cast<SQLPOINTER>(static_cast<SQLULEN>(1)), 0);
+	}
+	catch(const std::exception& e) {
+		logger.warn << "Reset of row array attributes failed: " << e.what() << "\n";
+	}
+	catch(...) {
+		logger.warn << "Reset of row array attributes failed with unknown exception\n";
+	}
+}
+
 bool ResultSetBinding::fetch(std::vector<esl::database::Field>& fields) {
 	if(fields.size() != getColumns().size()) {
 		throw esl::system::Stacktrace::add(std::runtime_error("Called 'fetch' with wrong number of fields. Given " + std::to_string(fields.size()) + " fields, but it should be " + std::to_string(getColumns().size()) + " fields."));
 	}
 
-	if(Driver::getDriver().fetch(statementHandle) == false) {
+	if(nextRow() == false) {
 		return false;
 	}
 
@@ -121,13 +158,80 @@ bool ResultSetBinding::fetch(std::vector<esl::database::Field>& fields) {
 		}
 
 
-		bindResult[i]->setField(fields[i]);
+		setDeferred(i, bindResult[i]->setField(fields[i], currentRow) == false);
 	}
 	logger.trace << "-----------------------------------------------\n\n";
 
 	return true;
 }
 
+bool ResultSetBinding::fetchBatch(esl::database::ResultBatch& batch, std::size_t maxRows, std::vector<esl::database::Field>& fields) {
+	for(std::size_t i=0; i<getColumns().size(); ++i) {
+		batch[i].setStorage(bindResult[i]->getBatchStorage());
+		batch[i].reserve(maxRows);
+	}
+
+	/* currentRow is still the row of the last fetch */
+	for(std::size_t row = 0; row < maxRows; ++row) {
+		if(row > 0 && nextRow() == false) {
+			return false;
+		}
+
+		for(std::size_t i=0; i<getColumns().size(); ++i) {
+			bindResult[i]->addValue(batch[i], currentRow);
+		}
+	}
+
+	return true;
+}
+
+bool ResultSetBinding::nextRow() {
+	/* rowsFetched is 0 before the first fetch, so the first call fetches the first block */
+	while(true) {
+		if(rowsFetched > 0 && currentRow + 1 < rowsFetched) {
+			++currentRow;
+		}
+		else {
+			if(Driver::getDriver().fetchScroll(statementHandle, SQL_FETCH_NEXT, 0) == false) {
+				rowsFetched = 0;
+				return false;
+			}
+			logger.trace << "Fetched block of " << rowsFetched << " rows\n";
+			if(rowsFetched == 0) {
+				continue;
+			}
+			currentRow = 0;
+		}
+
+		switch(rowStatus[currentRow]) {
+		case SQL_ROW_NOROW:
+			continue;
+		case SQL_ROW_ERROR:
+			throw esl::system::Stacktrace::add(std::runtime_error("Fetching row " + std::to_string(currentRow) + " of block failed."));
+		default:
+			return true;
+		}
+	}
+}
+
+void ResultSetBinding::loadDeferred(std::size_t index, std::vector<esl::database::Field>& fields) {
+	/* drivers without SQL_GD_ANY_ORDER need SQLGetData calls in ascending order of the columns,
+	 * so deferred values of previous columns are loaded as well */
+	for(std::size_t i=0; i<=index && i<bindResult.size(); ++i) {
+		if(isDeferred(i)) {
+			bindResult[i]->loadField(fields[i], currentRow);
+			setDeferred(i, false);
+		}
+	}
+}
+
+esl::io::Output ResultSetBinding::getOutput(std::size_t index, const esl::database::Field& field) {
+	if(isDeferred(index)) {
+		return bindResult[index]->getOutput(currentRow);
+	}
+	return esl::database::ResultSet::Binding::getOutput(index, field);
+}
+
 bool ResultSetBinding::isEditable(std::size_t columnIndex) {
 	return false;
 }
@@ -26,7 +26,12 @@
 #include <esl/database/ResultSet.h>
 #include <esl/database/Column.h>
 #include <esl/database/Field.h>
+#include <esl/io/Output.h>
 
+#include <sqlext.h>
+
+#include <cstddef>
+#include <memory>
 #include <vector>
 
 namespace odbc4esl {
@@ -35,11 +40,19 @@ namespace database {
 
 class Environment;
 
+/* ResultSetBinding fetches rowArraySize rows with one SQLFetchScroll into column-wise bound arrays.
+ * fetch() returns the rows of this block before it fetches the next one.
+ * If the driver does not support SQLGetData on row arrays, a result set with a column
+ * whose values might exceed the bound element fetches one row at a time. */
 class ResultSetBinding : public esl::database::ResultSet::Binding {
 public:
-	ResultSetBinding(StatementHandle&& statementHandle, const std::vector<esl::database::Column>& resultColumns);
+	ResultSetBinding(StatementHandle&& statementHandle, const std::vector<esl::database::Column>& resultColumns, std::size_t rowArraySize, bool hasGetDataOnRowArrays);
+	~ResultSetBinding();
 
 	bool fetch(std::vector<esl::database::Field>& fields) override;
+	bool fetchBatch(esl::database::ResultBatch& batch, std::size_t maxRows, std::vector<esl::database::Field>& fields) override;
+	void loadDeferred(std::size_t index, std::vector<esl::database::Field>& fields) override;
+	esl::io::Output getOutput(std::size_t index, const esl::database::Field& field) override;
 	bool isEditable(std::size_t columnIndex) override;
 	void add(std::vector<esl::database::Field>& fields) override;
 	void save(std::vector<esl::database::Field>& fields) override;
@@ -47,6 +60,13 @@ public:
 private:
 	StatementHandle statementHandle;
 	std::vector<std::unique_ptr<BindResult>> bindResult;
+
+	const std::size_t rowArraySize;
+	std::vector<SQLUSMALLINT> rowStatus;
+	SQLULEN rowsFetched = 0;
+	std::size_t currentRow = 0;
+
+	bool nextRow();
 };
 
 } /* namespace database */
@@ -0,0 +1,184 @@
+/*
+ * This file is part of odbc4esl.
+ * Copyright (C) 2020-2023 Sven Lukas
+ *
+ * Odbc4esl is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Odbc4esl is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser Public License
+ * along with mhd4esl.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <odbc4esl/database/StatementCache.h>
+#include <odbc4esl/database/Connection.h>
+#include <odbc4esl/database/Driver.h>
+
+#include <esl/Logger.h>
+
+#include <utility>
+
+namespace odbc4esl {
+inline namespace v1_6 {
+namespace database {
+
+namespace {
+esl::Logger logger("odbc4esl::database::StatementCache");
+}
+
+StatementCache::StatementCache(const Connection& aConnection, std::size_t aCapacity, std::shared_ptr<Counters> aCounters)
+: connection(aConnection),
+  capacity(aCapacity),
+  counters(std::move(aCounters))
+{ }
+
+StatementCache::~StatementCache() {
+	clear();
+}
+
+bool StatementCache::prepare(const std::string& sql, StatementHandle& statementHandle, std::vector<esl::database::Column>& parameterColumns, std::vector<esl::database::Column>& resultColumns) {
+	bool isDescribed = false;
+	std::size_t preparedGeneration;
+
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+
+		auto iter = find(sql);
+		if(iter != entries.end() && iter->handle != SQL_NULL_HSTMT) {
+			++counters->hits;
+			statementHandle = StatementHandle(iter->handle, *this, sql, generation);
+			iter->handle = SQL_NULL_HSTMT;
+			parameterColumns = iter->parameterColumns;
+			resultColumns = iter->resultColumns;
+			return iter->isDescribed;
+		}
+
+		++counters->misses;
+		preparedGeneration = generation;
+
+		if(iter == entries.end()) {
+			insert(sql);
+		}
+		else if(iter->isDescribed) {
+			/* handle is in use by another prepared statement, but its description can be used */
+			isDescribed = true;
+			parameterColumns = iter->parameterColumns;
+			resultColumns = iter->resultColumns;
+		}
+	}
+
+	/* SQLPrepare without holding the lock */
+	statementHandle = StatementHandle(Driver::getDriver().prepare(connection, sql), *this, sql, preparedGeneration);
+	return isDescribed;
+}
+
+StatementHandle StatementCache::prepare(const std::string& sql) {
+	std::size_t preparedGeneration;
+
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+
+		auto iter = find(sql);
+		if(iter != entries.end() && iter->handle != SQL_NULL_HSTMT) {
+			++counters->hits;
+			StatementHandle statementHandle(iter->handle, *this, sql, generation);
+			iter->handle = SQL_NULL_HSTMT;
+			return statementHandle;
+		}
+
+		++counters->misses;
+		preparedGeneration = generation;
+
+		if(iter == entries.end()) {
+			insert(sql);
+		}
+	}
+
+	return StatementHandle(Driver::getDriver().prepare(connection, sql), *this, sql, preparedGeneration);
+}
+
+void StatementCache::setDescription(const std::string& sql, const std::vector<esl::database::Column>& parameterColumns, const std::vector<esl::database::Column>& resultColumns) {
+	std::lock_guard<std::mutex> lock(mutex);
+
+	auto iter = find(sql);
+	if(iter == entries.end()) {
+		iter = insert(sql);
+	}
+
+	iter->isDescribed = true;
+	iter->parameterColumns = parameterColumns;
+	iter->resultColumns = resultColumns;
+}
+
+void StatementCache::release(const std::string& sql, SQLHANDLE handle, std::size_t handleGeneration) {
+	/* close an open cursor and drop bindings of the last execution.
+	 * Don't throw, because this function is called by the destructor of StatementHandle. */
+	SQLFreeStmt(handle, SQL_CLOSE);
+	SQLFreeStmt(handle, SQL_UNBIND);
+	SQLFreeStmt(handle, SQL_RESET_PARAMS);
+
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+
+		/* a handle of an older generation has been in use while its prepared statement got deleted by clear() */
+		auto iter = entriesBySql.find(sql);
+		if(handleGeneration == generation && iter != entriesBySql.end() && iter->second->handle == SQL_NULL_HSTMT) {
+			iter->second->handle = handle;
+			return;
+		}
+	}
+
+	/* statement has been evicted or deleted in the meantime or there is already an idle handle for this SQL text */
+	logger.trace << "Free statement handle that cannot be cached\n";
+	SQLFreeHandle(SQL_HANDLE_STMT, handle);
+}
+
+void StatementCache::clear() {
+	std::lock_guard<std::mutex> lock(mutex);
+
+	++generation;
+
+	for(auto& entry : entries) {
+		if(entry.handle != SQL_NULL_HSTMT) {
+			SQLFreeHandle(SQL_HANDLE_STMT, entry.handle);
+			entry.handle = SQL_NULL_HSTMT;
+		}
+	}
+}
+
+std::list<StatementCache::Entry>::iterator StatementCache::find(const std::string& sql) {
+	auto iter = entriesBySql.find(sql);
+	if(iter == entriesBySql.end()) {
+		return entries.end();
+	}
+
+	entries.splice(entries.begin(), entries, iter->second);
+	return iter->second;
+}
+
+std::list<StatementCache::Entry>::iterator StatementCache::insert(const std::string& sql) {
+	entries.emplace_front();
+	entries.front().sql = sql;
+	entriesBySql[sql] = entries.begin();
+
+	while(entries.size() > capacity) {
+		Entry& entry = entries.back();
+		if(entry.handle != SQL_NULL_HSTMT) {
+			SQLFreeHandle(SQL_HANDLE_STMT, entry.handle);
+		}
+		entriesBySql.erase(entry.sql);
+		entries.pop_back();
+	}
+
+	return entries.begin();
+}
+
+} /* namespace database */
+} /* inline namespace v1_6 */
+} /* namespace odbc4esl */
@@ -0,0 +1,105 @@
+/*
+ * This file is part of odbc4esl.
+ * Copyright (C) 2020-2023 Sven Lukas
+ *
+ * Odbc4esl is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Odbc4esl is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser Public License
+ * along with mhd4esl.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef ODBC4ESL_DATABASE_STATEMENTCACHE_H_
+#define ODBC4ESL_DATABASE_STATEMENTCACHE_H_
+
+#include <odbc4esl/database/StatementHandle.h>
+
+#include <esl/database/Column.h>
+
+#include <sqlext.h>
+
+#include <atomic>
+#include <cstddef>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace odbc4esl {
+inline namespace v1_6 {
+namespace database {
+
+class Connection;
+
+/* LRU cache of prepared statement handles of a connection, keyed by SQL text.
+ * Besides the idle handle the cache keeps the described parameter and result columns of a statement,
+ * so SQLDescribeParam and SQLDescribeCol are called only once per SQL text as long as it stays in the cache.
+ * A statement handle returned by prepare() is given back to the cache when it gets destroyed. */
+class StatementCache {
+public:
+	struct Counters {
+		std::atomic<std::size_t> hits{0};
+		std::atomic<std::size_t> misses{0};
+	};
+
+	StatementCache(const Connection& connection, std::size_t capacity, std::shared_ptr<Counters> counters);
+	StatementCache(const StatementCache&) = delete;
+	~StatementCache();
+
+	StatementCache& operator=(const StatementCache&) = delete;
+
+	/* Returns a prepared statement handle for "sql".
+	 * If the statement has been described before, parameterColumns and resultColumns are set and true is returned. */
+	bool prepare(const std::string& sql, StatementHandle& statementHandle, std::vector<esl::database::Column>& parameterColumns, std::vector<esl::database::Column>& resultColumns);
+	StatementHandle prepare(const std::string& sql);
+
+	void setDescription(const std::string& sql, const std::vector<esl::database::Column>& parameterColumns, const std::vector<esl::database::Column>& resultColumns);
+
+	/* called by StatementHandle. A handle of an older generation than the current one is freed instead of cached. */
+	void release(const std::string& sql, SQLHANDLE handle, std::size_t handleGeneration);
+
+	/* frees all idle statement handles, e.g. if the driver deletes prepared statements on commit,
+	 * and starts a new generation, so handles that are in use now get freed when they are released */
+	void clear();
+
+private:
+	struct Entry {
+		std::string sql;
+
+		/* SQL_NULL_HSTMT if the handle is in use */
+		SQLHANDLE handle = SQL_NULL_HSTMT;
+
+		bool isDescribed = false;
+		std::vector<esl::database::Column> parameterColumns;
+		std::vector<esl::database::Column> resultColumns;
+	};
+
+	const Connection& connection;
+	const std::size_t capacity;
+	std::shared_ptr<Counters> counters;
+
+	std::mutex mutex;
+	std::size_t generation = 0;
+
+	/* most recently used entry first */
+	std::list<Entry> entries;
+	std::unordered_map<std::string, std::list<Entry>::iterator> entriesBySql;
+
+	std::list<Entry>::iterator find(const std::string& sql);
+	std::list<Entry>::iterator insert(const std::string& sql);
+};
+
+} /* namespace database */
+} /* inline namespace v1_6 */
+} /* namespace odbc4esl */
+
+#endif /* ODBC4ESL_DATABASE_STATEMENTCACHE_H_ */
@@ -18,6 +18,7 @@
 
 #include <odbc4esl/database/StatementHandle.h>
 #include <odbc4esl/database/Driver.h>
+#include <odbc4esl/database/StatementCache.h>
 
 #include <esl/Logger.h>
 
@@ -25,6 +26,8 @@
 #include <esl/system/Stacktrace.h>
 #include <esl/monitoring/Streams.h>
 
+#include <utility>
+
 namespace odbc4esl {
 inline namespace v1_6 {
 namespace database {
@@ -34,9 +37,13 @@ esl::Logger logger("odbc4esl::database::PreparedHandle");
 }
 
 StatementHandle::StatementHandle(StatementHandle&& other)
-: handle(other.handle)
+: handle(other.handle),
+  statementCache(other.statementCache),
+  sql(std::move(other.sql)),
+  generation(other.generation)
 {
 	other.handle = SQL_NULL_HSTMT;
+	other.statementCache = nullptr;
 	logger.trace << "Statement handle constructed (moved)\n";
 }
 
@@ -44,11 +51,56 @@ StatementHandle::StatementHandle(SQLHANDLE aHandle)
 : handle(aHandle)
 { }
 
+StatementHandle::StatementHandle(SQLHANDLE aHandle, StatementCache& aStatementCache, const std::string& aSql, std::size_t aGeneration)
+: handle(aHandle),
+  statementCache(&aStatementCache),
+  sql(aSql),
+  generation(aGeneration)
+{ }
+
+StatementHandle::StatementHandle(StatementHandle&& other, StatementCache& aStatementCache, const std::string& aSql, std::size_t aGeneration)
+: handle(other.handle),
+  statementCache(&aStatementCache),
+  sql(aSql),
+  generation(aGeneration)
+{
+	other.handle = SQL_NULL_HSTMT;
+	other.statementCache = nullptr;
+}
+
 StatementHandle::~StatementHandle() {
+	close();
+}
+
+StatementHandle& StatementHandle::operator=(StatementHandle&& other) {
+	if(this != &other) {
+		close();
+
+		handle = other.handle;
+		statementCache = other.statementCache;
+		sql = std::move(other.sql);
+		generation = other.generation;
+
+		other.handle = SQL_NULL_HSTMT;
+		other.statementCache = nullptr;
+		logger.trace << "Statement handle moved\n";
+	}
+	return *this;
+}
+
+void StatementHandle::close() {
 	if(handle == SQL_NULL_HSTMT) {
 		return;
 	}
 
+	if(statementCache) {
+		logger.trace << "Give statement handle back to cache\n";
+		statementCache->release(sql, handle, generation);
+		handle = SQL_NULL_HSTMT;
+		statementCache = nullptr;
+		return;
+	}
+
 	logger.trace << "Close statement handle\n";
 
 	esl::monitoring::Streams::Location location;
@@ -95,13 +147,6 @@ StatementHandle::~StatementHandle() {
 	handle = SQL_NULL_HSTMT;
 }
 
-StatementHandle& StatementHandle::operator=(StatementHandle&& other) {
-	handle = other.handle;
-	other.handle = SQL_NULL_HSTMT;
-	logger.trace << "Statement handle moved\n";
-	return *this;
-}
-
 StatementHandle::operator bool() const noexcept {
 	return handle != SQL_NULL_HSTMT;
 }
@@ -21,10 +21,15 @@
 
 #include <sqlext.h>
 
+#include <cstddef>
+#include <string>
+
 namespace odbc4esl {
 inline namespace v1_6 {
 namespace database {
 
+class StatementCache;
+
 class StatementHandle {
 public:
 	StatementHandle() = default;
@@ -32,6 +37,11 @@ public:
 	StatementHandle(StatementHandle&& statementHandle);
 	StatementHandle(SQLHANDLE handle);
 
+	/* handle is given back to statementCache on destruction instead of freeing it.
+	 * generation is the generation of statementCache the handle has been prepared in. */
+	StatementHandle(SQLHANDLE handle, StatementCache& statementCache, const std::string& sql, std::size_t generation);
+	StatementHandle(StatementHandle&& statementHandle, StatementCache& statementCache, const std::string& sql, std::size_t generation);
+
 	~StatementHandle();
 
 	StatementHandle& operator=(const StatementHandle&) = delete;
@@ -43,6 +53,13 @@ public:
 
 protected:
 	SQLHANDLE handle = SQL_NULL_HANDLE;
+
+private:
+	StatementCache* statementCache = nullptr;
+	std::string sql;
+	std::size_t generation = 0;
+
+	void close();
 };
 
 } /* namespace database */
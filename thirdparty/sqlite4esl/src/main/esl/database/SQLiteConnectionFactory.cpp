@@ -2,14 +2,30 @@
 
 #include <sqlite4esl/database/ConnectionFactory.h>
 
+#include <cctype>
 #include <stdexcept>
 
 namespace esl {
 inline namespace v1_6 {
 namespace database {
 
+namespace {
+std::string toUpper(std::string str) {
+	for(auto& c : str) {
+		c = static_cast<char>(std::toupper(static_cast<unsigned char>(c)));
+	}
+	return str;
+}
+}
+
 SQLiteConnectionFactory::Settings::Settings(const std::vector<std::pair<std::string, std::string>>& settings) {
 	bool hasTimeoutMS = false;
+	bool hasStatementCacheSize = false;
+	bool hasBulkBatchSize = false;
+	bool hasReadConnections = false;
+	bool hasMmapSize = false;
+	bool hasCacheSize = false;
+	bool hasBusyTimeoutMS = false;
 
 	for(const auto& setting : settings) {
 		if(setting.first == "URI") {
@@ -28,6 +44,72 @@ SQLiteConnectionFactory::Settings::Settings(const std::vector<std::pair<std::str
 			hasTimeoutMS = true;
 			timeoutMS = std::stoi(setting.second);
 		}
+		else if(setting.first == "statement-cache-size") {
+			if(hasStatementCacheSize) {
+				throw std::runtime_error("Multiple definition of parameter key \"" + setting.first + "\" at SQLiteConnectionFactory");
+			}
+			hasStatementCacheSize = true;
+			statementCacheSize = static_cast<std::size_t>(std::stoul(setting.second));
+		}
+		else if(setting.first == "bulk-batch-size") {
+			if(hasBulkBatchSize) {
+				throw std::runtime_error("Multiple definition of parameter key \"" + setting.first + "\" at SQLiteConnectionFactory");
+			}
+			hasBulkBatchSize = true;
+			bulkBatchSize = static_cast<std::size_t>(std::stoul(setting.second));
+			if(bulkBatchSize == 0) {
+				throw std::runtime_error("Invalid value \"" + setting.second + "\" for parameter key \"" + setting.first + "\" at SQLiteConnectionFactory");
+			}
+		}
+		else if(setting.first == "read-connections") {
+			if(hasReadConnections) {
+				throw std::runtime_error("Multiple definition of parameter key \"" + setting.first + "\" at SQLiteConnectionFactory");
+			}
+			hasReadConnections = true;
+			readConnections = static_cast<std::size_t>(std::stoul(setting.second));
+		}
+		else if(setting.first == "journal-mode") {
+			if(!journalMode.empty()) {
+				throw std::runtime_error("Multiple definition of parameter key \"" + setting.first + "\" at SQLiteConnectionFactory");
+			}
+			journalMode = toUpper(setting.second);
+			if(journalMode != "DELETE" && journalMode != "TRUNCATE" && journalMode != "PERSIST" && journalMode != "MEMORY" && journalMode != "WAL" && journalMode != "OFF") {
+				throw std::runtime_error("Invalid value \"" + setting.second + "\" for parameter key \"" + setting.first + "\" at SQLiteConnectionFactory");
+			}
+		}
+		else if(setting.first == "synchronous") {
+			if(!synchronous.empty()) {
+				throw std::runtime_error("Multiple definition of parameter key \"" + setting.first + "\" at SQLiteConnectionFactory");
+			}
+			synchronous = toUpper(setting.second);
+			if(synchronous != "OFF" && synchronous != "NORMAL" && synchronous != "FULL" && synchronous != "EXTRA") {
+				throw std::runtime_error("Invalid value \"" + setting.second + "\" for parameter key \"" + setting.first + "\" at SQLiteConnectionFactory");
+			}
+		}
+		else if(setting.first == "mmap-size") {
+			if(hasMmapSize) {
+				throw std::runtime_error("Multiple definition of parameter key \"" + setting.first + "\" at SQLiteConnectionFactory");
+			}
+			hasMmapSize = true;
+			mmapSize = static_cast<std::int64_t>(std::stoll(setting.second));
+		}
+		else if(setting.first == "cache-size") {
+			if(hasCacheSize) {
+				throw std::runtime_error("Multiple definition of parameter key \"" + setting.first + "\" at SQLiteConnectionFactory");
+			}
+			hasCacheSize = true;
+			cacheSize = static_cast<std::int64_t>(std::stoll(setting.second));
+		}
+		else if(setting.first == "busy-timeout") {
+			if(hasBusyTimeoutMS) {
+				throw std::runtime_error("Multiple definition of parameter key \"" + setting.first + "\" at SQLiteConnectionFactory");
+			}
+			hasBusyTimeoutMS = true;
+			busyTimeoutMS = std::stoi(setting.second);
+			if(busyTimeoutMS < 0) {
+				throw std::runtime_error("Invalid value \"" + setting.second + "\" for parameter key \"" + setting.first + "\" at SQLiteConnectionFactory");
+			}
+		}
 		else {
 			throw std::runtime_error("Key \"" + setting.first + "\" is unknown at SQLiteConnectionFactory");
 		}
@@ -54,6 +136,10 @@ std::unique_ptr<Connection> SQLiteConnectionFactory::createConnection() {
 	return connectionFactory->createConnection();
 }
 
+SQLiteConnectionFactory::Statistics SQLiteConnectionFactory::getStatistics() const {
+	return static_cast<const sqlite4esl::database::ConnectionFactory&>(*connectionFactory).getStatistics();
+}
+
 } /* namespace database */
 } /* inline namespace v1_6 */
 } /* namespace esl */
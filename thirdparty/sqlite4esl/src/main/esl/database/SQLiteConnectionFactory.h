@@ -4,6 +4,8 @@
 #include <esl/database/Connection.h>
 #include <esl/database/ConnectionFactory.h>
 
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <string>
 #include <utility>
@@ -20,6 +22,41 @@ public:
 
 		std::string uri;
 		int timeoutMS = 10000;
+
+		/* number of prepared statements cached for the database connection. 0 disables the cache. */
+		std::size_t statementCacheSize = 16;
+
+		/* number of rows a bulk statement executes in one transaction, if the connection is in autocommit mode. */
+		std::size_t bulkBatchSize = 1000;
+
+		/* number of additional read-only connections. 0 shares one connection for everything.
+		 * Otherwise each execution of a read-only statement outside of a transaction uses a free read connection
+		 * until its result set gets destroyed. If all read connections are in use, it runs on the single write connection
+		 * without waiting, like all other statements. This requires a database file, best with journal mode WAL. */
+		std::size_t readConnections = 0;
+
+		/* value of PRAGMA journal_mode, e.g. "WAL". Empty keeps the default of SQLite. */
+		std::string journalMode;
+
+		/* value of PRAGMA synchronous, e.g. "NORMAL". Empty keeps the default of SQLite. */
+		std::string synchronous;
+
+		/* value of PRAGMA mmap_size in bytes for each connection. A negative value keeps the default of SQLite. */
+		std::int64_t mmapSize = -1;
+
+		/* value of PRAGMA cache_size for each connection, pages if positive and KiB if negative. 0 keeps the default of SQLite. */
+		std::int64_t cacheSize = 0;
+
+		/* milliseconds a connection retries to get a lock of the database file. 0 fails immediately with SQLITE_BUSY. */
+		int busyTimeoutMS = 0;
+	};
+
+	struct Statistics {
+		std::size_t statementCacheHits = 0;
+		std::size_t statementCacheMisses = 0;
+
+		/* number of statement executions that used a read connection */
+		std::size_t readStatements = 0;
 	};
 
 	SQLiteConnectionFactory(const Settings& settings);
@@ -29,6 +66,8 @@ public:
 
     std::unique_ptr<Connection> createConnection() override;
 
+    Statistics getStatistics() const;
+
 private:
 	std::unique_ptr<ConnectionFactory> connectionFactory;
 };
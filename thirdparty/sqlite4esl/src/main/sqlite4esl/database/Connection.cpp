@@ -64,10 +64,26 @@ esl::database::PreparedStatement Connection::prepare(const std::string& sql) con
 }
 
 esl::database::PreparedBulkStatement Connection::prepareBulk(const std::string& sql) const {
-	return esl::database::PreparedBulkStatement(std::unique_ptr<esl::database::PreparedBulkStatement::Binding>(new PreparedBulkStatementBinding(*this, sql)));
+	return esl::database::PreparedBulkStatement(std::unique_ptr<esl::database::PreparedBulkStatement::Binding>(new PreparedBulkStatementBinding(*this, sql, connectionFactory.getBulkBatchSize())));
+}
+
+std::shared_ptr<ReadConnectionPool::ReadConnection> Connection::acquireReadConnection() const {
+	if(sqlite3_get_autocommit(const_cast<sqlite3*>(&connectionHandle)) == 0) {
+		return nullptr;
+	}
+	return connectionFactory.acquireReadConnection();
+}
+
+void Connection::addReadStatement() const {
+	connectionFactory.addReadStatement();
 }
 
 StatementHandle Connection::prepareSQLite(const std::string& sql) const {
+	StatementCache* statementCache = connectionFactory.getStatementCache();
+	if(statementCache) {
+		return statementCache->prepare(sql);
+	}
+
 	sqlite3_stmt* stmt = nullptr;
 	int rc = sqlite3_prepare_v2(const_cast<sqlite3*>(&connectionHandle), sql.c_str(), sql.length() + 1, &stmt, nullptr);
 	if(rc != SQLITE_OK) {
@@ -82,6 +98,10 @@ void Connection::commit() const {
 }
 
 void Connection::rollback() const {
+	// there is nothing to roll back if the connection is in autocommit mode, but "ROLLBACK;" would fail.
+	if(sqlite3_get_autocommit(const_cast<sqlite3*>(&connectionHandle)) != 0) {
+		return;
+	}
 	prepare("ROLLBACK;").execute();
 }
 
@@ -19,6 +19,7 @@
 #ifndef SQLITE4ESL_DATABASE_CONNECTION_H_
 #define SQLITE4ESL_DATABASE_CONNECTION_H_
 
+#include <sqlite4esl/database/ReadConnectionPool.h>
 #include <sqlite4esl/database/StatementHandle.h>
 
 #include <esl/database/Connection.h>
@@ -48,6 +49,13 @@ public:
 	esl::database::PreparedStatement prepare(const std::string& sql) const override;
 	esl::database::PreparedBulkStatement prepareBulk(const std::string& sql) const override;
 	StatementHandle prepareSQLite(const std::string& sql) const;
+
+	/* does not wait. Returns nullptr if there is no free read connection or if a transaction of this connection is open,
+	 * because the transaction must see its own changes. */
+	std::shared_ptr<ReadConnectionPool::ReadConnection> acquireReadConnection() const;
+
+	/* called by PreparedStatementBinding if a statement gets executed on a read connection */
+	void addReadStatement() const;
 	//esl::database::ResultSet getTable(const std::string& tableName);
 
 	void commit() const override;
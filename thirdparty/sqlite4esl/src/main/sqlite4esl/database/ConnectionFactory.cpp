@@ -24,9 +24,11 @@
 #include <esl/monitoring/Streams.h>
 #include <esl/system/Stacktrace.h>
 
+#include <cctype>
 #include <chrono>
 #include <stdexcept>
 #include <string>
+#include <vector>
 
 namespace sqlite4esl {
 inline namespace v1_6 {
@@ -44,6 +46,10 @@ ConnectionFactory::~ConnectionFactory() {
 	if(connectionHandle) {
 		std::lock_guard<std::timed_mutex> lock(timedMutex);
 
+		// finalize cached statements, otherwise sqlite3_close returns SQLITE_BUSY
+		statementCache.reset();
+		readConnectionPool.reset();
+
 		esl::monitoring::Streams::Location location;
 		location.file = __FILE__;
 		location.function = __func__;
@@ -101,27 +107,90 @@ const sqlite3& ConnectionFactory::getConnectionHandle() const {
 	return *connectionHandle;
 }
 
+StatementCache* ConnectionFactory::getStatementCache() const {
+	return statementCache.get();
+}
+
+std::size_t ConnectionFactory::getBulkBatchSize() const {
+	return settings.bulkBatchSize;
+}
+
+esl::database::SQLiteConnectionFactory::Statistics ConnectionFactory::getStatistics() const {
+	esl::database::SQLiteConnectionFactory::Statistics statistics;
+
+	if(statementCache) {
+		statistics.statementCacheHits = statementCache->getHits();
+		statistics.statementCacheMisses = statementCache->getMisses();
+	}
+
+	if(readConnectionPool) {
+		statistics.statementCacheHits += readConnectionPool->getStatementCacheHits();
+		statistics.statementCacheMisses += readConnectionPool->getStatementCacheMisses();
+	}
+	statistics.readStatements = readStatements;
+
+	return statistics;
+}
+
+std::shared_ptr<ReadConnectionPool::ReadConnection> ConnectionFactory::acquireReadConnection() {
+	if(!readConnectionPool) {
+		return nullptr;
+	}
+
+	std::shared_ptr<ReadConnectionPool::ReadConnection> readConnection = readConnectionPool->acquire();
+	if(!readConnection) {
+		logger.debug << "No read connection is free, using write connection\n";
+	}
+
+	return readConnection;
+}
+
+void ConnectionFactory::addReadStatement() {
+	++readStatements;
+}
+
 std::unique_ptr<esl::database::Connection> ConnectionFactory::createConnection() {
 	if(connectionHandle == nullptr) {
-		int rc = sqlite3_open_v2(settings.uri.c_str(), &connectionHandle, SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE | SQLITE_OPEN_URI | SQLITE_OPEN_NOMUTEX, nullptr);
-
-		if(connectionHandle == nullptr) {
-			throw esl::system::Stacktrace::add(std::runtime_error("SQLite is unable to allocate memory to open database \"" + settings.uri + "\""));
+		if(settings.readConnections > 0 && sqlite3_threadsafe() == 0) {
+			throw esl::system::Stacktrace::add(std::runtime_error("Read connections are not supported because SQLite has been compiled without thread safety"));
 		}
 
-		if(rc != SQLITE_OK) {
-			std::string message = "Can't open database \"" + settings.uri + "\": " + sqlite3_errmsg(connectionHandle);
-			sqlite3_close(connectionHandle);
+		/* the write connection is shared by all connections if there are read connections, so it needs the mutex of SQLite */
+		connectionHandle = openConnectionHandle(SQLITE_OPEN_READWRITE | SQLITE_OPEN_CREATE | (settings.readConnections > 0 ? SQLITE_OPEN_FULLMUTEX : SQLITE_OPEN_NOMUTEX));
 
-	        throw esl::system::Stacktrace::add(std::runtime_error(message));
-		}
+		try {
+			executePragmas(*connectionHandle, true);
 
-		rc = sqlite3_extended_result_codes(connectionHandle, 1);
-		if(rc != SQLITE_OK) {
-			std::string message = std::string("Can't enable extended result codes: ") + sqlite3_errmsg(connectionHandle);
+			if(settings.readConnections > 0) {
+				const char* filename = sqlite3_db_filename(connectionHandle, "main");
+				if(filename == nullptr || *filename == 0) {
+					throw esl::system::Stacktrace::add(std::runtime_error("Read connections are not supported for database \"" + settings.uri + "\" because it has no database file"));
+				}
+
+				std::vector<sqlite3*> readConnectionHandles;
+				try {
+					for(std::size_t i = 0; i < settings.readConnections; ++i) {
+						readConnectionHandles.push_back(openConnectionHandle(SQLITE_OPEN_READONLY | SQLITE_OPEN_NOMUTEX));
+						executePragmas(*readConnectionHandles.back(), false);
+					}
+				}
+				catch(...) {
+					for(auto readConnectionHandle : readConnectionHandles) {
+						sqlite3_close(readConnectionHandle);
+					}
+					throw;
+				}
+				readConnectionPool.reset(new ReadConnectionPool(readConnectionHandles, settings.statementCacheSize));
+			}
+		}
+		catch(...) {
 			sqlite3_close(connectionHandle);
+			connectionHandle = nullptr;
+			throw;
+		}
 
-	        throw esl::system::Stacktrace::add(std::runtime_error(message));
+		if(settings.statementCacheSize > 0) {
+			statementCache.reset(new StatementCache(*connectionHandle, settings.statementCacheSize));
 		}
 	}
 
@@ -134,6 +203,83 @@ std::unique_ptr<esl::database::Connection> ConnectionFactory::createConnection()
 	return std::unique_ptr<esl::database::Connection>(new Connection(*this, *connectionHandle));
 }
 
+sqlite3* ConnectionFactory::openConnectionHandle(int flags) const {
+	sqlite3* handle = nullptr;
+	int rc = sqlite3_open_v2(settings.uri.c_str(), &handle, flags | SQLITE_OPEN_URI, nullptr);
+
+	if(handle == nullptr) {
+		throw esl::system::Stacktrace::add(std::runtime_error("SQLite is unable to allocate memory to open database \"" + settings.uri + "\""));
+	}
+
+	if(rc != SQLITE_OK) {
+		std::string message = "Can't open database \"" + settings.uri + "\": " + sqlite3_errmsg(handle);
+		sqlite3_close(handle);
+
+        throw esl::system::Stacktrace::add(std::runtime_error(message));
+	}
+
+	rc = sqlite3_extended_result_codes(handle, 1);
+	if(rc != SQLITE_OK) {
+		std::string message = std::string("Can't enable extended result codes: ") + sqlite3_errmsg(handle);
+		sqlite3_close(handle);
+
+        throw esl::system::Stacktrace::add(std::runtime_error(message));
+	}
+
+	return handle;
+}
+
+void ConnectionFactory::executePragmas(sqlite3& handle, bool isWriteConnection) const {
+	if(settings.busyTimeoutMS > 0) {
+		sqlite3_busy_timeout(&handle, settings.busyTimeoutMS);
+	}
+
+	std::vector<std::string> pragmas;
+
+	/* journal mode is stored in the database file, so it is set by the write connection only */
+	if(isWriteConnection && !settings.journalMode.empty()) {
+		pragmas.push_back("PRAGMA journal_mode=" + settings.journalMode + ";");
+	}
+	if(isWriteConnection && !settings.synchronous.empty()) {
+		pragmas.push_back("PRAGMA synchronous=" + settings.synchronous + ";");
+	}
+	if(settings.mmapSize >= 0) {
+		pragmas.push_back("PRAGMA mmap_size=" + std::to_string(settings.mmapSize) + ";");
+	}
+	if(settings.cacheSize != 0) {
+		pragmas.push_back("PRAGMA cache_size=" + std::to_string(settings.cacheSize) + ";");
+	}
+
+	for(const auto& pragma : pragmas) {
+		sqlite3_stmt* stmt = nullptr;
+		int rc = sqlite3_prepare_v2(&handle, pragma.c_str(), pragma.length() + 1, &stmt, nullptr);
+		if(rc != SQLITE_OK) {
+	        throw esl::system::Stacktrace::add(std::runtime_error("Can't prepare \"" + pragma + "\": " + sqlite3_errmsg(&handle)));
+		}
+
+		rc = sqlite3_step(stmt);
+		std::string result;
+		if(rc == SQLITE_ROW && sqlite3_column_text(stmt, 0)) {
+			result = reinterpret_cast<const char*>(sqlite3_column_text(stmt, 0));
+		}
+		sqlite3_finalize(stmt);
+
+		if(rc != SQLITE_ROW && rc != SQLITE_DONE) {
+	        throw esl::system::Stacktrace::add(std::runtime_error("Can't execute \"" + pragma + "\": " + sqlite3_errstr(rc)));
+		}
+
+		/* SQLite returns the new journal mode, that is still the old one if it cannot be changed, e.g. WAL for in-memory databases */
+		if(pragma.compare(0, 20, "PRAGMA journal_mode=") == 0) {
+			for(auto& c : result) {
+				c = static_cast<char>(std::toupper(static_cast<unsigned char>(c)));
+			}
+			if(result != settings.journalMode) {
+		        throw esl::system::Stacktrace::add(std::runtime_error("Can't set journal mode " + settings.journalMode + " for database \"" + settings.uri + "\", journal mode is " + result));
+			}
+		}
+	}
+}
+
 void ConnectionFactory::doUnlock() {
 	if(sqlite3_threadsafe() == 0) {
 		timedMutex.unlock();
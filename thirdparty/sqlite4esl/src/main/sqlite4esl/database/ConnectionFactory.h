@@ -23,8 +23,12 @@
 #include <esl/database/ConnectionFactory.h>
 #include <esl/database/SQLiteConnectionFactory.h>
 
+#include <sqlite4esl/database/ReadConnectionPool.h>
+#include <sqlite4esl/database/StatementCache.h>
+
 #include <sqlite3.h>
 
+#include <atomic>
 #include <memory>
 #include <mutex>
 
@@ -41,6 +45,17 @@ public:
 
 	const sqlite3& getConnectionHandle() const;
 
+	/* returns nullptr if statement cache is disabled */
+	StatementCache* getStatementCache() const;
+	std::size_t getBulkBatchSize() const;
+	esl::database::SQLiteConnectionFactory::Statistics getStatistics() const;
+
+	/* does not wait. Returns nullptr if there are no read connections or if all of them are in use */
+	std::shared_ptr<ReadConnectionPool::ReadConnection> acquireReadConnection();
+
+	/* called by Connection if a statement gets executed on a read connection */
+	void addReadStatement();
+
 	std::unique_ptr<esl::database::Connection> createConnection() override;
 
 	void doUnlock();
@@ -50,6 +65,15 @@ private:
 	esl::database::SQLiteConnectionFactory::Settings settings;
 	std::timed_mutex timedMutex;
 	Connection* connection = nullptr;
+
+	/* must be destroyed before connectionHandle gets closed */
+	std::unique_ptr<StatementCache> statementCache;
+
+	std::unique_ptr<ReadConnectionPool> readConnectionPool;
+	std::atomic<std::size_t> readStatements { 0 };
+
+	sqlite3* openConnectionHandle(int flags) const;
+	void executePragmas(sqlite3& handle, bool isWriteConnection) const;
 };
 
 } /* namespace database */
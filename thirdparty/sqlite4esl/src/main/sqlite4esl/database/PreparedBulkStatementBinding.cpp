@@ -35,10 +35,11 @@ namespace {
 esl::Logger logger("sqlite4esl::database::PreparedBulkStatementBinding");
 }
 
-PreparedBulkStatementBinding::PreparedBulkStatementBinding(const Connection& aConnection, const std::string& aSql)
+PreparedBulkStatementBinding::PreparedBulkStatementBinding(const Connection& aConnection, const std::string& aSql, std::size_t aBatchSize)
 : connection(aConnection),
   sql(aSql),
-  statementHandle(connection.prepareSQLite(sql))
+  statementHandle(connection.prepareSQLite(sql)),
+  batchSize(aBatchSize > 0 ? aBatchSize : 1)
 {
 	std::size_t resultColumnsCount = statementHandle.columnCount();
 	if(resultColumnsCount > 0) {
@@ -54,6 +55,20 @@ PreparedBulkStatementBinding::PreparedBulkStatementBinding(const Connection& aCo
 }
 
 
+PreparedBulkStatementBinding::~PreparedBulkStatementBinding() {
+	if(isTransactionOpen()) {
+		try {
+			executeTransactionStatement("ROLLBACK;");
+		}
+		catch(const std::exception& e) {
+			logger.warn << "Rollback of bulk transaction failed: " << e.what() << "\n";
+		}
+		catch(...) {
+			logger.warn << "Rollback of bulk transaction failed with unknown exception\n";
+		}
+	}
+}
+
 const std::vector<esl::database::Column>& PreparedBulkStatementBinding::getParameterColumns() const {
 	return parameterColumns;
 }
@@ -68,6 +83,12 @@ void PreparedBulkStatementBinding::execute(const std::vector<esl::database::Fiel
 	    throw esl::system::Stacktrace::add(std::runtime_error("Wrong number of arguments. Given " + std::to_string(parameterValues.size()) + " parameters but required " + std::to_string(parameterColumns.size()) + " parameters."));
 	}
 
+	if(!hasTransaction && sqlite3_get_autocommit(const_cast<sqlite3*>(&connection.getConnectionHandle())) != 0) {
+		executeTransactionStatement("BEGIN;");
+		hasTransaction = true;
+	}
+
+	try {
 	for(std::size_t i=0; i<parameterValues.size(); ++i) {
 		logger.debug << "Bind parameter[" << i << "]\n";
 
@@ -142,6 +163,41 @@ void PreparedBulkStatementBinding::execute(const std::vector<esl::database::Fiel
 	}
 
 	statementHandle.reset();
+	}
+	catch(...) {
+		statementHandle.reset();
+		rowCount = 0;
+		bool rollback = isTransactionOpen();
+		hasTransaction = false;
+		if(rollback) {
+			executeTransactionStatement("ROLLBACK;");
+		}
+		throw;
+	}
+
+	++rowCount;
+	if(rowCount >= batchSize) {
+		flush();
+	}
+}
+
+void PreparedBulkStatementBinding::flush() {
+	rowCount = 0;
+	bool commit = isTransactionOpen();
+	hasTransaction = false;
+	if(commit) {
+		executeTransactionStatement("COMMIT;");
+	}
+}
+
+bool PreparedBulkStatementBinding::isTransactionOpen() const {
+	/* our transaction might have been ended already by Connection::commit() or rollback() */
+	return hasTransaction && sqlite3_get_autocommit(const_cast<sqlite3*>(&connection.getConnectionHandle())) == 0;
+}
+
+void PreparedBulkStatementBinding::executeTransactionStatement(const char* transactionSql) {
+	StatementHandle transactionStatementHandle = connection.prepareSQLite(transactionSql);
+	transactionStatementHandle.step();
 }
 
 void* PreparedBulkStatementBinding::getNativeHandle() const {
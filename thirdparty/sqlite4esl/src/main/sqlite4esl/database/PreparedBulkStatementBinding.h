@@ -26,6 +26,7 @@
 #include <esl/database/Column.h>
 #include <esl/database/Field.h>
 
+#include <cstddef>
 #include <string>
 #include <vector>
 
@@ -35,10 +36,16 @@ namespace database {
 
 class PreparedBulkStatementBinding : public esl::database::PreparedBulkStatement::Binding {
 public:
-	PreparedBulkStatementBinding(const Connection& connection, const std::string& sql);
+	PreparedBulkStatementBinding(const Connection& connection, const std::string& sql, std::size_t batchSize);
+	~PreparedBulkStatementBinding();
 
 	const std::vector<esl::database::Column>& getParameterColumns() const override;
+
+	/* If the connection is in autocommit mode, rows are executed in a transaction that is committed
+	 * after batchSize rows or by flush(). The transaction is rolled back if a row fails. */
 	void execute(const std::vector<esl::database::Field>& fields) override;
+	void flush() override;
+
 	void* getNativeHandle() const override;
 
 private:
@@ -46,6 +53,13 @@ private:
 	std::string sql;
 	StatementHandle statementHandle;
 	std::vector<esl::database::Column> parameterColumns;
+
+	const std::size_t batchSize;
+	std::size_t rowCount = 0;
+	bool hasTransaction = false;
+
+	bool isTransactionOpen() const;
+	void executeTransactionStatement(const char* sql);
 };
 
 } /* namespace database */
@@ -37,19 +37,33 @@ esl::Logger logger("sqlite4esl::database::PreparedStatementBinding");
 
 PreparedStatementBinding::PreparedStatementBinding(const Connection& aConnection, const std::string& aSql)
 : connection(aConnection),
-  sql(aSql),
-  statementHandle(connection.prepareSQLite(sql))
+  sql(aSql)
 {
+	std::shared_ptr<ReadConnectionPool::ReadConnection> readConnection = connection.acquireReadConnection();
+	if(readConnection) {
+		/* statement goes back to the statement cache of the read connection before the read connection gets released */
+		StatementHandle readStatementHandle = readConnection->prepare(sql);
+		isReadOnlyQuery = readStatementHandle.isReadOnlyQuery();
+		initializeColumns(readStatementHandle);
+	}
+	else {
+		statementHandle = connection.prepareSQLite(sql);
+		isReadOnlyQuery = statementHandle.isReadOnlyQuery();
+		initializeColumns(statementHandle);
+	}
+}
+
+void PreparedStatementBinding::initializeColumns(StatementHandle& aStatementHandle) {
 	// Get number of columns from prepared statement
-	std::size_t resultColumnsCount = statementHandle.columnCount();
+	std::size_t resultColumnsCount = aStatementHandle.columnCount();
 	for(std::size_t i=0; i<resultColumnsCount; ++i) {
-		std::string resultColumnName = statementHandle.columnName(i);
+		std::string resultColumnName = aStatementHandle.columnName(i);
 		esl::database::Column::Type resultColumnType = esl::database::Column::Type::sqlUnknown;
 
 		resultColumns.emplace_back(std::move(resultColumnName), resultColumnType, true, 0, 0, 0, 0, 0);
 	}
 
-	std::size_t parameterColumnsCount = statementHandle.bindParameterCount();
+	std::size_t parameterColumnsCount = aStatementHandle.bindParameterCount();
 	for(std::size_t i=0; i<parameterColumnsCount; ++i) {
 		esl::database::Column::Type parameterColumnType = esl::database::Column::Type::sqlUnknown;
 
@@ -66,20 +80,34 @@ const std::vector<esl::database::Column>& PreparedStatementBinding::getResultCol
 }
 
 esl::database::ResultSet PreparedStatementBinding::execute(const std::vector<esl::database::Field>& parameterValues) {
+	if(parameterColumns.size() != parameterValues.size()) {
+	    throw esl::system::Stacktrace::add(std::runtime_error("Wrong number of arguments. Given " + std::to_string(parameterValues.size()) + " parameters but required " + std::to_string(parameterColumns.size()) + " parameters."));
+	}
+
+	if(isReadOnlyQuery) {
+		std::shared_ptr<ReadConnectionPool::ReadConnection> readConnection = connection.acquireReadConnection();
+		if(readConnection) {
+			/* must be destroyed before readConnection, if it is not moved to the result set */
+			StatementHandle readStatementHandle = readConnection->prepare(sql);
+			connection.addReadStatement();
+			return execute(readStatementHandle, readConnection, parameterValues);
+		}
+	}
+
 	if(!statementHandle) {
 		logger.trace << "RE-Create statement handle\n";
 		statementHandle = connection.prepareSQLite(sql);
 	}
 
-	if(parameterColumns.size() != parameterValues.size()) {
-	    throw esl::system::Stacktrace::add(std::runtime_error("Wrong number of arguments. Given " + std::to_string(parameterValues.size()) + " parameters but required " + std::to_string(parameterColumns.size()) + " parameters."));
-	}
+	return execute(statementHandle, nullptr, parameterValues);
+}
 
+esl::database::ResultSet PreparedStatementBinding::execute(StatementHandle& aStatementHandle, const std::shared_ptr<ReadConnectionPool::ReadConnection>& aReadConnection, const std::vector<esl::database::Field>& parameterValues) {
 	for(std::size_t i=0; i<parameterValues.size(); ++i) {
 		logger.debug << "Bind parameter[" << i << "]\n";
 
 		if(parameterValues[i].isNull()) {
-			statementHandle.bindNull(i);
+			aStatementHandle.bindNull(i);
 		}
 		else {
 			switch(parameterColumns[i].getType()) {
@@ -89,7 +117,7 @@ esl::database::ResultSet PreparedStatementBinding::execute(const std::vector<esl
 			case esl::database::Column::Type::sqlInteger:
 			case esl::database::Column::Type::sqlSmallInt:
 				logger.debug << "  USE field.asInteger\n";
-				statementHandle.bindInteger(i, parameterValues[i].asInteger());
+				aStatementHandle.bindInteger(i, parameterValues[i].asInteger());
 				break;
 
 			case esl::database::Column::Type::sqlDouble:
@@ -98,7 +126,7 @@ esl::database::ResultSet PreparedStatementBinding::execute(const std::vector<esl
 			case esl::database::Column::Type::sqlFloat:
 			case esl::database::Column::Type::sqlReal:
 				logger.debug << "  USE field.asDouble\n";
-				statementHandle.bindDouble(i, parameterValues[i].asDouble());
+				aStatementHandle.bindDouble(i, parameterValues[i].asDouble());
 				break;
 
 			case esl::database::Column::Type::sqlVarChar:
@@ -108,7 +136,7 @@ esl::database::ResultSet PreparedStatementBinding::execute(const std::vector<esl
 			case esl::database::Column::Type::sqlTime:
 			case esl::database::Column::Type::sqlTimestamp:
 				logger.debug << "  USE field.asString\n";
-				statementHandle.bindText(i, parameterValues[i].asString());
+				aStatementHandle.bindText(i, parameterValues[i].asString());
 				break;
 		/* ******************************** *
 		 * END: THIS WILL NEVER BE THE CASE *
@@ -120,21 +148,21 @@ esl::database::ResultSet PreparedStatementBinding::execute(const std::vector<esl
 				case esl::database::Field::Type::storageBoolean:
 				case esl::database::Field::Type::storageInteger:
 					logger.debug << "  USE field.asInteger\n";
-					statementHandle.bindInteger(i, parameterValues[i].asInteger());
+					aStatementHandle.bindInteger(i, parameterValues[i].asInteger());
 					break;
 
 				case esl::database::Field::Type::storageDouble:
 					logger.debug << "  USE field.asDouble\n";
-					statementHandle.bindDouble(i, parameterValues[i].asDouble());
+					aStatementHandle.bindDouble(i, parameterValues[i].asDouble());
 					break;
 
 				case esl::database::Field::Type::storageString:
 					logger.debug << "  USE field.asString \"" << parameterValues[i].asString() << "\"\n";
-					statementHandle.bindText(i, parameterValues[i].asString());
+					aStatementHandle.bindText(i, parameterValues[i].asString());
 					break;
 
 				case esl::database::Field::Type::storageEmpty:
-					statementHandle.bindNull(i);
+					aStatementHandle.bindNull(i);
 					break;
 				}
 
@@ -147,13 +175,13 @@ esl::database::ResultSet PreparedStatementBinding::execute(const std::vector<esl
 
 	/* ResultSetBinding makes the "execute" */
 	/* make a fetch and check, if there is a row available (e.g. no INSERT, UPDATE, DELETE) */
-	if(statementHandle.step()) {
-		std::unique_ptr<esl::database::ResultSet::Binding> resultSetBinding(new ResultSetBinding(std::move(statementHandle), resultColumns));
+	if(aStatementHandle.step()) {
+		std::unique_ptr<esl::database::ResultSet::Binding> resultSetBinding(new ResultSetBinding(std::move(aStatementHandle), resultColumns, aReadConnection));
 
 		resultSet = esl::database::ResultSet(std::unique_ptr<esl::database::ResultSet::Binding>(std::move(resultSetBinding)));
 	}
 	else {
-		statementHandle.reset();
+		aStatementHandle.reset();
 	}
 
 	return resultSet;
@@ -20,6 +20,7 @@
 #define SQLITE4ESL_DATABASE_PREPAREDSTATEMENTBINDING_H_
 
 #include <sqlite4esl/database/Connection.h>
+#include <sqlite4esl/database/ReadConnectionPool.h>
 #include <sqlite4esl/database/StatementHandle.h>
 
 #include <esl/database/Column.h>
@@ -27,6 +28,7 @@
 #include <esl/database/ResultSet.h>
 #include <esl/database/PreparedStatement.h>
 
+#include <memory>
 #include <string>
 #include <vector>
 
@@ -47,9 +49,18 @@ public:
 private:
 	const Connection& connection;
 	std::string sql;
+
+	/* A read-only statement leases a read connection for each execution and gives it back with the result set.
+	 * No read connection is held between executions, so many prepared statements can share a few read connections. */
+	bool isReadOnlyQuery = false;
+
+	/* prepared on the write connection, empty as long as the statement has been executed on read connections only */
 	StatementHandle statementHandle;
 	std::vector<esl::database::Column> parameterColumns;
 	std::vector<esl::database::Column> resultColumns;
+
+	void initializeColumns(StatementHandle& aStatementHandle);
+	esl::database::ResultSet execute(StatementHandle& aStatementHandle, const std::shared_ptr<ReadConnectionPool::ReadConnection>& aReadConnection, const std::vector<esl::database::Field>& fields);
 };
 
 } /* namespace database */
@@ -0,0 +1,124 @@
+/*
+ * This file is part of sqlite4esl.
+ * Copyright (C) 2020-2023 Sven Lukas
+ *
+ * Sqlite4esl is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sqlite4esl is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser Public License
+ * along with mhd4esl.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <sqlite4esl/database/ReadConnectionPool.h>
+
+#include <esl/Logger.h>
+#include <esl/system/Stacktrace.h>
+
+#include <stdexcept>
+
+namespace sqlite4esl {
+inline namespace v1_6 {
+namespace database {
+
+namespace {
+esl::Logger logger("sqlite4esl::database::ReadConnectionPool");
+}
+
+ReadConnectionPool::ReadConnection::ReadConnection(sqlite3& aConnectionHandle, std::size_t statementCacheSize)
+: connectionHandle(aConnectionHandle)
+{
+	if(statementCacheSize > 0) {
+		statementCache.reset(new StatementCache(connectionHandle, statementCacheSize));
+	}
+}
+
+ReadConnectionPool::ReadConnection::~ReadConnection() {
+	// finalize cached statements, otherwise sqlite3_close returns SQLITE_BUSY
+	statementCache.reset();
+
+	int rc = sqlite3_close(&connectionHandle);
+	if(rc != SQLITE_OK) {
+		logger.warn << "sqlite3_close(...) of read connection returned " << rc << ": " << sqlite3_errstr(rc) << "\n";
+		sqlite3_close_v2(&connectionHandle);
+	}
+}
+
+sqlite3& ReadConnectionPool::ReadConnection::getConnectionHandle() const {
+	return connectionHandle;
+}
+
+StatementCache* ReadConnectionPool::ReadConnection::getStatementCache() const {
+	return statementCache.get();
+}
+
+StatementHandle ReadConnectionPool::ReadConnection::prepare(const std::string& sql) const {
+	if(statementCache) {
+		return statementCache->prepare(sql);
+	}
+
+	sqlite3_stmt* stmt = nullptr;
+	int rc = sqlite3_prepare_v2(&connectionHandle, sql.c_str(), sql.length() + 1, &stmt, nullptr);
+	if(rc != SQLITE_OK) {
+        throw esl::system::Stacktrace::add(std::runtime_error(std::string("Can't prepare SQL statement \"" + sql + "\": ") + sqlite3_errstr(rc)));
+	}
+
+	return StatementHandle(*stmt);
+}
+
+ReadConnectionPool::ReadConnectionPool(const std::vector<sqlite3*>& connectionHandles, std::size_t statementCacheSize) {
+	for(auto connectionHandle : connectionHandles) {
+		readConnections.emplace_back(new ReadConnection(*connectionHandle, statementCacheSize));
+		freeReadConnections.push_back(readConnections.back().get());
+	}
+}
+
+std::shared_ptr<ReadConnectionPool::ReadConnection> ReadConnectionPool::acquire() {
+	std::lock_guard<std::mutex> lock(mutex);
+
+	if(freeReadConnections.empty()) {
+		return nullptr;
+	}
+
+	ReadConnection* readConnection = freeReadConnections.back();
+	freeReadConnections.pop_back();
+
+	return std::shared_ptr<ReadConnection>(readConnection, [this](ReadConnection* readConnection) {
+		release(*readConnection);
+	});
+}
+
+std::size_t ReadConnectionPool::getStatementCacheHits() const {
+	std::size_t hits = 0;
+	for(const auto& readConnection : readConnections) {
+		if(readConnection->getStatementCache()) {
+			hits += readConnection->getStatementCache()->getHits();
+		}
+	}
+	return hits;
+}
+
+std::size_t ReadConnectionPool::getStatementCacheMisses() const {
+	std::size_t misses = 0;
+	for(const auto& readConnection : readConnections) {
+		if(readConnection->getStatementCache()) {
+			misses += readConnection->getStatementCache()->getMisses();
+		}
+	}
+	return misses;
+}
+
+void ReadConnectionPool::release(ReadConnection& readConnection) {
+	std::lock_guard<std::mutex> lock(mutex);
+	freeReadConnections.push_back(&readConnection);
+}
+
+} /* namespace database */
+} /* inline namespace v1_6 */
+} /* namespace sqlite4esl */
@@ -0,0 +1,89 @@
+/*
+ * This file is part of sqlite4esl.
+ * Copyright (C) 2020-2023 Sven Lukas
+ *
+ * Sqlite4esl is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sqlite4esl is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser Public License
+ * along with mhd4esl.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef SQLITE4ESL_DATABASE_READCONNECTIONPOOL_H_
+#define SQLITE4ESL_DATABASE_READCONNECTIONPOOL_H_
+
+#include <sqlite4esl/database/StatementCache.h>
+#include <sqlite4esl/database/StatementHandle.h>
+
+#include <sqlite3.h>
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <vector>
+
+namespace sqlite4esl {
+inline namespace v1_6 {
+namespace database {
+
+/* Pool of read-only database connections. A read connection is used exclusively by one execution of a
+ * prepared statement and its result set at a time, so they can be opened without the mutex of SQLite. */
+class ReadConnectionPool {
+public:
+	class ReadConnection {
+	public:
+		ReadConnection(sqlite3& connectionHandle, std::size_t statementCacheSize);
+		ReadConnection(const ReadConnection&) = delete;
+		~ReadConnection();
+
+		ReadConnection& operator=(const ReadConnection&) = delete;
+
+		sqlite3& getConnectionHandle() const;
+
+		/* returns nullptr if statement cache is disabled */
+		StatementCache* getStatementCache() const;
+
+		StatementHandle prepare(const std::string& sql) const;
+
+	private:
+		sqlite3& connectionHandle;
+
+		/* must be destroyed before connectionHandle gets closed */
+		std::unique_ptr<StatementCache> statementCache;
+	};
+
+	/* takes ownership of the connection handles */
+	ReadConnectionPool(const std::vector<sqlite3*>& connectionHandles, std::size_t statementCacheSize);
+	ReadConnectionPool(const ReadConnectionPool&) = delete;
+
+	ReadConnectionPool& operator=(const ReadConnectionPool&) = delete;
+
+	/* does not wait. Returns nullptr if there is no free read connection at the moment.
+	 * The read connection is given back to the pool when the last copy of the returned pointer gets destroyed. */
+	std::shared_ptr<ReadConnection> acquire();
+
+	std::size_t getStatementCacheHits() const;
+	std::size_t getStatementCacheMisses() const;
+
+private:
+	std::vector<std::unique_ptr<ReadConnection>> readConnections;
+
+	std::mutex mutex;
+	std::vector<ReadConnection*> freeReadConnections;
+
+	void release(ReadConnection& readConnection);
+};
+
+} /* namespace database */
+} /* inline namespace v1_6 */
+} /* namespace sqlite4esl */
+
+#endif /* SQLITE4ESL_DATABASE_READCONNECTIONPOOL_H_ */
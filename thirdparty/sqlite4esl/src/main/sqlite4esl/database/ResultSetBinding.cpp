@@ -22,6 +22,7 @@
 
 #include <esl/system/Stacktrace.h>
 
+#include <cctype>
 #include <stdexcept>
 
 namespace sqlite4esl {
@@ -29,11 +30,12 @@ inline namespace v1_6 {
 namespace database {
 
 namespace {
-esl::Logger logger("sqlite4esl::database::ResultSetBinding");
+esl::BinaryLogger logger("sqlite4esl::database::ResultSetBinding");
 }
 
-ResultSetBinding::ResultSetBinding(StatementHandle&& aStatementHandle, const std::vector<esl::database::Column>& resultColumns)
+ResultSetBinding::ResultSetBinding(StatementHandle&& aStatementHandle, const std::vector<esl::database::Column>& resultColumns, std::shared_ptr<ReadConnectionPool::ReadConnection> aReadConnection)
 : esl::database::ResultSet::Binding(resultColumns),
+  readConnection(std::move(aReadConnection)),
   statementHandle(std::move(aStatementHandle))
 { }
 
@@ -59,9 +61,9 @@ bool ResultSetBinding::fetch(std::vector<esl::database::Field>& fields) {
 		switch(statementHandle.columnType(i)) {
 		case esl::database::Column::Type::sqlInteger:
 		case esl::database::Column::Type::sqlSmallInt:
-			logger.debug << "Set integer\n";
+			ESL__LOGGER_DEBUG("Set integer of column ", i, "\n");
 			fields[i] = statementHandle.columnInteger(i);
-			logger.debug << "Set integer done\n";
+			ESL__LOGGER_DEBUG("Set integer done\n");
 			break;
 
 		case esl::database::Column::Type::sqlDouble:
@@ -69,24 +71,106 @@ bool ResultSetBinding::fetch(std::vector<esl::database::Field>& fields) {
 		case esl::database::Column::Type::sqlDecimal:
 		case esl::database::Column::Type::sqlFloat:
 		case esl::database::Column::Type::sqlReal:
-			logger.debug << "Set double\n";
+			ESL__LOGGER_DEBUG("Set double of column ", i, "\n");
 			fields[i] = statementHandle.columnDouble(i);
-			logger.debug << "Set double done\n";
+			ESL__LOGGER_DEBUG("Set double done\n");
 			break;
 
 		case esl::database::Column::Type::sqlVarChar:
 		case esl::database::Column::Type::sqlChar:
-		default:
-			logger.debug << "Set string\n";
-			fields[i] = statementHandle.columnText(i);
-			logger.debug << "Set string done\n";
+		default: {
+			ESL__LOGGER_DEBUG("Set string of column ", i, "\n");
+			/* the field refers to the buffer of SQLite that is valid until the next step */
+			std::size_t size;
+			const char* data = statementHandle.columnValueIsBlob(i) ? statementHandle.columnBlob(i, size) : statementHandle.columnText(i, size);
+			if(fields[i].getSimpleType() == esl::database::Field::Type::storageString) {
+				fields[i].setView(std::string_view(data, size));
+			}
+			else {
+				fields[i] = std::string_view(data, size);
+			}
+			ESL__LOGGER_DEBUG("Set string done\n");
 			break;
 		}
+		}
 	}
 
 	return true;
 }
 
+bool ResultSetBinding::fetchBatch(esl::database::ResultBatch& batch, std::size_t maxRows, std::vector<esl::database::Field>&) {
+	if(batchStorages.empty()) {
+		for(std::size_t i=0; i<getColumns().size(); ++i) {
+			batchStorages.push_back(getBatchStorage(i));
+		}
+	}
+
+	for(std::size_t i=0; i<getColumns().size(); ++i) {
+		batch[i].setStorage(batchStorages[i]);
+		batch[i].reserve(maxRows);
+	}
+
+	/* the statement is still positioned on the row of the last fetch */
+	for(std::size_t row = 0; row < maxRows; ++row) {
+		if(row > 0 && !statementHandle.step()) {
+			return false;
+		}
+
+		for(std::size_t i=0; i<getColumns().size(); ++i) {
+			esl::database::ResultBatch::Array& array = batch[i];
+			if(statementHandle.columnValueIsNull(i)) {
+				array.addNull();
+				continue;
+			}
+
+			switch(batchStorages[i]) {
+			case esl::database::ResultBatch::Storage::integer:
+				array.addInteger(statementHandle.columnInteger(i));
+				break;
+			case esl::database::ResultBatch::Storage::real:
+				array.addDouble(statementHandle.columnDouble(i));
+				break;
+			case esl::database::ResultBatch::Storage::string: {
+				std::size_t size;
+				const char* data = statementHandle.columnText(i, size);
+				array.addString(data, size);
+				break;
+			}
+			}
+		}
+	}
+
+	return true;
+}
+
+esl::database::ResultBatch::Storage ResultSetBinding::getBatchStorage(std::size_t index) const {
+	/* use the type affinity of the declared type (https://www.sqlite.org/datatype3.html) */
+	std::string declType = statementHandle.columnDeclType(index);
+	for(auto& c : declType) {
+		c = static_cast<char>(std::toupper(static_cast<unsigned char>(c)));
+	}
+	if(declType.find("INT") != std::string::npos) {
+		return esl::database::ResultBatch::Storage::integer;
+	}
+	if(declType.find("CHAR") != std::string::npos || declType.find("CLOB") != std::string::npos || declType.find("TEXT") != std::string::npos) {
+		return esl::database::ResultBatch::Storage::string;
+	}
+	if(declType.find("REAL") != std::string::npos || declType.find("FLOA") != std::string::npos || declType.find("DOUB") != std::string::npos) {
+		return esl::database::ResultBatch::Storage::real;
+	}
+
+	/* expressions have no declared type, so use the type of the current value */
+	switch(statementHandle.columnType(index)) {
+	case esl::database::Column::Type::sqlInteger:
+		return esl::database::ResultBatch::Storage::integer;
+	case esl::database::Column::Type::sqlDouble:
+		return esl::database::ResultBatch::Storage::real;
+	default:
+		break;
+	}
+	return esl::database::ResultBatch::Storage::string;
+}
+
 bool ResultSetBinding::isEditable(std::size_t columnIndex) {
 	return false;
 }
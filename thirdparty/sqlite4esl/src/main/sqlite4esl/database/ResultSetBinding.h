@@ -19,12 +19,14 @@
 #ifndef SQLITE4ESL_DATABASE_RESULTSETBINDING_H_
 #define SQLITE4ESL_DATABASE_RESULTSETBINDING_H_
 
+#include <sqlite4esl/database/ReadConnectionPool.h>
 #include <sqlite4esl/database/StatementHandle.h>
 
 #include <esl/database/ResultSet.h>
 #include <esl/database/Column.h>
 #include <esl/database/Field.h>
 
+#include <memory>
 #include <vector>
 
 namespace sqlite4esl {
@@ -35,16 +37,25 @@ class Environment;
 
 class ResultSetBinding : public esl::database::ResultSet::Binding {
 public:
-	ResultSetBinding(StatementHandle&& statementHandle, const std::vector<esl::database::Column>& resultColumns);
+	/* readConnection is kept until the result set gets destroyed, if the statement has been prepared on a read connection */
+	ResultSetBinding(StatementHandle&& statementHandle, const std::vector<esl::database::Column>& resultColumns, std::shared_ptr<ReadConnectionPool::ReadConnection> readConnection = nullptr);
 
 	bool fetch(std::vector<esl::database::Field>& fields) override;
+	bool fetchBatch(esl::database::ResultBatch& batch, std::size_t maxRows, std::vector<esl::database::Field>& fields) override;
 	bool isEditable(std::size_t columnIndex) override;
 	void add(std::vector<esl::database::Field>& fields) override;
 	void save(std::vector<esl::database::Field>& fields) override;
 
 private:
+	/* must be destroyed after statementHandle */
+	std::shared_ptr<ReadConnectionPool::ReadConnection> readConnection;
 	StatementHandle statementHandle;
 	bool isFirstFetch = true;
+
+	/* storage of each column in a ResultBatch. It is determined by the first call of fetchBatch */
+	std::vector<esl::database::ResultBatch::Storage> batchStorages;
+
+	esl::database::ResultBatch::Storage getBatchStorage(std::size_t index) const;
 };
 
 } /* namespace database */
@@ -0,0 +1,113 @@
+/*
+ * This file is part of sqlite4esl.
+ * Copyright (C) 2020-2023 Sven Lukas
+ *
+ * Sqlite4esl is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sqlite4esl is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser Public License
+ * along with mhd4esl.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#include <sqlite4esl/database/StatementCache.h>
+
+#include <esl/Logger.h>
+#include <esl/system/Stacktrace.h>
+
+#include <stdexcept>
+
+namespace sqlite4esl {
+inline namespace v1_6 {
+namespace database {
+
+namespace {
+esl::Logger logger("sqlite4esl::database::StatementCache");
+}
+
+StatementCache::StatementCache(sqlite3& aConnectionHandle, std::size_t aCapacity)
+: connectionHandle(aConnectionHandle),
+  capacity(aCapacity)
+{ }
+
+StatementCache::~StatementCache() {
+	for(auto& statement : statements) {
+		sqlite3_finalize(statement.second);
+	}
+}
+
+StatementHandle StatementCache::prepare(const std::string& sql) {
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+
+		auto iter = statementsBySql.find(sql);
+		if(iter != statementsBySql.end()) {
+			++hits;
+			sqlite3_stmt* stmt = iter->second->second;
+			statements.erase(iter->second);
+			statementsBySql.erase(iter);
+			return StatementHandle(*stmt, *this, sql);
+		}
+
+		++misses;
+	}
+
+	sqlite3_stmt* stmt = nullptr;
+	int rc = sqlite3_prepare_v2(&connectionHandle, sql.c_str(), sql.length() + 1, &stmt, nullptr);
+	if(rc != SQLITE_OK) {
+        throw esl::system::Stacktrace::add(std::runtime_error(std::string("Can't prepare SQL statement \"" + sql + "\": ") + sqlite3_errstr(rc)));
+	}
+
+	return StatementHandle(*stmt, *this, sql);
+}
+
+void StatementCache::release(const std::string& sql, sqlite3_stmt& handle) {
+	/* result of sqlite3_reset is the result of the last step and not of interest here */
+	sqlite3_reset(&handle);
+	sqlite3_clear_bindings(&handle);
+
+	sqlite3_stmt* evicted = &handle;
+	{
+		std::lock_guard<std::mutex> lock(mutex);
+
+		/* keep only one idle statement per SQL text */
+		if(statementsBySql.find(sql) == statementsBySql.end()) {
+			statements.emplace_front(sql, &handle);
+			statementsBySql[sql] = statements.begin();
+
+			if(statements.size() > capacity) {
+				evicted = statements.back().second;
+				statementsBySql.erase(statements.back().first);
+				statements.pop_back();
+			}
+			else {
+				evicted = nullptr;
+			}
+		}
+	}
+
+	if(evicted) {
+		logger.trace << "Finalize statement that cannot be cached\n";
+		sqlite3_finalize(evicted);
+	}
+}
+
+std::size_t StatementCache::getHits() const {
+	std::lock_guard<std::mutex> lock(mutex);
+	return hits;
+}
+
+std::size_t StatementCache::getMisses() const {
+	std::lock_guard<std::mutex> lock(mutex);
+	return misses;
+}
+
+} /* namespace database */
+} /* inline namespace v1_6 */
+} /* namespace sqlite4esl */
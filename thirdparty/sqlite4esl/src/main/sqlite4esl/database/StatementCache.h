@@ -0,0 +1,73 @@
+/*
+ * This file is part of sqlite4esl.
+ * Copyright (C) 2020-2023 Sven Lukas
+ *
+ * Sqlite4esl is free software: you can redistribute it and/or modify
+ * it under the terms of the GNU Lesser Public License as published by
+ * the Free Software Foundation, either version 3 of the License, or
+ * (at your option) any later version.
+ *
+ * Sqlite4esl is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU Lesser Public License for more details.
+ *
+ * You should have received a copy of the GNU Lesser Public License
+ * along with mhd4esl.  If not, see <https://www.gnu.org/licenses/>.
+ */
+
+#ifndef SQLITE4ESL_DATABASE_STATEMENTCACHE_H_
+#define SQLITE4ESL_DATABASE_STATEMENTCACHE_H_
+
+#include <sqlite4esl/database/StatementHandle.h>
+
+#include <sqlite3.h>
+
+#include <cstddef>
+#include <list>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+#include <utility>
+
+namespace sqlite4esl {
+inline namespace v1_6 {
+namespace database {
+
+/* LRU cache of prepared statements of a database connection, keyed by SQL text.
+ * A statement handle returned by prepare() is reset and given back to the cache when it gets destroyed. */
+class StatementCache {
+public:
+	StatementCache(sqlite3& connectionHandle, std::size_t capacity);
+	StatementCache(const StatementCache&) = delete;
+	~StatementCache();
+
+	StatementCache& operator=(const StatementCache&) = delete;
+
+	StatementHandle prepare(const std::string& sql);
+
+	/* called by StatementHandle */
+	void release(const std::string& sql, sqlite3_stmt& handle);
+
+	std::size_t getHits() const;
+	std::size_t getMisses() const;
+
+private:
+	sqlite3& connectionHandle;
+	const std::size_t capacity;
+
+	mutable std::mutex mutex;
+
+	/* idle statements, most recently used first */
+	std::list<std::pair<std::string, sqlite3_stmt*>> statements;
+	std::unordered_map<std::string, std::list<std::pair<std::string, sqlite3_stmt*>>::iterator> statementsBySql;
+
+	std::size_t hits = 0;
+	std::size_t misses = 0;
+};
+
+} /* namespace database */
+} /* inline namespace v1_6 */
+} /* namespace sqlite4esl */
+
+#endif /* SQLITE4ESL_DATABASE_STATEMENTCACHE_H_ */
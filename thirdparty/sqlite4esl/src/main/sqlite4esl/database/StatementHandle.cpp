@@ -17,6 +17,7 @@
  */
 
 #include <sqlite4esl/database/StatementHandle.h>
+#include <sqlite4esl/database/StatementCache.h>
 
 #include <esl/Logger.h>
 
@@ -25,6 +26,7 @@
 #include <esl/monitoring/Streams.h>
 
 #include <stdexcept>
+#include <utility>
 
 namespace sqlite4esl {
 inline namespace v1_6 {
@@ -35,9 +37,12 @@ esl::Logger logger("sqlite4esl::database::PreparedHandle");
 }
 
 StatementHandle::StatementHandle(StatementHandle&& other)
-: handle(other.handle)
+: handle(other.handle),
+  statementCache(other.statementCache),
+  sql(std::move(other.sql))
 {
 	other.handle = nullptr;
+	other.statementCache = nullptr;
 	logger.trace << "Statement handle constructed (moved)\n";
 }
 
@@ -46,12 +51,46 @@ StatementHandle::StatementHandle(sqlite3_stmt& aHandle)
 {
 }
 
+StatementHandle::StatementHandle(sqlite3_stmt& aHandle, StatementCache& aStatementCache, const std::string& aSql)
+: handle(&aHandle),
+  statementCache(&aStatementCache),
+  sql(aSql)
+{
+}
+
 StatementHandle::~StatementHandle() {
+	close();
+}
+
+StatementHandle& StatementHandle::operator=(StatementHandle&& other) {
+	if(this != &other) {
+		close();
+
+		handle = other.handle;
+		statementCache = other.statementCache;
+		sql = std::move(other.sql);
+
+		other.handle = nullptr;
+		other.statementCache = nullptr;
+		logger.trace << "Statement handle moved\n";
+	}
+	return *this;
+}
+
+void StatementHandle::close() {
 	if(handle == nullptr) {
 		logger.debug << "Close statement handle (closed already)\n";
 		return;
 	}
 
+	if(statementCache) {
+		logger.debug << "Give statement handle back to cache\n";
+		statementCache->release(sql, *handle);
+		handle = nullptr;
+		statementCache = nullptr;
+		return;
+	}
+
 	logger.debug << "Close statement handle\n";
 
 	esl::monitoring::Streams::Location location;
@@ -101,13 +140,6 @@ StatementHandle::~StatementHandle() {
 	handle = nullptr;
 }
 
-StatementHandle& StatementHandle::operator=(StatementHandle&& other) {
-	handle = other.handle;
-	other.handle = nullptr;
-	logger.trace << "Statement handle moved\n";
-	return *this;
-}
-
 StatementHandle::operator bool() const noexcept {
 	return handle != nullptr;
 }
@@ -140,6 +172,10 @@ void StatementHandle::reset() const {
 	}
 }
 
+bool StatementHandle::isReadOnlyQuery() const {
+	return sqlite3_stmt_readonly(&getHandle()) != 0 && sqlite3_column_count(&getHandle()) > 0;
+}
+
 std::size_t StatementHandle::columnCount() const {
 	int count = sqlite3_column_count(&getHandle());
 	if(count < 0) {
@@ -195,6 +231,12 @@ double StatementHandle::columnDouble(std::size_t index) const {
 }
 
 std::string StatementHandle::columnText(std::size_t index) const {
+	std::size_t length;
+	const char* data = columnText(index, length);
+	return std::string(data, length);
+}
+
+const char* StatementHandle::columnText(std::size_t index, std::size_t& resultLength) const {
 	//const char* data = static_cast<const char*>(sqlite3_column_text(&statementHandle.getHandle(), static_cast<int>(index)));
 	const char* data = reinterpret_cast<const char*>(sqlite3_column_text(&getHandle(), static_cast<int>(index)));
 	if(data == nullptr) {
@@ -206,12 +248,21 @@ std::string StatementHandle::columnText(std::size_t index) const {
         throw esl::system::Stacktrace::add(std::runtime_error("sqlite3_column_bytes returned a negative value: " + std::to_string(length)));
 	}
 
-	return std::string(data, static_cast<std::size_t>(length));
+	resultLength = static_cast<std::size_t>(length);
+	return data;
 }
 
 std::string StatementHandle::columnBlob(std::size_t index) const {
+	std::size_t length;
+	const char* data = columnBlob(index, length);
+	return std::string(data, length);
+}
+
+const char* StatementHandle::columnBlob(std::size_t index, std::size_t& resultLength) const {
 	const char* data = static_cast<const char*>(sqlite3_column_blob(&getHandle(), static_cast<int>(index)));
 	if(data == nullptr) {
+		/* zero-length blob */
+		resultLength = 0;
 		return "";
 	}
 
@@ -220,7 +271,12 @@ std::string StatementHandle::columnBlob(std::size_t index) const {
         throw esl::system::Stacktrace::add(std::runtime_error("sqlite3_column_bytes returned a negative value: " + std::to_string(length)));
 	}
 
-	return std::string(data, static_cast<std::size_t>(length));
+	resultLength = static_cast<std::size_t>(length);
+	return data;
+}
+
+bool StatementHandle::columnValueIsBlob(std::size_t index) const {
+	return sqlite3_column_type(&getHandle(), static_cast<int>(index)) == SQLITE_BLOB;
 }
 
 std::size_t StatementHandle::bindParameterCount() const {
@@ -233,7 +289,7 @@ std::size_t StatementHandle::bindParameterCount() const {
 }
 
 void StatementHandle::bindNull(std::size_t index) const {
-	int rc = sqlite3_bind_null(&getHandle(), static_cast<int>(index));
+	int rc = sqlite3_bind_null(&getHandle(), static_cast<int>(index+1));
 
 	if(rc != SQLITE_OK) {
 		std::string message = "Cannot bind null value to parameter[" + std::to_string(index+1) + "]: " + sqlite3_errstr(rc);
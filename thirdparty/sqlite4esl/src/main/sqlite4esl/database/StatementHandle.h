@@ -30,6 +30,8 @@ namespace sqlite4esl {
 inline namespace v1_6 {
 namespace database {
 
+class StatementCache;
+
 class StatementHandle {
 public:
 	StatementHandle() = default;
@@ -37,6 +39,9 @@ public:
 	StatementHandle(StatementHandle&& statementHandle);
 	StatementHandle(sqlite3_stmt& handle);
 
+	/* handle is given back to statementCache on destruction instead of finalizing it */
+	StatementHandle(sqlite3_stmt& handle, StatementCache& statementCache, const std::string& sql);
+
 	~StatementHandle();
 
 	StatementHandle& operator=(const StatementHandle&) = delete;
@@ -47,6 +52,10 @@ public:
 	bool step() const;
 	void reset() const;
 	std::size_t columnCount() const;
+
+	/* true if the statement returns rows and does not write to the database. Statements like BEGIN or COMMIT
+	 * are read-only for SQLite, but they return no rows. */
+	bool isReadOnlyQuery() const;
 	std::string columnName(std::size_t index) const;
 	std::string columnDeclType(std::size_t index) const;
 
@@ -55,8 +64,15 @@ public:
 	std::int64_t columnInteger(std::size_t index) const;
 	double columnDouble(std::size_t index) const;
 	std::string columnText(std::size_t index) const;
+
+	/* returns a pointer to the text of the current row, valid until the next step or reset */
+	const char* columnText(std::size_t index, std::size_t& length) const;
 	std::string columnBlob(std::size_t index) const;
 
+	/* returns a pointer to the blob of the current row, valid until the next step or reset */
+	const char* columnBlob(std::size_t index, std::size_t& length) const;
+	bool columnValueIsBlob(std::size_t index) const;
+
 	std::size_t bindParameterCount() const;
 	void bindNull(std::size_t index) const;
 	void bindInteger(std::size_t index, std::int64_t value) const;
@@ -68,6 +84,12 @@ public:
 
 protected:
 	sqlite3_stmt* handle = nullptr;
+
+private:
+	StatementCache* statementCache = nullptr;
+	std::string sql;
+
+	void close();
 };
 
 } /* namespace database */